@@ -4,8 +4,15 @@
 #include <string.h>
 #include <stdint.h>
 #include <stdarg.h>
+#include <limits.h>
 #include <inttypes.h>
 
+#if defined(__AVX2__) || defined(__F16C__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #define LINEARBUFFERS_DEBUG_NAME "encoder"
 
 #include "debug.h"
@@ -19,6 +26,86 @@
 #define MAX(a, b)                       ((a) > (b) ? (a) : (b))
 #endif
 
+struct linearbuffers_allocator {
+        void * (*malloc) (void *context, uint64_t size);
+        void * (*realloc) (void *context, void *ptr, uint64_t size);
+        void (*free) (void *context, void *ptr);
+        void * (*aligned_malloc) (void *context, uint64_t alignment, uint64_t size);
+        void *context;
+};
+
+static void * linearbuffers_allocator_default_malloc (void *context, uint64_t size)
+{
+        (void) context;
+        return malloc(size);
+}
+
+static void * linearbuffers_allocator_default_realloc (void *context, void *ptr, uint64_t size)
+{
+        (void) context;
+        return realloc(ptr, size);
+}
+
+static void linearbuffers_allocator_default_free (void *context, void *ptr)
+{
+        (void) context;
+        free(ptr);
+}
+
+static void * linearbuffers_allocator_default_aligned_malloc (void *context, uint64_t alignment, uint64_t size)
+{
+        void *ptr;
+        (void) context;
+        if (posix_memalign(&ptr, alignment, size) != 0) {
+                return NULL;
+        }
+        return ptr;
+}
+
+static inline void * linearbuffers_allocator_malloc (const struct linearbuffers_allocator *allocator, uint64_t size)
+{
+        return allocator->malloc(allocator->context, size);
+}
+
+static inline void * linearbuffers_allocator_aligned_malloc (const struct linearbuffers_allocator *allocator, uint64_t alignment, uint64_t size, void **base)
+{
+        uint8_t *ptr;
+        if (allocator->aligned_malloc != NULL) {
+                *base = allocator->aligned_malloc(allocator->context, alignment, size);
+                return *base;
+        }
+        /* no aligned hook, over allocate and align within, the base is
+         * what has to be freed */
+        *base = allocator->malloc(allocator->context, size + alignment - 1);
+        if (*base == NULL) {
+                return NULL;
+        }
+        ptr = *base;
+        return ptr + (alignment - ((uintptr_t) ptr % alignment)) % alignment;
+}
+
+static inline void linearbuffers_allocator_free (const struct linearbuffers_allocator *allocator, void *ptr)
+{
+        allocator->free(allocator->context, ptr);
+}
+
+static void * linearbuffers_allocator_realloc (const struct linearbuffers_allocator *allocator, void *ptr, uint64_t osize, uint64_t nsize)
+{
+        void *tmp;
+        if (allocator->realloc != NULL) {
+                return allocator->realloc(allocator->context, ptr, nsize);
+        }
+        tmp = allocator->malloc(allocator->context, nsize);
+        if (tmp == NULL) {
+                return NULL;
+        }
+        if (ptr != NULL) {
+                memcpy(tmp, ptr, MIN(osize, nsize));
+                allocator->free(allocator->context, ptr);
+        }
+        return tmp;
+}
+
 #define LINEARBUFFERS_POOL_ENABLE       1
 
 struct linearbuffers_pool_element {
@@ -35,12 +122,14 @@ struct linearbuffers_pool {
         uint64_t selements;
         uint64_t nelements;
         uint64_t uelements;
+        uint64_t nblocks;
         struct linearbuffers_pool_element *felements;
         struct linearbuffers_pool_block *cblock;
         struct linearbuffers_pool_block *blocks;
+        const struct linearbuffers_allocator *allocator;
 };
 
-static int linearbuffers_pool_init (struct linearbuffers_pool *pool, const char *name, uint64_t selements, uint64_t nelements);
+static int linearbuffers_pool_init (struct linearbuffers_pool *pool, const char *name, uint64_t selements, uint64_t nelements, const struct linearbuffers_allocator *allocator);
 static void linearbuffers_pool_uninit (struct linearbuffers_pool *pool);
 
 #if defined(LINEARBUFFERS_POOL_ENABLE) && (LINEARBUFFERS_POOL_ENABLE == 1)
@@ -50,22 +139,37 @@ static void linearbuffers_pool_free (struct linearbuffers_pool *pool, void *ptr)
 
 #else
 
-#define linearbuffers_pool_malloc(p)    malloc((p)->selements)
-#define linearbuffers_pool_free(p, d)   free(d)
+#define linearbuffers_pool_malloc(p)    linearbuffers_allocator_malloc((p)->allocator, (p)->selements)
+#define linearbuffers_pool_free(p, d)   linearbuffers_allocator_free((p)->allocator, d)
 
 #endif
 
-static void linearbuffers_pool_uninit (struct linearbuffers_pool *pool)
+static void linearbuffers_pool_trim (struct linearbuffers_pool *pool)
 {
         struct linearbuffers_pool_block *block;
         struct linearbuffers_pool_block *nblock;
         for (block = pool->blocks; block && ((nblock = block->next), 1); block = nblock) {
-                free(block);
+                linearbuffers_allocator_free(pool->allocator, block);
         }
+        pool->uelements = 0;
+        pool->nblocks = 0;
+        pool->felements = NULL;
+        pool->cblock = NULL;
+        pool->blocks = NULL;
+}
+
+static uint64_t linearbuffers_pool_size (struct linearbuffers_pool *pool)
+{
+        return pool->nblocks * (sizeof(struct linearbuffers_pool_block) + ((sizeof(struct linearbuffers_pool_element) + pool->selements) * pool->nelements));
+}
+
+static void linearbuffers_pool_uninit (struct linearbuffers_pool *pool)
+{
+        linearbuffers_pool_trim(pool);
         memset(pool, 0, sizeof(struct linearbuffers_pool));
 }
 
-static int linearbuffers_pool_init (struct linearbuffers_pool *pool, const char *name, uint64_t selements, uint64_t nelements)
+static int linearbuffers_pool_init (struct linearbuffers_pool *pool, const char *name, uint64_t selements, uint64_t nelements, const struct linearbuffers_allocator *allocator)
 {
         memset(pool, 0, sizeof(struct linearbuffers_pool));
         linearbuffers_debugf("init name: %s, selements: %" PRIu64 ", nelements: %" PRIu64 "", name, selements, nelements);
@@ -75,6 +179,7 @@ static int linearbuffers_pool_init (struct linearbuffers_pool *pool, const char
         pool->felements = NULL;
         pool->cblock = NULL;
         pool->blocks = NULL;
+        pool->allocator = allocator;
         return 0;
 }
 
@@ -94,7 +199,7 @@ static void * linearbuffers_pool_malloc (struct linearbuffers_pool *pool)
                 struct linearbuffers_pool_block *block;
                 struct linearbuffers_pool_block *blocks;
                 linearbuffers_debugf("pool(%s): creating new block", pool->name);
-                block = malloc(sizeof(struct linearbuffers_pool_block) + ((sizeof(struct linearbuffers_pool_element) + pool->selements) * pool->nelements));
+                block = linearbuffers_allocator_malloc(pool->allocator, sizeof(struct linearbuffers_pool_block) + ((sizeof(struct linearbuffers_pool_element) + pool->selements) * pool->nelements));
                 if (block == NULL) {
                         linearbuffers_errorf("can not allocate memory");
                         return NULL;
@@ -104,6 +209,7 @@ static void * linearbuffers_pool_malloc (struct linearbuffers_pool *pool)
                 pool->blocks->next = blocks;
                 pool->cblock = block;
                 pool->uelements = 0;
+                pool->nblocks += 1;
         }
         element = (struct linearbuffers_pool_element *) (pool->cblock->buffer + ((sizeof(struct linearbuffers_pool_element) + pool->selements) * pool->uelements));
         pool->uelements += 1;
@@ -119,39 +225,459 @@ static void linearbuffers_pool_free (struct linearbuffers_pool *p, void *ptr)
 
 #endif
 
-#define LINEARBUFFERS_PRESENT_BUFFER_COUNT        (64 / 8)
-struct linearbuffers_present_buffer {
-        struct linearbuffers_present_buffer *next;
-        uint8_t buffer[LINEARBUFFERS_PRESENT_BUFFER_COUNT];
-};
+#define LINEARBUFFERS_SCRATCH_SIZE_MIN          (256)
+#define LINEARBUFFERS_SCRATCH_ALIGN             (sizeof(uint64_t))
 
-struct linearbuffers_present_table {
-        uint64_t bytes;
-        struct linearbuffers_present_buffer *buffers;
+struct linearbuffers_scratch {
+        uint8_t *buffer;
+        uint64_t length;
+        uint64_t size;
+        int fixed;
+        const struct linearbuffers_allocator *allocator;
 };
 
-#define LINEARBUFFERS_OFFSET_BUFFER_64_COUNT    (64)
-#define LINEARBUFFERS_OFFSET_BUFFER_32_COUNT    (LINEARBUFFERS_OFFSET_BUFFER_64_COUNT * (sizeof(uint64_t) / sizeof(uint32_t)))
-#define LINEARBUFFERS_OFFSET_BUFFER_16_COUNT    (LINEARBUFFERS_OFFSET_BUFFER_32_COUNT * (sizeof(uint32_t) / sizeof(uint16_t)))
-#define LINEARBUFFERS_OFFSET_BUFFER_8_COUNT     (LINEARBUFFERS_OFFSET_BUFFER_16_COUNT * (sizeof(uint16_t) / sizeof(uint8_t)))
-struct linearbuffers_offset_buffer {
-        struct linearbuffers_offset_buffer *next;
-        union {
-                uint64_t _64[LINEARBUFFERS_OFFSET_BUFFER_64_COUNT];
-                uint32_t _32[LINEARBUFFERS_OFFSET_BUFFER_32_COUNT];
-                uint16_t _16[LINEARBUFFERS_OFFSET_BUFFER_16_COUNT];
-                uint8_t   _8[LINEARBUFFERS_OFFSET_BUFFER_8_COUNT];
-        } u;
+static void linearbuffers_scratch_trim (struct linearbuffers_scratch *scratch)
+{
+        if (scratch->fixed) {
+                return;
+        }
+        if (scratch->buffer != NULL) {
+                linearbuffers_allocator_free(scratch->allocator, scratch->buffer);
+        }
+        scratch->buffer = NULL;
+        scratch->length = 0;
+        scratch->size = 0;
+}
+
+static void linearbuffers_scratch_uninit (struct linearbuffers_scratch *scratch)
+{
+        linearbuffers_scratch_trim(scratch);
+        memset(scratch, 0, sizeof(struct linearbuffers_scratch));
+}
+
+static int linearbuffers_scratch_init (struct linearbuffers_scratch *scratch, const struct linearbuffers_allocator *allocator)
+{
+        memset(scratch, 0, sizeof(struct linearbuffers_scratch));
+        scratch->allocator = allocator;
+        return 0;
+}
+
+static int linearbuffers_scratch_init_fixed (struct linearbuffers_scratch *scratch, void *buffer, uint64_t size)
+{
+        uint64_t pad;
+        memset(scratch, 0, sizeof(struct linearbuffers_scratch));
+        pad = (LINEARBUFFERS_SCRATCH_ALIGN - ((uintptr_t) buffer % LINEARBUFFERS_SCRATCH_ALIGN)) % LINEARBUFFERS_SCRATCH_ALIGN;
+        if (size < pad) {
+                linearbuffers_errorf("size is invalid");
+                goto bail;
+        }
+        scratch->buffer = ((uint8_t *) buffer) + pad;
+        scratch->size = size - pad;
+        scratch->fixed = 1;
+        return 0;
+bail:   return -1;
+}
+
+static int linearbuffers_scratch_reserve (struct linearbuffers_scratch *scratch, uint64_t size)
+{
+        void *tmp;
+        uint64_t nsize;
+        if (size <= scratch->size) {
+                return 0;
+        }
+        if (scratch->fixed) {
+                linearbuffers_errorf("scratch is full, size: %" PRIu64 ", requested: %" PRIu64 "", scratch->size, size);
+                goto bail;
+        }
+        nsize = MAX(scratch->size, LINEARBUFFERS_SCRATCH_SIZE_MIN);
+        while (nsize < size) {
+                nsize *= 2;
+        }
+        linearbuffers_debugf("scratch grow size: %" PRIu64 ", nsize: %" PRIu64 "", scratch->size, nsize);
+        tmp = linearbuffers_allocator_realloc(scratch->allocator, scratch->buffer, scratch->size, nsize);
+        if (tmp == NULL) {
+                linearbuffers_errorf("can not allocate memory");
+                goto bail;
+        }
+        scratch->buffer = tmp;
+        scratch->size = nsize;
+        return 0;
+bail:   return -1;
+}
+
+static int linearbuffers_scratch_push (struct linearbuffers_scratch *scratch, uint64_t size, uint64_t *offset)
+{
+        int rc;
+        uint64_t start;
+        start = ((scratch->length + LINEARBUFFERS_SCRATCH_ALIGN - 1) / LINEARBUFFERS_SCRATCH_ALIGN) * LINEARBUFFERS_SCRATCH_ALIGN;
+        rc = linearbuffers_scratch_reserve(scratch, start + size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve scratch");
+                goto bail;
+        }
+        scratch->length = start + size;
+        *offset = start;
+        return 0;
+bail:   return -1;
+}
+
+static void linearbuffers_scratch_pop (struct linearbuffers_scratch *scratch, uint64_t offset)
+{
+        scratch->length = MIN(scratch->length, offset);
+}
+
+#define LINEARBUFFERS_TABLE_INLINE_SIZE         (64)
+struct linearbuffers_table_buffer {
+        uint64_t size;
+        uint64_t offset;
+        uint8_t buffer[LINEARBUFFERS_TABLE_INLINE_SIZE];
 };
 
 struct linearbuffers_offset_table {
         uint64_t count;
-        struct linearbuffers_offset_buffer *cbuffer;
-        struct linearbuffers_offset_buffer *buffers;
-        int (*push) (struct linearbuffers_offset_table *offset, uint64_t value, struct linearbuffers_pool *linearbuffers_pool);
-        int (*emit) (struct linearbuffers_offset_table *table, int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t *offset, uint64_t diff);
+        uint64_t offset;
+        int (*push) (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, uint64_t value);
+        int (*emit) (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t diff);
+};
+
+#define LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MIN     (4096)
+#define LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MAX     (64 * 1024 * 1024)
+#define LINEARBUFFERS_OUTPUT_CHUNK_ALIGN        (4096)
+
+struct linearbuffers_output_chunk {
+        struct linearbuffers_output_chunk *next;
+        uint64_t offset;
+        uint64_t size;
+        uint64_t capacity;
+        uint8_t *buffer;
+        void *base;
+};
+
+struct linearbuffers_output {
+        uint64_t length;
+        uint64_t size;
+        uint64_t nchunks;
+        struct linearbuffers_output_chunk *cchunk;
+        struct linearbuffers_output_chunk *tchunk;
+        struct linearbuffers_output_chunk *chunks;
+        struct linearbuffers_output_chunk fchunk;
+        uint64_t alignment;
+        int fixed;
+        const struct linearbuffers_allocator *allocator;
 };
 
+static inline uint64_t linearbuffers_output_phase_alignment (uint64_t phase)
+{
+        phase %= LINEARBUFFERS_OUTPUT_CHUNK_ALIGN;
+        return (phase == 0) ? LINEARBUFFERS_OUTPUT_CHUNK_ALIGN : (phase & -phase);
+}
+
+static void linearbuffers_output_chunk_destroy (const struct linearbuffers_allocator *allocator, struct linearbuffers_output_chunk *chunk)
+{
+        if (chunk == NULL) {
+                return;
+        }
+        if (chunk->base != NULL) {
+                linearbuffers_allocator_free(allocator, chunk->base);
+        }
+        linearbuffers_allocator_free(allocator, chunk);
+}
+
+static struct linearbuffers_output_chunk * linearbuffers_output_chunk_create (const struct linearbuffers_allocator *allocator, uint64_t offset, uint64_t size)
+{
+        struct linearbuffers_output_chunk *chunk;
+        chunk = linearbuffers_allocator_malloc(allocator, sizeof(struct linearbuffers_output_chunk));
+        if (chunk == NULL) {
+                linearbuffers_errorf("can not allocate memory");
+                goto bail;
+        }
+        memset(chunk, 0, sizeof(struct linearbuffers_output_chunk));
+        chunk->offset = offset;
+        chunk->size = size;
+        chunk->capacity = size;
+        chunk->buffer = linearbuffers_allocator_aligned_malloc(allocator, LINEARBUFFERS_OUTPUT_CHUNK_ALIGN, size, &chunk->base);
+        if (chunk->buffer == NULL) {
+                linearbuffers_errorf("can not allocate memory");
+                goto bail;
+        }
+        return chunk;
+bail:   linearbuffers_output_chunk_destroy(allocator, chunk);
+        return NULL;
+}
+
+static void linearbuffers_output_uninit (struct linearbuffers_output *output)
+{
+        struct linearbuffers_output_chunk *chunk;
+        struct linearbuffers_output_chunk *nchunk;
+        if (output->fixed == 0) {
+                for (chunk = output->chunks; chunk && ((nchunk = chunk->next), 1); chunk = nchunk) {
+                        linearbuffers_output_chunk_destroy(output->allocator, chunk);
+                }
+        }
+        memset(output, 0, sizeof(struct linearbuffers_output));
+}
+
+static int linearbuffers_output_init (struct linearbuffers_output *output, const struct linearbuffers_allocator *allocator)
+{
+        memset(output, 0, sizeof(struct linearbuffers_output));
+        output->alignment = LINEARBUFFERS_OUTPUT_CHUNK_ALIGN;
+        output->allocator = allocator;
+        return 0;
+}
+
+static int linearbuffers_output_init_fixed (struct linearbuffers_output *output, void *buffer, uint64_t size)
+{
+        memset(output, 0, sizeof(struct linearbuffers_output));
+        output->fchunk.buffer = buffer;
+        output->fchunk.size = size;
+        output->fchunk.capacity = size;
+        output->chunks = &output->fchunk;
+        output->cchunk = &output->fchunk;
+        output->tchunk = &output->fchunk;
+        output->nchunks = 1;
+        output->size = size;
+        output->alignment = linearbuffers_output_phase_alignment((uintptr_t) buffer);
+        output->fixed = 1;
+        return 0;
+}
+
+static void linearbuffers_output_reset (struct linearbuffers_output *output)
+{
+        struct linearbuffers_output_chunk *chunk;
+        output->length = 0;
+        output->size = 0;
+        for (chunk = output->chunks; chunk; chunk = chunk->next) {
+                chunk->offset = output->size;
+                chunk->size = chunk->capacity;
+                output->size += chunk->size;
+        }
+        output->cchunk = output->chunks;
+}
+
+static uint64_t linearbuffers_output_capacity (struct linearbuffers_output *output)
+{
+        uint64_t capacity;
+        struct linearbuffers_output_chunk *chunk;
+        if (output->fixed) {
+                return 0;
+        }
+        capacity = 0;
+        for (chunk = output->chunks; chunk; chunk = chunk->next) {
+                capacity += chunk->capacity;
+        }
+        return capacity;
+}
+
+static void linearbuffers_output_trim (struct linearbuffers_output *output, uint64_t capacity)
+{
+        struct linearbuffers_output_chunk *chunk;
+        struct linearbuffers_output_chunk *nchunk;
+        struct linearbuffers_output_chunk *pchunk;
+        if (output->fixed) {
+                return;
+        }
+        pchunk = NULL;
+        for (chunk = output->chunks; chunk; chunk = chunk->next) {
+                if (chunk->offset + chunk->capacity > capacity) {
+                        break;
+                }
+                pchunk = chunk;
+        }
+        for (; chunk && ((nchunk = chunk->next), 1); chunk = nchunk) {
+                linearbuffers_debugf("output trim chunk offset: %" PRIu64 ", size: %" PRIu64 "", chunk->offset, chunk->capacity);
+                linearbuffers_output_chunk_destroy(output->allocator, chunk);
+                output->nchunks -= 1;
+        }
+        if (pchunk == NULL) {
+                output->chunks = NULL;
+                output->size = 0;
+                output->alignment = LINEARBUFFERS_OUTPUT_CHUNK_ALIGN;
+        } else {
+                pchunk->next = NULL;
+                output->size = pchunk->offset + pchunk->size;
+        }
+        output->tchunk = pchunk;
+        output->cchunk = output->chunks;
+}
+
+static int linearbuffers_output_grow (struct linearbuffers_output *output, uint64_t size)
+{
+        uint64_t csize;
+        struct linearbuffers_output_chunk *chunk;
+        if (size <= output->size) {
+                return 0;
+        }
+        if (output->fixed) {
+                linearbuffers_errorf("output is full, size: %" PRIu64 ", requested: %" PRIu64 "", output->size, size);
+                goto bail;
+        }
+        csize = MIN(MAX(output->size, LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MIN), LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MAX);
+        csize = MAX(csize, size - output->size);
+        csize = ((csize + LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MIN - 1) / LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MIN) * LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MIN;
+        linearbuffers_debugf("output grow size: %" PRIu64 ", chunk: %" PRIu64 "", output->size, csize);
+        chunk = linearbuffers_output_chunk_create(output->allocator, output->size, csize);
+        if (chunk == NULL) {
+                linearbuffers_errorf("can not create output chunk");
+                goto bail;
+        }
+        if (output->tchunk == NULL) {
+                output->chunks = chunk;
+                output->cchunk = chunk;
+        } else {
+                output->tchunk->next = chunk;
+        }
+        output->tchunk = chunk;
+        output->nchunks += 1;
+        output->size += csize;
+        return 0;
+bail:   return -1;
+}
+
+static struct linearbuffers_output_chunk * linearbuffers_output_chunk_find (struct linearbuffers_output *output, uint64_t offset)
+{
+        struct linearbuffers_output_chunk *chunk;
+        chunk = (offset >= output->cchunk->offset) ? output->cchunk : output->chunks;
+        while (chunk->offset + chunk->size <= offset) {
+                chunk = chunk->next;
+        }
+        return chunk;
+}
+
+static int linearbuffers_output_write (struct linearbuffers_output *output, uint64_t offset, const void *buffer, int64_t length)
+{
+        int rc;
+        uint64_t size;
+        uint64_t coffset;
+        struct linearbuffers_output_chunk *chunk;
+        if (length < 0) {
+                output->length = offset + length;
+                return 0;
+        }
+        if (length == 0) {
+                return 0;
+        }
+        rc = linearbuffers_output_grow(output, offset + length);
+        if (rc != 0) {
+                linearbuffers_errorf("can not grow output");
+                goto bail;
+        }
+        output->length = MAX(output->length, offset + length);
+        chunk = linearbuffers_output_chunk_find(output, offset);
+        while (1) {
+                coffset = offset - chunk->offset;
+                size = MIN((uint64_t) length, chunk->size - coffset);
+                if (buffer == NULL) {
+                        memset(chunk->buffer + coffset, 0, size);
+                } else {
+                        memcpy(chunk->buffer + coffset, buffer, size);
+                        buffer = ((const uint8_t *) buffer) + size;
+                }
+                offset += size;
+                length -= size;
+                if (length == 0) {
+                        break;
+                }
+                chunk = chunk->next;
+        }
+        output->cchunk = chunk;
+        return 0;
+bail:   return -1;
+}
+
+static void * linearbuffers_output_reserve (struct linearbuffers_output *output, uint64_t offset, uint64_t length)
+{
+        int rc;
+        uint64_t seal;
+        struct linearbuffers_output_chunk *chunk;
+        struct linearbuffers_output_chunk *nchunk;
+        length = MAX(length, 1);
+        rc = linearbuffers_output_grow(output, offset + length);
+        if (rc != 0) {
+                linearbuffers_errorf("can not grow output");
+                goto bail;
+        }
+        chunk = linearbuffers_output_chunk_find(output, offset);
+        if (offset + length > chunk->offset + chunk->size) {
+                while (chunk->next != NULL) {
+                        nchunk = chunk->next;
+                        chunk->next = nchunk->next;
+                        linearbuffers_output_chunk_destroy(output->allocator, nchunk);
+                        output->nchunks -= 1;
+                }
+                /* split at an aligned offset so that buffer addresses in the
+                 * new chunk stay congruent with output offsets, carrying
+                 * the bytes written since over. */
+                seal = offset - ((offset - chunk->offset) % LINEARBUFFERS_OUTPUT_CHUNK_ALIGN);
+                linearbuffers_debugf("output seal chunk offset: %" PRIu64 ", size: %" PRIu64 "", chunk->offset, seal - chunk->offset);
+                chunk->size = seal - chunk->offset;
+                output->size = seal;
+                output->tchunk = chunk;
+                rc = linearbuffers_output_grow(output, offset + length);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not grow output");
+                        goto bail;
+                }
+                memcpy(output->tchunk->buffer, chunk->buffer + chunk->size, offset - seal);
+                chunk = output->tchunk;
+        }
+        output->cchunk = chunk;
+        return chunk->buffer + (offset - chunk->offset);
+bail:   return NULL;
+}
+
+static const void * linearbuffers_output_linearize (struct linearbuffers_output *output)
+{
+        uint64_t size;
+        struct linearbuffers_output_chunk *chunk;
+        struct linearbuffers_output_chunk *nchunk;
+        struct linearbuffers_output_chunk *lchunk;
+        if (output->chunks == NULL) {
+                return NULL;
+        }
+        if (output->length <= output->chunks->size) {
+                return output->chunks->buffer;
+        }
+        linearbuffers_debugf("output linearize length: %" PRIu64 ", chunks: %" PRIu64 "", output->length, output->nchunks);
+        size = ((output->length + LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MIN - 1) / LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MIN) * LINEARBUFFERS_OUTPUT_CHUNK_SIZE_MIN;
+        lchunk = linearbuffers_output_chunk_create(output->allocator, 0, size);
+        if (lchunk == NULL) {
+                linearbuffers_errorf("can not create output chunk");
+                return NULL;
+        }
+        for (chunk = output->chunks; chunk && ((nchunk = chunk->next), 1); chunk = nchunk) {
+                if (chunk->offset < output->length) {
+                        size = MIN(chunk->size, output->length - chunk->offset);
+                        memcpy(lchunk->buffer + chunk->offset, chunk->buffer, size);
+                }
+                linearbuffers_output_chunk_destroy(output->allocator, chunk);
+        }
+        output->chunks = lchunk;
+        output->cchunk = lchunk;
+        output->tchunk = lchunk;
+        output->nchunks = 1;
+        output->size = lchunk->size;
+        output->alignment = LINEARBUFFERS_OUTPUT_CHUNK_ALIGN;
+        return lchunk->buffer;
+}
+
+static int64_t linearbuffers_output_iovec (struct linearbuffers_output *output, struct linearbuffers_encoder_iovec *iovec, uint64_t count)
+{
+        uint64_t i;
+        struct linearbuffers_output_chunk *chunk;
+        i = 0;
+        for (chunk = output->chunks; chunk && chunk->offset < output->length; chunk = chunk->next) {
+                if (chunk->size == 0) {
+                        continue;
+                }
+                if (iovec != NULL && i < count) {
+                        iovec[i].base = chunk->buffer;
+                        iovec[i].length = MIN(chunk->size, output->length - chunk->offset);
+                }
+                i++;
+        }
+        return i;
+}
+
 enum linearbuffers_entry_type {
         linearbuffers_entry_type_unknown,
         linearbuffers_entry_type_table,
@@ -160,7 +686,11 @@ enum linearbuffers_entry_type {
 
 struct linearbuffers_entry_table {
         uint64_t elements;
-        struct linearbuffers_present_table present;
+        uint64_t present;
+        const struct linearbuffers_encoder_table_field *fields;
+        uint64_t block;
+        int promoted;
+        struct linearbuffers_table_buffer buffer;
 };
 
 enum linearbuffers_vector_type {
@@ -174,6 +704,8 @@ enum linearbuffers_vector_type {
         linearbuffers_vector_type_uint64,
         linearbuffers_vector_type_float,
         linearbuffers_vector_type_double,
+        linearbuffers_vector_type_float16,
+        linearbuffers_vector_type_bfloat16,
         linearbuffers_vector_type_string,
         linearbuffers_vector_type_table,
 };
@@ -193,156 +725,267 @@ struct linearbuffers_entry {
                 struct linearbuffers_entry_vector vector;
         } u;
         uint64_t count_size;
-        int (*count_emitter) (int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t offset, uint64_t value);
+        int (*count_emitter) (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value);
         uint64_t offset_size;
-        int (*offset_emitter) (int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t offset, uint64_t value);
+        int (*offset_emitter) (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value);
         uint64_t offset;
 };
 
 struct linearbuffers_encoder {
         struct linearbuffers_entries entries;
+        struct linearbuffers_entry *current;
         struct {
                 int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length);
                 void *context;
                 uint64_t offset;
+                int direct;
         } emitter;
         struct {
-                void *buffer;
+                uint64_t offset;
                 uint64_t length;
-                uint64_t size;
-        } output;
+                uint64_t count_size;
+                int (*count_emitter) (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value);
+                uint64_t scratch;
+                uint8_t *buffer;
+        } reserve;
+        struct linearbuffers_output output;
+        struct linearbuffers_scratch scratch;
         struct {
                 struct linearbuffers_pool entry;
-                struct linearbuffers_pool present;
-                struct linearbuffers_pool offset;
         } pool;
+        struct linearbuffers_allocator allocator;
+        struct {
+                uint64_t watermark;
+                int adaptive;
+                uint64_t average;
+        } memory;
+        uint64_t alignment;
+        struct {
+                uint64_t prefix_size;
+                int (*prefix_emitter) (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value);
+        } string;
 };
 
 static int linearbuffers_encoder_default_emitter (void *context, uint64_t offset, const void *buffer, int64_t length)
 {
         struct linearbuffers_encoder *encoder = context;
         linearbuffers_debugf("emitter offset: %08" PRIu64 ", buffer: %11p, length: %08" PRIi64 "", offset, buffer, length);
-        if (length < 0) {
-                encoder->output.length = offset + length;
-                return 0;
-        }
-        if (encoder->output.size < offset + length) {
-                void *tmp;
-                uint64_t size;
-                size = (((offset + length) + 4095) / 4096) * 4096;
-                tmp = realloc(encoder->output.buffer, size);
-                if (tmp == NULL) {
-                        tmp = malloc(size);
-                        if (tmp == NULL) {
-                                linearbuffers_errorf("can not allocate memory");
-                                goto bail;
-                        }
-                        memcpy(tmp, encoder->output.buffer, encoder->output.length);
-                        encoder->output.buffer = tmp;
-                        free(tmp);
-                } else {
-                        encoder->output.buffer = tmp;
-                }
-                encoder->output.size = size;
-        }
-        if (buffer == NULL) {
-                memset(encoder->output.buffer + offset, 0, length);
-        } else {
-                memcpy(encoder->output.buffer + offset, buffer, length);
-        }
-        encoder->output.length = MAX(encoder->output.length, offset + length);
-        return 0;
-bail:   return -1;
+        return linearbuffers_output_write(&encoder->output, offset, buffer, length);
 }
 
-static int linearbuffers_encoder_uint8_emitter (int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t offset, uint64_t value)
+static inline int linearbuffers_encoder_emit (struct linearbuffers_encoder *encoder, uint64_t offset, const void *buffer, int64_t length)
 {
-        uint8_t uint8;
-        uint8 = value;
-        return function(context, offset, &uint8, sizeof(uint8));
+        struct linearbuffers_output_chunk *chunk;
+        if (encoder->emitter.direct) {
+                chunk = encoder->output.cchunk;
+                if (chunk != NULL &&
+                    length >= 0 &&
+                    offset >= chunk->offset &&
+                    offset + length <= chunk->offset + chunk->size) {
+                        if (buffer == NULL) {
+                                memset(chunk->buffer + (offset - chunk->offset), 0, length);
+                        } else {
+                                memcpy(chunk->buffer + (offset - chunk->offset), buffer, length);
+                        }
+                        encoder->output.length = MAX(encoder->output.length, offset + length);
+                        return 0;
+                }
+        }
+        return encoder->emitter.function(encoder->emitter.context, offset, buffer, length);
 }
 
-static int linearbuffers_encoder_uint16_emitter (int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t offset, uint64_t value)
+static inline uint64_t linearbuffers_encoder_aligned (uint64_t offset, uint64_t alignment)
 {
-        uint16_t uint16;
-        uint16 = value;
-        return function(context, offset, &uint16, sizeof(uint16));
+        return (offset + alignment - 1) & ~(alignment - 1);
 }
 
-static int linearbuffers_encoder_uint32_emitter (int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t offset, uint64_t value)
+static inline int linearbuffers_encoder_alignment_check (struct linearbuffers_encoder *encoder, uint64_t alignment)
 {
-        uint32_t uint32;
-        uint32 = value;
-        return function(context, offset, &uint32, sizeof(uint32));
+        if (encoder->emitter.direct &&
+            alignment > encoder->output.alignment) {
+                linearbuffers_errorf("alignment is not achievable: %" PRIu64 ", output buffer allows: %" PRIu64 "", alignment, encoder->output.alignment);
+                return -1;
+        }
+        return 0;
 }
 
-static int linearbuffers_encoder_uint64_emitter (int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t offset, uint64_t value)
+static int linearbuffers_encoder_pad (struct linearbuffers_encoder *encoder, uint64_t alignment)
 {
-        return function(context, offset, &value, sizeof(value));
-}
-
-#define linearbuffers_offset_table_push_type(__type__) \
-        static int linearbuffers_offset_table_push_ ## __type__  (struct linearbuffers_offset_table *offset, uint64_t value, struct linearbuffers_pool *pool) \
+        int rc;
+        uint64_t offset;
+        rc = linearbuffers_encoder_alignment_check(encoder, alignment);
+        if (rc != 0) {
+                return -1;
+        }
+        offset = linearbuffers_encoder_aligned(encoder->emitter.offset, alignment);
+        if (offset == encoder->emitter.offset) {
+                return 0;
+        }
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, NULL, offset - encoder->emitter.offset);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit padding");
+                return -1;
+        }
+        encoder->emitter.offset = offset;
+        return 0;
+}
+
+static int linearbuffers_encoder_payload_align (struct linearbuffers_encoder *encoder, uint64_t count_size, uint64_t alignment)
+{
+        int rc;
+        uint64_t offset;
+        rc = linearbuffers_encoder_alignment_check(encoder, alignment);
+        if (rc != 0) {
+                return -1;
+        }
+        offset = linearbuffers_encoder_aligned(encoder->emitter.offset + count_size, alignment) - count_size;
+        if (offset == encoder->emitter.offset) {
+                return 0;
+        }
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, NULL, offset - encoder->emitter.offset);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit padding");
+                return -1;
+        }
+        encoder->emitter.offset = offset;
+        return 0;
+}
+
+static int linearbuffers_encoder_vector_align (struct linearbuffers_encoder *encoder, uint64_t count_size, uint64_t alignment, uint64_t *header)
+{
+        int rc;
+        *header = count_size;
+        if (encoder->alignment == 0) {
+                return 0;
+        }
+        rc = linearbuffers_encoder_pad(encoder, MAX(alignment, count_size));
+        if (rc != 0) {
+                linearbuffers_errorf("can not align vector");
+                return -1;
+        }
+        *header = linearbuffers_encoder_aligned(count_size, alignment);
+        return 0;
+}
+
+static int linearbuffers_encoder_uint8_emitter (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value)
+{
+        uint8_t uint8;
+        if (value > UINT8_MAX) {
+                linearbuffers_errorf("value is out of range: %" PRIu64 ", type: uint8", value);
+                return -1;
+        }
+        uint8 = value;
+        return linearbuffers_encoder_emit(encoder, offset, &uint8, sizeof(uint8));
+}
+
+static int linearbuffers_encoder_uint16_emitter (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value)
+{
+        uint16_t uint16;
+        if (value > UINT16_MAX) {
+                linearbuffers_errorf("value is out of range: %" PRIu64 ", type: uint16", value);
+                return -1;
+        }
+        uint16 = value;
+        return linearbuffers_encoder_emit(encoder, offset, &uint16, sizeof(uint16));
+}
+
+static int linearbuffers_encoder_uint32_emitter (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value)
+{
+        uint32_t uint32;
+        if (value > UINT32_MAX) {
+                linearbuffers_errorf("value is out of range: %" PRIu64 ", type: uint32", value);
+                return -1;
+        }
+        uint32 = value;
+        return linearbuffers_encoder_emit(encoder, offset, &uint32, sizeof(uint32));
+}
+
+static int linearbuffers_encoder_uint64_emitter (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value)
+{
+        return linearbuffers_encoder_emit(encoder, offset, &value, sizeof(value));
+}
+
+#if defined(__AVX2__)
+#define linearbuffers_offset_table_relocate_simd(__type__, __set1__) \
+        { \
+                __m256i v; \
+                __m256i d = _mm256_ ## __set1__(diff); \
+                for (; i + sizeof(__m256i) / sizeof(uint ## __type__ ## _t) <= count; i += sizeof(__m256i) / sizeof(uint ## __type__ ## _t)) { \
+                        v = _mm256_loadu_si256((const __m256i *) (buffer + i)); \
+                        _mm256_storeu_si256((__m256i *) (buffer + i), _mm256_sub_epi ## __type__(v, d)); \
+                } \
+        }
+#elif defined(__SSE2__)
+#define linearbuffers_offset_table_relocate_simd(__type__, __set1__) \
         { \
-                if (offset->count + 1 > LINEARBUFFERS_OFFSET_BUFFER_ ## __type__ ## _COUNT || \
-                    offset->cbuffer == NULL) { \
-                        struct linearbuffers_offset_buffer *buffer; \
-                        buffer = linearbuffers_pool_malloc(pool); \
-                        if (buffer == NULL) { \
-                                linearbuffers_errorf("can not allocate memory"); \
+                __m128i v; \
+                __m128i d = _mm_ ## __set1__(diff); \
+                for (; i + sizeof(__m128i) / sizeof(uint ## __type__ ## _t) <= count; i += sizeof(__m128i) / sizeof(uint ## __type__ ## _t)) { \
+                        v = _mm_loadu_si128((const __m128i *) (buffer + i)); \
+                        _mm_storeu_si128((__m128i *) (buffer + i), _mm_sub_epi ## __type__(v, d)); \
+                } \
+        }
+#else
+#define linearbuffers_offset_table_relocate_simd(__type__, __set1__)
+#endif
+
+#define linearbuffers_offset_table_push_type(__type__, __set1__) \
+        static int linearbuffers_offset_table_push_ ## __type__  (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, uint64_t value) \
+        { \
+                int rc; \
+                uint64_t length; \
+                length = table->offset + (table->count + 1) * sizeof(uint ## __type__ ## _t); \
+                if (__builtin_expect(length > scratch->size, 0)) { \
+                        rc = linearbuffers_scratch_reserve(scratch, length); \
+                        if (rc != 0) { \
+                                linearbuffers_errorf("can not reserve scratch"); \
                                 goto bail; \
                         } \
-                        memset(buffer, 0, sizeof(struct linearbuffers_offset_buffer)); \
-                        if (offset->cbuffer == NULL) { \
-                                offset->buffers = buffer; \
-                        } else { \
-                                offset->cbuffer->next = buffer; \
-                        } \
-                        offset->cbuffer = buffer; \
-                        offset->count = 0; \
                 } \
-                offset->cbuffer->u._ ## __type__[offset->count] = value; \
-                offset->count += 1; \
+                ((uint ## __type__ ## _t *) (scratch->buffer + table->offset))[table->count] = value; \
+                scratch->length = length; \
+                table->count += 1; \
                 return 0; \
         bail:   return -1; \
         } \
         \
-        static int linearbuffers_offset_table_emit_ ## __type__ (struct linearbuffers_offset_table *table, int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t *offset, uint64_t diff) \
+        static void linearbuffers_offset_table_relocate_ ## __type__ (uint ## __type__ ## _t *buffer, uint64_t count, uint64_t diff) \
         { \
-                int rc; \
                 uint64_t i; \
-                uint64_t c; \
-                uint64_t o; \
-                struct linearbuffers_offset_buffer *buffer; \
-                struct linearbuffers_offset_buffer *nbuffer; \
-                o = *offset; \
-                for (buffer = table->buffers; \
-                     buffer && (nbuffer = buffer->next, 1); \
-                     buffer = buffer->next) { \
-                        c = (nbuffer == NULL) ? table->count : LINEARBUFFERS_OFFSET_BUFFER_ ## __type__ ## _COUNT; \
-                        for (i = 0; i < c; i++) { \
-                                buffer->u._ ## __type__ [i] -= (uint ## __type__ ## _t) diff; \
-                        } \
-                        rc = function(context, o, buffer->u._ ## __type__, c * sizeof(uint ## __type__ ## _t)); \
-                        if (rc != 0) { \
-                                return -1; \
-                        } \
-                        o += c * sizeof(uint ## __type__ ## _t); \
+                i = 0; \
+                linearbuffers_offset_table_relocate_simd(__type__, __set1__) \
+                for (; i < count; i++) { \
+                        buffer[i] -= (uint ## __type__ ## _t) diff; \
+                } \
+        } \
+        \
+        static int linearbuffers_offset_table_emit_ ## __type__ (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t diff) \
+        { \
+                int rc; \
+                uint ## __type__ ## _t *buffer; \
+                if (table->count == 0) { \
+                        return 0; \
+                } \
+                buffer = (uint ## __type__ ## _t *) (scratch->buffer + table->offset); \
+                linearbuffers_offset_table_relocate_ ## __type__ (buffer, table->count, diff); \
+                rc = linearbuffers_encoder_emit(encoder, *offset, buffer, table->count * sizeof(uint ## __type__ ## _t)); \
+                if (rc != 0) { \
+                        return -1; \
                 } \
-                *offset = o; \
+                *offset += table->count * sizeof(uint ## __type__ ## _t); \
                 return 0; \
         }
 
-linearbuffers_offset_table_push_type(64)
-linearbuffers_offset_table_push_type(32)
-linearbuffers_offset_table_push_type(16)
-linearbuffers_offset_table_push_type(8)
+linearbuffers_offset_table_push_type(64, set1_epi64x)
+linearbuffers_offset_table_push_type(32, set1_epi32)
+linearbuffers_offset_table_push_type(16, set1_epi16)
+linearbuffers_offset_table_push_type(8, set1_epi8)
 
 static const struct {
         const char *name;
         uint64_t value;
         uint64_t size;
-        int (*emitter) (int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t offset, uint64_t value);
+        int (*emitter) (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value);
 } linearbuffers_encoder_count_types[] = {
         [linearbuffers_encoder_count_type_uint8]   = { "uint8" , linearbuffers_encoder_count_type_uint8 , sizeof(uint8_t) , linearbuffers_encoder_uint8_emitter  },
         [linearbuffers_encoder_count_type_uint16]  = { "uint16", linearbuffers_encoder_count_type_uint16, sizeof(uint16_t), linearbuffers_encoder_uint16_emitter },
@@ -354,9 +997,9 @@ static const struct {
         const char *name;
         uint64_t value;
         uint64_t size;
-        int (*emitter) (int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t offset, uint64_t value);
-        int (*offset_table_push) (struct linearbuffers_offset_table *offset, uint64_t value, struct linearbuffers_pool *linearbuffers_pool);
-        int (*offset_table_emit) (struct linearbuffers_offset_table *table, int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t *offset, uint64_t diff);
+        int (*emitter) (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value);
+        int (*offset_table_push) (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, uint64_t value);
+        int (*offset_table_emit) (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t diff);
 } linearbuffers_encoder_offset_types[] = {
         [linearbuffers_encoder_offset_type_uint8]   = { "uint8" , linearbuffers_encoder_offset_type_uint8 , sizeof(uint8_t) , linearbuffers_encoder_uint8_emitter , linearbuffers_offset_table_push_8 , linearbuffers_offset_table_emit_8  },
         [linearbuffers_encoder_offset_type_uint16]  = { "uint16", linearbuffers_encoder_offset_type_uint16, sizeof(uint16_t), linearbuffers_encoder_uint16_emitter, linearbuffers_offset_table_push_16, linearbuffers_offset_table_emit_16 },
@@ -364,545 +1007,1638 @@ static const struct {
         [linearbuffers_encoder_offset_type_uint64]  = { "uint64", linearbuffers_encoder_offset_type_uint64, sizeof(uint64_t), linearbuffers_encoder_uint64_emitter, linearbuffers_offset_table_push_64, linearbuffers_offset_table_emit_64 },
 };
 
-static int linearbuffers_offset_table_push (struct linearbuffers_offset_table *table, uint64_t value, struct linearbuffers_pool *pool)
+static int linearbuffers_encoder_span_reserve (struct linearbuffers_encoder *encoder, uint64_t count_size, int (*count_emitter) (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t value), uint64_t length, void **buffer)
+{
+        int rc;
+        if (encoder->reserve.buffer != NULL) {
+                linearbuffers_errorf("logic error: reserve is pending");
+                goto bail;
+        }
+        if (encoder->emitter.direct) {
+                encoder->reserve.buffer = linearbuffers_output_reserve(&encoder->output, encoder->emitter.offset + count_size, length);
+                if (encoder->reserve.buffer == NULL) {
+                        linearbuffers_errorf("can not reserve output");
+                        goto bail;
+                }
+        } else {
+                rc = linearbuffers_scratch_push(&encoder->scratch, length, &encoder->reserve.scratch);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not reserve scratch");
+                        goto bail;
+                }
+                encoder->reserve.buffer = encoder->scratch.buffer + encoder->reserve.scratch;
+        }
+        encoder->reserve.offset = encoder->emitter.offset;
+        encoder->reserve.length = length;
+        encoder->reserve.count_size = count_size;
+        encoder->reserve.count_emitter = count_emitter;
+        *buffer = encoder->reserve.buffer;
+        return 0;
+bail:   return -1;
+}
+
+static int linearbuffers_encoder_span_commit (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count, uint64_t length)
+{
+        int rc;
+        if (encoder->reserve.buffer == NULL) {
+                linearbuffers_errorf("logic error: reserve is not pending");
+                goto bail;
+        }
+        if (length > encoder->reserve.length) {
+                linearbuffers_errorf("length is invalid");
+                goto bail;
+        }
+        if (encoder->reserve.count_emitter != NULL) {
+                rc = encoder->reserve.count_emitter(encoder, encoder->reserve.offset, count);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not emit count");
+                        goto bail;
+                }
+        }
+        if (encoder->emitter.direct) {
+                encoder->output.length = MAX(encoder->output.length, encoder->reserve.offset + encoder->reserve.count_size + length);
+        } else {
+                rc = linearbuffers_encoder_emit(encoder, encoder->reserve.offset + encoder->reserve.count_size, encoder->reserve.buffer, length);
+                linearbuffers_scratch_pop(&encoder->scratch, encoder->reserve.scratch);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not emit reserved buffer");
+                        goto bail;
+                }
+        }
+        *offset = encoder->reserve.offset;
+        encoder->emitter.offset = encoder->reserve.offset + encoder->reserve.count_size + length;
+        memset(&encoder->reserve, 0, sizeof(encoder->reserve));
+        return 0;
+bail:   memset(&encoder->reserve, 0, sizeof(encoder->reserve));
+        return -1;
+}
+
+static inline int linearbuffers_encoder_string_prefix_reserve (struct linearbuffers_encoder *encoder)
+{
+        int rc;
+        if (encoder->string.prefix_size == 0) {
+                return 0;
+        }
+        if (encoder->alignment != 0) {
+                rc = linearbuffers_encoder_pad(encoder, encoder->string.prefix_size);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not align string");
+                        return -1;
+                }
+        }
+        encoder->emitter.offset += encoder->string.prefix_size;
+        return 0;
+}
+
+static inline int linearbuffers_encoder_string_prefix_emit (struct linearbuffers_encoder *encoder, uint64_t offset, uint64_t length)
 {
-        return table->push(table, value, pool);
+        if (encoder->string.prefix_size == 0) {
+                return 0;
+        }
+        return encoder->string.prefix_emitter(encoder, offset - encoder->string.prefix_size, length);
+}
+
+static inline int linearbuffers_offset_table_push (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, uint64_t value)
+{
+        return table->push(scratch, table, value);
 }
 
-static uint64_t linearbuffers_offset_table_emit (struct linearbuffers_offset_table *table, int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length), void *context, uint64_t *offset, uint64_t diff)
+static int linearbuffers_offset_table_emit (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t diff)
 {
-        return table->emit(table, function, context, offset, diff);
+        return table->emit(scratch, table, encoder, offset, diff);
 }
 
-static void linearbuffers_offset_table_uninit (struct linearbuffers_pool *pool, struct linearbuffers_offset_table *table)
+static void linearbuffers_offset_table_uninit (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table)
 {
-        struct linearbuffers_offset_buffer *buffer;
-        struct linearbuffers_offset_buffer *nbuffer;
-        for (buffer = table->buffers; buffer && ((nbuffer = buffer->next), 1); buffer = nbuffer) {
-                linearbuffers_pool_free(pool, buffer);
+        if (table->push != NULL) {
+                linearbuffers_scratch_pop(scratch, table->offset);
         }
         memset(table, 0, sizeof(struct linearbuffers_offset_table));
 }
 
-static int linearbuffers_offset_table_init (struct linearbuffers_pool *pool, struct linearbuffers_offset_table *table, enum linearbuffers_encoder_offset_type type)
+static int linearbuffers_offset_table_init (struct linearbuffers_scratch *scratch, struct linearbuffers_offset_table *table, enum linearbuffers_encoder_offset_type type)
 {
-        (void) pool;
+        int rc;
         memset(table, 0, sizeof(struct linearbuffers_offset_table));
+        rc = linearbuffers_scratch_push(scratch, 0, &table->offset);
+        if (rc != 0) {
+                linearbuffers_errorf("can not push scratch");
+                goto bail;
+        }
         table->push = linearbuffers_encoder_offset_types[type].offset_table_push;
         table->emit = linearbuffers_encoder_offset_types[type].offset_table_emit;
         return 0;
+bail:   return -1;
 }
 
-static int linearbuffers_present_table_mark (struct linearbuffers_present_table *table, uint64_t element)
+static inline uint8_t * linearbuffers_table_buffer_get (struct linearbuffers_scratch *scratch, struct linearbuffers_table_buffer *table)
 {
-        uint64_t byte;
-        uint64_t buffer;
-        struct linearbuffers_present_buffer *present_buffer;
-        byte = element / 8;
-        buffer = byte / LINEARBUFFERS_PRESENT_BUFFER_COUNT;
-        present_buffer = table->buffers;
-        while (buffer--) {
-                present_buffer = present_buffer->next;
+        if (table->size <= LINEARBUFFERS_TABLE_INLINE_SIZE) {
+                return table->buffer;
         }
-        present_buffer->buffer[byte % LINEARBUFFERS_PRESENT_BUFFER_COUNT] |= (1 << (element % 8));
-        return 0;
+        return scratch->buffer + table->offset;
 }
 
-static void linearbuffers_present_table_uninit (struct linearbuffers_pool *pool, struct linearbuffers_present_table *table)
+static void linearbuffers_table_buffer_uninit (struct linearbuffers_scratch *scratch, struct linearbuffers_table_buffer *table)
 {
-        struct linearbuffers_present_buffer *buffer;
-        struct linearbuffers_present_buffer *nbuffer;
-        for (buffer = table->buffers; buffer && ((nbuffer = buffer->next), 1); buffer = nbuffer) {
-                linearbuffers_pool_free(pool, buffer);
+        if (table->size > LINEARBUFFERS_TABLE_INLINE_SIZE) {
+                linearbuffers_scratch_pop(scratch, table->offset);
         }
-        memset(table, 0, sizeof(struct linearbuffers_present_table));
+        memset(table, 0, sizeof(struct linearbuffers_table_buffer));
 }
 
-static int linearbuffers_present_table_init (struct linearbuffers_pool *pool, struct linearbuffers_present_table *table, uint64_t elements)
+static int linearbuffers_table_buffer_init (struct linearbuffers_scratch *scratch, struct linearbuffers_table_buffer *table, uint64_t size)
 {
-        uint64_t buffers;
-        struct linearbuffers_present_buffer *present_buffer;
-        struct linearbuffers_present_buffer *present_buffers;
-        memset(table, 0, sizeof(struct linearbuffers_present_table));
-        table->bytes = sizeof(uint8_t) * ((elements + 7) / 8);
-        buffers = (table->bytes + LINEARBUFFERS_PRESENT_BUFFER_COUNT - 1) / LINEARBUFFERS_PRESENT_BUFFER_COUNT;
-        while (buffers--) {
-                present_buffer = linearbuffers_pool_malloc(pool);
-                if (present_buffer == NULL) {
-                        linearbuffers_errorf("can not allocate memory");
+        int rc;
+        memset(table, 0, sizeof(struct linearbuffers_table_buffer));
+        table->size = size;
+        if (table->size > LINEARBUFFERS_TABLE_INLINE_SIZE) {
+                rc = linearbuffers_scratch_push(scratch, table->size, &table->offset);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not push scratch");
                         goto bail;
                 }
-                memset(present_buffer->buffer, 0, LINEARBUFFERS_PRESENT_BUFFER_COUNT);
-                present_buffers = table->buffers;
-                table->buffers = present_buffer;
-                table->buffers->next = present_buffers;
+                memset(scratch->buffer + table->offset, 0, table->size);
         }
         return 0;
-bail:   linearbuffers_present_table_uninit(pool, table);
+bail:   table->size = 0;
         return -1;
 }
 
-static void linearbuffers_entry_destroy (struct linearbuffers_pool *epool, struct linearbuffers_pool *ppool, struct linearbuffers_pool *opool, struct linearbuffers_entry *entry)
+static inline int linearbuffers_table_buffer_store (uint8_t *buffer, uint64_t size, uint64_t value)
+{
+        uint8_t uint8;
+        uint16_t uint16;
+        uint32_t uint32;
+        if (size < sizeof(uint64_t) &&
+            value > (UINT64_C(1) << (size * 8)) - 1) {
+                linearbuffers_errorf("value is out of range: %" PRIu64 ", size: %" PRIu64 "", value, size);
+                return -1;
+        }
+        switch (size) {
+                case sizeof(uint8_t):
+                        uint8 = value;
+                        memcpy(buffer, &uint8, sizeof(uint8));
+                        break;
+                case sizeof(uint16_t):
+                        uint16 = value;
+                        memcpy(buffer, &uint16, sizeof(uint16));
+                        break;
+                case sizeof(uint32_t):
+                        uint32 = value;
+                        memcpy(buffer, &uint32, sizeof(uint32));
+                        break;
+                default:
+                        memcpy(buffer, &value, sizeof(value));
+                        break;
+        }
+        return 0;
+}
+
+static void linearbuffers_entry_destroy (struct linearbuffers_encoder *encoder, struct linearbuffers_entry *entry)
 {
         if (entry == NULL) {
                 return;
         }
         if (entry->type == linearbuffers_entry_type_table) {
-                linearbuffers_present_table_uninit(ppool, &entry->u.table.present);
+                linearbuffers_table_buffer_uninit(&encoder->scratch, &entry->u.table.buffer);
         } else if (entry->type == linearbuffers_entry_type_vector) {
-                linearbuffers_offset_table_uninit(opool, &entry->u.vector.offset);
+                linearbuffers_offset_table_uninit(&encoder->scratch, &entry->u.vector.offset);
+        }
+        if (encoder->scratch.fixed) {
+                linearbuffers_scratch_pop(&encoder->scratch, ((uint8_t *) entry) - encoder->scratch.buffer);
+        } else {
+                linearbuffers_pool_free(&encoder->pool.entry, entry);
         }
-        linearbuffers_pool_free(epool, entry);
 }
 
-__attribute__ ((__visibility__("default"))) const void * linearbuffers_encoder_linearized (struct linearbuffers_encoder *encoder, uint64_t *length)
+static struct linearbuffers_entry * linearbuffers_entry_create (struct linearbuffers_encoder *encoder)
 {
-        if (encoder == NULL) {
-                linearbuffers_debugf("encoder is invalid");
-                return NULL;
-        }
-        if (length != NULL) {
-                *length = encoder->output.length;
+        int rc;
+        uint64_t offset;
+        if (encoder->scratch.fixed) {
+                rc = linearbuffers_scratch_push(&encoder->scratch, sizeof(struct linearbuffers_entry), &offset);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not push scratch");
+                        return NULL;
+                }
+                return (struct linearbuffers_entry *) (encoder->scratch.buffer + offset);
         }
-        return encoder->output.buffer;
+        return linearbuffers_pool_malloc(&encoder->pool.entry);
 }
 
-__attribute__ ((__visibility__("default"))) struct linearbuffers_encoder * linearbuffers_encoder_create (struct linearbuffers_encoder_create_options *options)
+static inline void linearbuffers_entry_push (struct linearbuffers_encoder *encoder, struct linearbuffers_entry *entry)
 {
-        struct linearbuffers_encoder *encoder;
-        encoder = NULL;
-        encoder = malloc(sizeof(struct linearbuffers_encoder));
-        if (encoder == NULL) {
-                linearbuffers_errorf("can not allocate memory");
-                goto bail;
-        }
-        memset(encoder, 0, sizeof(struct linearbuffers_encoder));
-        TAILQ_INIT(&encoder->entries);
-        linearbuffers_pool_init(&encoder->pool.entry, "entry", sizeof(struct linearbuffers_entry), 8);
-        linearbuffers_pool_init(&encoder->pool.present, "present", sizeof(struct linearbuffers_present_buffer), 8);
-        linearbuffers_pool_init(&encoder->pool.offset, "offset", sizeof(struct linearbuffers_offset_buffer), 8);
-        encoder->emitter.function = linearbuffers_encoder_default_emitter;
-        encoder->emitter.context = encoder;
-        if (options != NULL) {
-                if (options->emitter.function != NULL) {
-                        encoder->emitter.function = options->emitter.function;
-                        encoder->emitter.context = options->emitter.context;
-                }
-        }
-        return encoder;
-bail:   if (encoder != NULL) {
-                linearbuffers_encoder_destroy(encoder);
+        TAILQ_INSERT_TAIL(&encoder->entries, entry, entries);
+        encoder->current = entry;
+}
+
+static inline void linearbuffers_entry_remove (struct linearbuffers_encoder *encoder, struct linearbuffers_entry *entry)
+{
+        TAILQ_REMOVE(&encoder->entries, entry, entries);
+        encoder->current = TAILQ_LAST(&encoder->entries, linearbuffers_entries);
+}
+
+static inline void linearbuffers_entry_fail (struct linearbuffers_encoder *encoder)
+{
+        /* a failed start leaves no current entry, calls meant for it must
+         * fail instead of landing in the parent. */
+        if (encoder != NULL) {
+                encoder->current = NULL;
         }
-        return NULL;
 }
 
-__attribute__ ((__visibility__("default"))) void linearbuffers_encoder_destroy (struct linearbuffers_encoder *encoder)
+__attribute__ ((__visibility__("default"))) const void * linearbuffers_encoder_linearized (struct linearbuffers_encoder *encoder, uint64_t *length)
 {
-        struct linearbuffers_entry *entry;
-        struct linearbuffers_entry *nentry;
         if (encoder == NULL) {
-                return;
-        }
-        TAILQ_FOREACH_REVERSE_SAFE(entry, &encoder->entries, linearbuffers_entries, entries, nentry) {
-                TAILQ_REMOVE(&encoder->entries, entry, entries);
-                linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry);
+                linearbuffers_debugf("encoder is invalid");
+                return NULL;
         }
-        if (encoder->output.buffer != NULL) {
-                free(encoder->output.buffer);
+        if (length != NULL) {
+                *length = encoder->output.length;
         }
-        linearbuffers_pool_uninit(&encoder->pool.entry);
-        linearbuffers_pool_uninit(&encoder->pool.present);
-        linearbuffers_pool_uninit(&encoder->pool.offset);
-        free(encoder);
+        return linearbuffers_output_linearize(&encoder->output);
 }
 
-__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_reset (struct linearbuffers_encoder *encoder, struct linearbuffers_encoder_reset_options *options)
+__attribute__ ((__visibility__("default"))) int64_t linearbuffers_encoder_iovec (struct linearbuffers_encoder *encoder, struct linearbuffers_encoder_iovec *iovec, uint64_t count)
 {
-        struct linearbuffers_entry *entry;
-        struct linearbuffers_entry *nentry;
         if (encoder == NULL) {
                 linearbuffers_errorf("encoder is invalid");
-                goto bail;
-        }
-        TAILQ_FOREACH_REVERSE_SAFE(entry, &encoder->entries, linearbuffers_entries, entries, nentry) {
-                TAILQ_REMOVE(&encoder->entries, entry, entries);
-                linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry);
-        }
-        encoder->emitter.offset = 0;
-        encoder->emitter.function = linearbuffers_encoder_default_emitter;
-        encoder->emitter.context = encoder;
-        encoder->output.length = 0;
-        if (options != NULL) {
-                if (options->emitter.function != NULL) {
-                        encoder->emitter.function = options->emitter.function;
-                        encoder->emitter.context = options->emitter.context;
-                }
+                return -1;
         }
-        return 0;
-bail:   return -1;
+        return linearbuffers_output_iovec(&encoder->output, iovec, count);
 }
 
-__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_start (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size)
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_detach (struct linearbuffers_encoder *encoder, void **buffer, uint64_t *length)
 {
-        int rc;
-        struct linearbuffers_entry *entry;
-        entry = NULL;
+        struct linearbuffers_output_chunk *chunk;
         if (encoder == NULL) {
                 linearbuffers_errorf("encoder is invalid");
                 goto bail;
         }
-        entry = linearbuffers_pool_malloc(&encoder->pool.entry);
-        if (entry == NULL) {
-                linearbuffers_errorf("can not allocate memory");
+        if (buffer == NULL) {
+                linearbuffers_errorf("buffer is invalid");
                 goto bail;
         }
-        memset(entry, 0, sizeof(struct linearbuffers_entry));
-        entry->type = linearbuffers_entry_type_table;
-        entry->count_size = linearbuffers_encoder_count_types[count_type].size;
-        entry->count_emitter = linearbuffers_encoder_count_types[count_type].emitter;
-        entry->offset_size = linearbuffers_encoder_offset_types[offset_type].size;
-        entry->offset_emitter = linearbuffers_encoder_offset_types[offset_type].emitter;
-        entry->u.table.elements = elements;
-        entry->offset = encoder->emitter.offset;
-        rc = linearbuffers_present_table_init(&encoder->pool.present, &entry->u.table.present, elements);
-        if (rc != 0) {
-                linearbuffers_errorf("can not init table present");
+        if (encoder->emitter.direct == 0 ||
+            encoder->output.fixed) {
+                linearbuffers_errorf("output is not owned by encoder");
                 goto bail;
         }
-        linearbuffers_debugf("creating table, size: (count_size: %" PRIi64 " + present_bytes: %" PRIi64 " + size:  %" PRIi64 ") = %" PRIi64 "", entry->count_size, entry->u.table.present.bytes, size, entry->count_size + entry->u.table.present.bytes + size);
-        rc = encoder->emitter.function(encoder->emitter.context, entry->offset, NULL, entry->count_size + entry->u.table.present.bytes + size);
-        if (rc != 0) {
-                linearbuffers_errorf("can not emit table space");
+        if (!TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is not empty");
                 goto bail;
         }
-        encoder->emitter.offset += entry->count_size + entry->u.table.present.bytes + size;
-        TAILQ_INSERT_TAIL(&encoder->entries, entry, entries);
-        return 0;
-bail:   if (entry != NULL) {
-                linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry);
+        if (encoder->output.length == 0) {
+                linearbuffers_errorf("output is empty");
+                goto bail;
         }
-        return -1;
+        if (linearbuffers_output_linearize(&encoder->output) == NULL) {
+                linearbuffers_errorf("can not linearize output");
+                goto bail;
+        }
+        chunk = encoder->output.chunks;
+        if (chunk->buffer != chunk->base) {
+                /* aligned within an over allocation, hand out what the
+                 * allocator returned */
+                memmove(chunk->base, chunk->buffer, encoder->output.length);
+                chunk->buffer = chunk->base;
+        }
+        *buffer = chunk->buffer;
+        if (length != NULL) {
+                *length = encoder->output.length;
+        }
+        encoder->output.chunks = chunk->next;
+        encoder->output.nchunks -= 1;
+        if (encoder->output.chunks == NULL) {
+                encoder->output.tchunk = NULL;
+        }
+        chunk->buffer = NULL;
+        chunk->base = NULL;
+        linearbuffers_output_chunk_destroy(encoder->output.allocator, chunk);
+        return linearbuffers_encoder_reset(encoder, NULL);
+bail:   return -1;
 }
 
-__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_end (struct linearbuffers_encoder *encoder, uint64_t *offset)
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_attach (struct linearbuffers_encoder *encoder, void *buffer, uint64_t size)
 {
-        int rc;
-        struct linearbuffers_entry *entry;
-        uint64_t present_bytes;
-        uint64_t present_bufferi;
-        struct linearbuffers_present_buffer *present_buffer;
+        struct linearbuffers_output_chunk *chunk;
         if (encoder == NULL) {
                 linearbuffers_errorf("encoder is invalid");
                 goto bail;
         }
-        if (TAILQ_EMPTY(&encoder->entries)) {
-                linearbuffers_errorf("logic error: entries is empty");
+        if (buffer == NULL) {
+                linearbuffers_errorf("buffer is invalid");
                 goto bail;
         }
-        entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries);
-        if (entry == NULL) {
-                linearbuffers_errorf("logic error: entry is invalid");
+        if (size == 0) {
+                linearbuffers_errorf("size is invalid");
                 goto bail;
         }
-        if (entry->type != linearbuffers_entry_type_table) {
-                linearbuffers_errorf("logic error: entry type is not table");
+        if (encoder->output.fixed) {
+                linearbuffers_errorf("output is not owned by encoder");
                 goto bail;
         }
-        if (offset != NULL) {
-                *offset = entry->offset;
-        }
-        rc = entry->count_emitter(encoder->emitter.function, encoder->emitter.context, entry->offset, entry->u.table.elements);
-        if (rc != 0) {
-                linearbuffers_errorf("can not emit table count");
+        chunk = linearbuffers_allocator_malloc(encoder->output.allocator, sizeof(struct linearbuffers_output_chunk));
+        if (chunk == NULL) {
+                linearbuffers_errorf("can not allocate memory");
                 goto bail;
         }
-        for (present_bufferi = 0 , present_bytes = entry->u.table.present.bytes, present_buffer = entry->u.table.present.buffers;
-             present_buffer;
-             present_bufferi += 1, present_bytes -= LINEARBUFFERS_PRESENT_BUFFER_COUNT       , present_buffer = present_buffer->next) {
-                rc = encoder->emitter.function(encoder->emitter.context, entry->offset + entry->count_size + present_bufferi * LINEARBUFFERS_PRESENT_BUFFER_COUNT, present_buffer->buffer, MIN(present_bytes, LINEARBUFFERS_PRESENT_BUFFER_COUNT));
-                if (rc != 0) {
-                        linearbuffers_errorf("can not emit table present");
-                        goto bail;
-                }
+        memset(chunk, 0, sizeof(struct linearbuffers_output_chunk));
+        chunk->offset = encoder->output.size;
+        chunk->size = size;
+        chunk->capacity = size;
+        chunk->buffer = buffer;
+        chunk->base = buffer;
+        /* aligned payloads can only be placed as far as the attached buffer
+         * and the offset of the chunk after it allow */
+        encoder->output.alignment = MIN(encoder->output.alignment, linearbuffers_output_phase_alignment((uintptr_t) buffer - chunk->offset));
+        encoder->output.alignment = MIN(encoder->output.alignment, linearbuffers_output_phase_alignment(chunk->offset + size));
+        if (encoder->output.tchunk == NULL) {
+                encoder->output.chunks = chunk;
+                encoder->output.cchunk = chunk;
+        } else {
+                encoder->output.tchunk->next = chunk;
         }
-        TAILQ_REMOVE(&encoder->entries, entry, entries);
-        linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry);
+        encoder->output.tchunk = chunk;
+        encoder->output.nchunks += 1;
+        encoder->output.size += size;
         return 0;
 bail:   return -1;
 }
 
-__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_cancel (struct linearbuffers_encoder *encoder)
+static int linearbuffers_encoder_allocator (struct linearbuffers_allocator *allocator, struct linearbuffers_encoder_create_options *options)
 {
-        int rc;
-        struct linearbuffers_entry *entry;
-        if (encoder == NULL) {
-                linearbuffers_errorf("encoder is invalid");
-                goto bail;
-        }
-        if (TAILQ_EMPTY(&encoder->entries)) {
-                linearbuffers_errorf("logic error: entries is empty");
-                goto bail;
-        }
-        entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries);
-        if (entry == NULL) {
-                linearbuffers_errorf("logic error: entry is invalid");
-                goto bail;
+        allocator->malloc = linearbuffers_allocator_default_malloc;
+        allocator->realloc = linearbuffers_allocator_default_realloc;
+        allocator->free = linearbuffers_allocator_default_free;
+        allocator->aligned_malloc = linearbuffers_allocator_default_aligned_malloc;
+        allocator->context = NULL;
+        if (options == NULL) {
+                return 0;
         }
-        if (entry->type != linearbuffers_entry_type_table) {
-                linearbuffers_errorf("logic error: entry is invalid");
-                goto bail;
+        if (options->allocator.malloc == NULL &&
+            options->allocator.realloc == NULL &&
+            options->allocator.free == NULL &&
+            options->allocator.aligned_malloc == NULL) {
+                return 0;
         }
-        rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset, NULL, entry->offset - encoder->emitter.offset);
-        if (rc != 0) {
-                linearbuffers_errorf("can not emit table cancel");
-                goto bail;
+        if (options->allocator.malloc == NULL ||
+            options->allocator.free == NULL) {
+                linearbuffers_errorf("allocator is invalid");
+                return -1;
         }
-        encoder->emitter.offset = entry->offset;
-        TAILQ_REMOVE(&encoder->entries, entry, entries);
-        linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry);
+        allocator->malloc = options->allocator.malloc;
+        allocator->realloc = options->allocator.realloc;
+        allocator->free = options->allocator.free;
+        allocator->aligned_malloc = options->allocator.aligned_malloc;
+        allocator->context = options->allocator.context;
         return 0;
-bail:   return -1;
 }
 
-#define linearbuffers_encoder_table_set_scalar_type(__type__, __type_t__) \
-        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_ ## __type__ (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, __type_t__ value) \
-        { \
-                int rc; \
-                struct linearbuffers_entry *parent; \
-                if (encoder == NULL) { \
-                        linearbuffers_errorf("encoder is invalid"); \
-                        goto bail; \
-                } \
-                if (TAILQ_EMPTY(&encoder->entries)) { \
-                        linearbuffers_errorf("logic error: entries is empty"); \
-                        goto bail; \
-                } \
-                parent = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
-                if (parent == NULL) { \
-                        linearbuffers_errorf("logic error: parent is invalid"); \
-                        goto bail; \
-                } \
-                if (parent->type != linearbuffers_entry_type_table) { \
-                        linearbuffers_errorf("logic error: parent is invalid"); \
-                        goto bail; \
-                } \
-                if (element >= parent->u.table.elements) { \
-                        linearbuffers_errorf("logic error: element is invalid"); \
-                        goto bail; \
-                } \
-                rc = encoder->emitter.function(encoder->emitter.context, parent->offset + parent->count_size + parent->u.table.present.bytes + offset, &value, sizeof(__type_t__)); \
-                if (rc != 0) { \
-                        linearbuffers_errorf("can not emit table element"); \
-                        goto bail; \
-                } \
-                rc = linearbuffers_present_table_mark(&parent->u.table.present, element); \
-                if (rc != 0) { \
-                        linearbuffers_errorf("can not mark table element"); \
-                        goto bail; \
-                } \
-                return 0; \
-        bail:   return -1; \
-        }
-
-linearbuffers_encoder_table_set_scalar_type(int8, int8_t);
-linearbuffers_encoder_table_set_scalar_type(int16, int16_t);
-linearbuffers_encoder_table_set_scalar_type(int32, int32_t);
-linearbuffers_encoder_table_set_scalar_type(int64, int64_t);
-
-linearbuffers_encoder_table_set_scalar_type(uint8, uint8_t);
-linearbuffers_encoder_table_set_scalar_type(uint16, uint16_t);
-linearbuffers_encoder_table_set_scalar_type(uint32, uint32_t);
-linearbuffers_encoder_table_set_scalar_type(uint64, uint64_t);
-
-linearbuffers_encoder_table_set_scalar_type(float, float);
-linearbuffers_encoder_table_set_scalar_type(double, double);
-
-#define linearbuffers_encoder_table_set_type(__type__) \
-        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_ ## __type__ (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value) \
-        { \
-                int rc; \
-                struct linearbuffers_entry *parent; \
-                if (encoder == NULL) { \
-                        linearbuffers_errorf("encoder is invalid"); \
-                        goto bail; \
-                } \
-                if (value <= 0) { \
-                        linearbuffers_errorf("value is invalid"); \
-                        goto bail; \
-                } \
-                if (TAILQ_EMPTY(&encoder->entries)) { \
-                        linearbuffers_errorf("logic error: entries is empty"); \
-                        goto bail; \
-                } \
-                parent = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
-                if (parent == NULL) { \
-                        linearbuffers_errorf("logic error: parent is invalid"); \
-                        goto bail; \
-                } \
-                if (parent->type != linearbuffers_entry_type_table) { \
-                        linearbuffers_errorf("logic error: parent is invalid"); \
-                        goto bail; \
-                } \
-                if (element >= parent->u.table.elements) { \
-                        linearbuffers_errorf("logic error: element is invalid"); \
-                        goto bail; \
-                } \
-                rc = parent->offset_emitter(encoder->emitter.function, encoder->emitter.context, parent->offset + parent->count_size + parent->u.table.present.bytes + offset, value - parent->offset); \
-                if (rc != 0) { \
-                        linearbuffers_errorf("can not emit table element offset"); \
-                        goto bail; \
-                } \
-                rc = linearbuffers_present_table_mark(&parent->u.table.present, element); \
-                if (rc != 0) { \
-                        linearbuffers_errorf("can not mark table element"); \
-                        goto bail; \
-                } \
-                return 0; \
-        bail:   return -1; \
-        }
-
-linearbuffers_encoder_table_set_type(string);
-linearbuffers_encoder_table_set_type(table);
-linearbuffers_encoder_table_set_type(vector);
-
-__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_create (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value)
+static void linearbuffers_encoder_trim (struct linearbuffers_encoder *encoder)
 {
-        int rc;
-        uint64_t length;
-        if (encoder == NULL) {
-                linearbuffers_errorf("encoder is invalid");
-                goto bail;
+        uint64_t pool;
+        uint64_t scratch;
+        uint64_t output;
+        if (encoder->memory.watermark == 0) {
+                return;
         }
-        if (offset == NULL) {
-                linearbuffers_errorf("offset is invalid");
-                goto bail;
+        pool = linearbuffers_pool_size(&encoder->pool.entry);
+        scratch = (encoder->scratch.fixed) ? 0 : encoder->scratch.size;
+        output = linearbuffers_output_capacity(&encoder->output);
+        if (pool + scratch + output <= encoder->memory.watermark) {
+                return;
         }
-        if (value == NULL) {
-                linearbuffers_errorf("value is invalid");
-                goto bail;
+        linearbuffers_debugf("trim pool: %" PRIu64 ", scratch: %" PRIu64 ", output: %" PRIu64 ", watermark: %" PRIu64 "", pool, scratch, output, encoder->memory.watermark);
+        linearbuffers_output_trim(&encoder->output, (pool + scratch < encoder->memory.watermark) ? encoder->memory.watermark - pool - scratch : 0);
+        if (pool + scratch > encoder->memory.watermark) {
+                linearbuffers_scratch_trim(&encoder->scratch);
         }
-        if (TAILQ_EMPTY(&encoder->entries)) {
-                linearbuffers_errorf("logic error: entries is empty");
-                goto bail;
+        if (pool > encoder->memory.watermark) {
+                linearbuffers_pool_trim(&encoder->pool.entry);
         }
-        *offset = encoder->emitter.offset;
-        length = strlen(value) + 1;
-        rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset, value, length);
+}
+
+static int linearbuffers_encoder_setup (struct linearbuffers_encoder *encoder, struct linearbuffers_encoder_create_options *options)
+{
+        int rc;
+        rc = linearbuffers_encoder_allocator(&encoder->allocator, options);
         if (rc != 0) {
-                linearbuffers_errorf("can not emit element");
+                linearbuffers_errorf("can not setup allocator");
                 goto bail;
         }
-        encoder->emitter.offset += length;
+        TAILQ_INIT(&encoder->entries);
+        linearbuffers_output_init(&encoder->output, &encoder->allocator);
+        linearbuffers_pool_init(&encoder->pool.entry, "entry", sizeof(struct linearbuffers_entry), 8, &encoder->allocator);
+        linearbuffers_scratch_init(&encoder->scratch, &encoder->allocator);
+        encoder->emitter.function = linearbuffers_encoder_default_emitter;
+        encoder->emitter.context = encoder;
+        encoder->emitter.direct = 1;
+        if (options != NULL) {
+                encoder->memory.watermark = options->memory.watermark;
+                encoder->memory.adaptive = options->memory.adaptive;
+                if (options->emitter.function != NULL) {
+                        encoder->emitter.function = options->emitter.function;
+                        encoder->emitter.context = options->emitter.context;
+                        encoder->emitter.direct = 0;
+                }
+                if (options->output.buffer != NULL) {
+                        rc = linearbuffers_output_init_fixed(&encoder->output, options->output.buffer, options->output.size);
+                        encoder->output.allocator = &encoder->allocator;
+                        if (rc != 0) {
+                                linearbuffers_errorf("can not init output");
+                                goto bail;
+                        }
+                }
+                if (options->arena.buffer != NULL) {
+                        rc = linearbuffers_scratch_init_fixed(&encoder->scratch, options->arena.buffer, options->arena.size);
+                        encoder->scratch.allocator = &encoder->allocator;
+                        if (rc != 0) {
+                                linearbuffers_errorf("can not init arena");
+                                goto bail;
+                        }
+                }
+        }
         return 0;
 bail:   return -1;
 }
 
-__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_createf (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value, ...)
+__attribute__ ((__visibility__("default"))) uint64_t linearbuffers_encoder_sizeof (void)
 {
-        int rc;
-        va_list ap;
-        va_start(ap, value);
-        rc = linearbuffers_encoder_string_createv(encoder, offset, value, ap);
-        va_end(ap);
-        return rc;
+        return sizeof(struct linearbuffers_encoder);
 }
 
-__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_createv (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value, va_list va)
+__attribute__ ((__visibility__("default"))) struct linearbuffers_encoder * linearbuffers_encoder_init (void *buffer, uint64_t size, struct linearbuffers_encoder_create_options *options)
 {
         int rc;
-        va_list vs;
-        char *buffer;
-        int length;
-        buffer = NULL;
-        if (encoder == NULL) {
-                linearbuffers_errorf("encoder is invalid");
-                goto bail;
-        }
-        if (offset == NULL) {
-                linearbuffers_errorf("offset is invalid");
-                goto bail;
-        }
-        if (value == NULL) {
-                linearbuffers_errorf("value is invalid");
-                goto bail;
-        }
-        if (TAILQ_EMPTY(&encoder->entries)) {
-                linearbuffers_errorf("logic error: entries is empty");
-                goto bail;
-        }
-        *offset = encoder->emitter.offset;
-        va_copy(vs, va);
-        length = vsnprintf(NULL, 0, value, vs);
-        va_end(vs);
-        if (length < 0) {
+        struct linearbuffers_encoder *encoder;
+        encoder = NULL;
+        if (buffer == NULL) {
+                linearbuffers_errorf("buffer is invalid");
                 goto bail;
         }
-        buffer = malloc(length + 1);
-        if (buffer == NULL) {
-                linearbuffers_errorf("can not allocate memory");
+        if (size < sizeof(struct linearbuffers_encoder)) {
+                linearbuffers_errorf("size is invalid");
                 goto bail;
         }
-        va_copy(vs, va);
-        length = vsnprintf(buffer, length + 1, value, vs);
-        va_end(vs);
-        if (length < 0) {
-                linearbuffers_errorf("can not print string");
+        if (((uintptr_t) buffer) % sizeof(uint64_t)) {
+                linearbuffers_errorf("buffer is not aligned");
                 goto bail;
         }
-        rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset, buffer, length + 1);
+        encoder = buffer;
+        memset(encoder, 0, sizeof(struct linearbuffers_encoder));
+        rc = linearbuffers_encoder_setup(encoder, options);
         if (rc != 0) {
-                linearbuffers_errorf("can not emit element");
+                linearbuffers_errorf("can not setup encoder");
                 goto bail;
         }
-        encoder->emitter.offset += length + 1;
-        free(buffer);
-        return 0;
-bail:   if (buffer != NULL) {
-                free(buffer);
+        return encoder;
+bail:   if (encoder != NULL) {
+                linearbuffers_encoder_uninit(encoder);
         }
-        return -1;
+        return NULL;
 }
 
-__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_ncreate (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t n, const char *value)
+__attribute__ ((__visibility__("default"))) void linearbuffers_encoder_uninit (struct linearbuffers_encoder *encoder)
 {
-        const char _null = 0;
-        int rc;
+        struct linearbuffers_entry *entry;
+        struct linearbuffers_entry *nentry;
         if (encoder == NULL) {
-                linearbuffers_errorf("encoder is invalid");
-                goto bail;
+                return;
         }
-        if (offset == NULL) {
-                linearbuffers_errorf("offset is invalid");
-                goto bail;
+        TAILQ_FOREACH_REVERSE_SAFE(entry, &encoder->entries, linearbuffers_entries, entries, nentry) {
+                linearbuffers_entry_remove(encoder, entry);
+                linearbuffers_entry_destroy(encoder, entry);
         }
-        if (value == NULL) {
-                linearbuffers_errorf("value is invalid");
+        linearbuffers_output_uninit(&encoder->output);
+        linearbuffers_pool_uninit(&encoder->pool.entry);
+        linearbuffers_scratch_uninit(&encoder->scratch);
+}
+
+__attribute__ ((__visibility__("default"))) struct linearbuffers_encoder * linearbuffers_encoder_create (struct linearbuffers_encoder_create_options *options)
+{
+        int rc;
+        struct linearbuffers_allocator allocator;
+        struct linearbuffers_encoder *encoder;
+        encoder = NULL;
+        rc = linearbuffers_encoder_allocator(&allocator, options);
+        if (rc != 0) {
+                linearbuffers_errorf("can not setup allocator");
                 goto bail;
         }
-        if (TAILQ_EMPTY(&encoder->entries)) {
-                linearbuffers_errorf("logic error: entries is empty");
+        encoder = linearbuffers_allocator_malloc(&allocator, sizeof(struct linearbuffers_encoder));
+        if (encoder == NULL) {
+                linearbuffers_errorf("can not allocate memory");
                 goto bail;
         }
-        *offset = encoder->emitter.offset;
-        rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset, value, n);
+        memset(encoder, 0, sizeof(struct linearbuffers_encoder));
+        rc = linearbuffers_encoder_setup(encoder, options);
         if (rc != 0) {
-                linearbuffers_errorf("can not emit element");
+                linearbuffers_errorf("can not setup encoder");
                 goto bail;
         }
-        rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset + n, &_null, 1);
-        if (rc != 0) {
-                linearbuffers_errorf("can not emit element");
-                goto bail;
+        return encoder;
+bail:   if (encoder != NULL) {
+                linearbuffers_encoder_destroy(encoder);
         }
-        encoder->emitter.offset += n + 1;
-        return 0;
-bail:   return -1;
+        return NULL;
+}
+
+__attribute__ ((__visibility__("default"))) void linearbuffers_encoder_destroy (struct linearbuffers_encoder *encoder)
+{
+        struct linearbuffers_allocator allocator;
+        if (encoder == NULL) {
+                return;
+        }
+        allocator = encoder->allocator;
+        linearbuffers_encoder_uninit(encoder);
+        linearbuffers_allocator_free(&allocator, encoder);
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_reset (struct linearbuffers_encoder *encoder, struct linearbuffers_encoder_reset_options *options)
+{
+        int rc;
+        struct linearbuffers_entry *entry;
+        struct linearbuffers_entry *nentry;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        TAILQ_FOREACH_REVERSE_SAFE(entry, &encoder->entries, linearbuffers_entries, entries, nentry) {
+                linearbuffers_entry_remove(encoder, entry);
+                linearbuffers_entry_destroy(encoder, entry);
+        }
+        if (encoder->memory.adaptive &&
+            encoder->output.length > 0) {
+                if (encoder->memory.average == 0) {
+                        encoder->memory.average = encoder->output.length;
+                } else {
+                        encoder->memory.average = encoder->memory.average - (encoder->memory.average / 8) + (encoder->output.length / 8);
+                }
+        }
+        encoder->emitter.offset = 0;
+        encoder->emitter.function = linearbuffers_encoder_default_emitter;
+        encoder->emitter.context = encoder;
+        encoder->emitter.direct = 1;
+        encoder->alignment = 0;
+        memset(&encoder->string, 0, sizeof(encoder->string));
+        memset(&encoder->reserve, 0, sizeof(encoder->reserve));
+        linearbuffers_output_reset(&encoder->output);
+        encoder->scratch.length = 0;
+        linearbuffers_encoder_trim(encoder);
+        if (options != NULL) {
+                if (options->emitter.function != NULL) {
+                        encoder->emitter.function = options->emitter.function;
+                        encoder->emitter.context = options->emitter.context;
+                        encoder->emitter.direct = 0;
+                }
+        }
+        if (encoder->memory.adaptive &&
+            encoder->memory.average > 0 &&
+            encoder->emitter.direct &&
+            encoder->output.fixed == 0) {
+                rc = linearbuffers_output_grow(&encoder->output, (encoder->memory.watermark > 0) ? MIN(encoder->memory.average, encoder->memory.watermark) : encoder->memory.average);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not grow output");
+                        goto bail;
+                }
+        }
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_reserve (struct linearbuffers_encoder *encoder, uint64_t size)
+{
+        int rc;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (encoder->emitter.direct == 0) {
+                return 0;
+        }
+        rc = linearbuffers_output_grow(&encoder->output, size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not grow output");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_set_alignment (struct linearbuffers_encoder *encoder, uint64_t alignment)
+{
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (alignment > 4096 ||
+            (alignment & (alignment - 1)) != 0) {
+                linearbuffers_errorf("alignment is invalid");
+                goto bail;
+        }
+        if (encoder->alignment == alignment) {
+                return 0;
+        }
+        if (!TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is not empty");
+                goto bail;
+        }
+        encoder->alignment = alignment;
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_set_string_type (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_string_type string_type, enum linearbuffers_encoder_count_type count_type)
+{
+        uint64_t prefix_size;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (string_type != linearbuffers_encoder_string_type_terminated &&
+            string_type != linearbuffers_encoder_string_type_prefixed) {
+                linearbuffers_errorf("string type is invalid");
+                goto bail;
+        }
+        if (count_type > linearbuffers_encoder_count_type_uint64) {
+                linearbuffers_errorf("count type is invalid");
+                goto bail;
+        }
+        prefix_size = (string_type == linearbuffers_encoder_string_type_prefixed) ? linearbuffers_encoder_count_types[count_type].size : 0;
+        if (encoder->string.prefix_size == prefix_size) {
+                return 0;
+        }
+        if (!TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is not empty");
+                goto bail;
+        }
+        encoder->string.prefix_size = prefix_size;
+        encoder->string.prefix_emitter = (prefix_size != 0) ? linearbuffers_encoder_count_types[count_type].emitter : NULL;
+        return 0;
+bail:   return -1;
+}
+
+static int linearbuffers_encoder_table_start_fields (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size, const struct linearbuffers_encoder_table_field *fields, int promoted)
+{
+        int rc;
+        struct linearbuffers_entry *entry;
+        entry = NULL;
+        entry = linearbuffers_entry_create(encoder);
+        if (entry == NULL) {
+                linearbuffers_errorf("can not allocate memory");
+                goto bail;
+        }
+        memset(entry, 0, sizeof(struct linearbuffers_entry));
+        entry->type = linearbuffers_entry_type_table;
+        entry->count_size = linearbuffers_encoder_count_types[count_type].size;
+        entry->count_emitter = linearbuffers_encoder_count_types[count_type].emitter;
+        entry->offset_size = linearbuffers_encoder_offset_types[(promoted) ? linearbuffers_encoder_offset_type_uint64 : offset_type].size;
+        entry->offset_emitter = linearbuffers_encoder_offset_types[(promoted) ? linearbuffers_encoder_offset_type_uint64 : offset_type].emitter;
+        entry->u.table.elements = elements;
+        entry->u.table.present = sizeof(uint8_t) * ((elements + 7) / 8);
+        if (encoder->alignment != 0) {
+                rc = linearbuffers_encoder_pad(encoder, sizeof(uint64_t));
+                if (rc != 0) {
+                        linearbuffers_errorf("can not align table");
+                        goto bail;
+                }
+                entry->u.table.present = linearbuffers_encoder_aligned(entry->count_size + entry->u.table.present, sizeof(uint64_t)) - entry->count_size;
+        }
+        if (fields != NULL) {
+                /* sparse header keeps the field block offset after the present bitmap,
+                 * fields are staged in full and only emitted at table end. promoted
+                 * tables stage offsets as uint64 and narrow them when emitting. */
+                entry->u.table.fields = fields;
+                entry->u.table.block = linearbuffers_encoder_offset_types[offset_type].size;
+                entry->u.table.promoted = promoted;
+                entry->u.table.present += entry->u.table.block;
+        }
+        entry->offset = encoder->emitter.offset;
+        linearbuffers_debugf("creating table, size: (count_size: %" PRIi64 " + present_bytes: %" PRIi64 " + size:  %" PRIi64 ") = %" PRIi64 "", entry->count_size, entry->u.table.present, size, entry->count_size + entry->u.table.present + size);
+        rc = linearbuffers_table_buffer_init(&encoder->scratch, &entry->u.table.buffer, entry->count_size + entry->u.table.present + size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not init table buffer");
+                goto bail;
+        }
+        if (fields != NULL) {
+                encoder->emitter.offset += entry->count_size + entry->u.table.present;
+        } else {
+                encoder->emitter.offset += entry->u.table.buffer.size;
+        }
+        linearbuffers_entry_push(encoder, entry);
+        return 0;
+bail:   if (entry != NULL) {
+                linearbuffers_entry_destroy(encoder, entry);
+        }
+        linearbuffers_entry_fail(encoder);
+        return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_start (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size)
+{
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        return linearbuffers_encoder_table_start_fields(encoder, count_type, offset_type, elements, size, NULL, 0);
+bail:   linearbuffers_entry_fail(encoder);
+        return -1;
+}
+
+static int linearbuffers_encoder_table_start_checked (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size, const struct linearbuffers_encoder_table_field *fields, int promoted)
+{
+        uint64_t element;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (fields == NULL) {
+                linearbuffers_errorf("fields is invalid");
+                goto bail;
+        }
+        for (element = 0; element < elements; element++) {
+                if (fields[element].offset + fields[element].size > size ||
+                    fields[element].alignment == 0 ||
+                    (fields[element].alignment & (fields[element].alignment - 1)) != 0) {
+                        linearbuffers_errorf("field is invalid: %" PRIu64 "", element);
+                        goto bail;
+                }
+                if (fields[element].promote &&
+                    (promoted == 0 || fields[element].size != sizeof(uint64_t))) {
+                        linearbuffers_errorf("field is invalid: %" PRIu64 "", element);
+                        goto bail;
+                }
+        }
+        return linearbuffers_encoder_table_start_fields(encoder, count_type, offset_type, elements, size, fields, promoted);
+bail:   linearbuffers_entry_fail(encoder);
+        return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_start_sparse (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size, const struct linearbuffers_encoder_table_field *fields)
+{
+        return linearbuffers_encoder_table_start_checked(encoder, count_type, offset_type, elements, size, fields, 0);
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_start_promoted (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size, const struct linearbuffers_encoder_table_field *fields)
+{
+        return linearbuffers_encoder_table_start_checked(encoder, count_type, offset_type, elements, size, fields, 1);
+}
+
+static int linearbuffers_encoder_table_sparse_layout (struct linearbuffers_encoder *encoder, struct linearbuffers_entry *entry, const uint8_t *buffer, uint64_t width, uint64_t *length)
+{
+        uint64_t limit;
+        uint64_t value;
+        uint64_t header;
+        uint64_t element;
+        uint64_t present;
+        uint64_t position;
+        const struct linearbuffers_encoder_table_field *field;
+
+        limit = (width < sizeof(uint64_t)) ? (UINT64_C(1) << (width * 8)) - 1 : UINT64_MAX;
+        header = entry->count_size + entry->u.table.present;
+
+        present = 0;
+        for (element = 0; element < entry->u.table.elements; element++) {
+                if (buffer[entry->count_size + element / 8] & (1 << (element % 8))) {
+                        present += 1;
+                }
+        }
+        position = present * width;
+        for (element = 0; element < entry->u.table.elements; element++) {
+                if (!(buffer[entry->count_size + element / 8] & (1 << (element % 8)))) {
+                        continue;
+                }
+                field = &entry->u.table.fields[element];
+                if (encoder->alignment != 0) {
+                        position = linearbuffers_encoder_aligned(position, (field->promote) ? width : field->alignment);
+                }
+                if (position > limit) {
+                        return -1;
+                }
+                if (field->promote) {
+                        memcpy(&value, buffer + header + field->offset, sizeof(value));
+                        if (value > limit) {
+                                return -1;
+                        }
+                        position += width;
+                } else {
+                        position += field->size;
+                }
+        }
+        *length = position;
+        return 0;
+}
+
+static int linearbuffers_encoder_table_emit_sparse (struct linearbuffers_encoder *encoder, struct linearbuffers_entry *entry)
+{
+        int rc;
+        uint8_t *block;
+        uint8_t *buffer;
+        uint64_t header;
+        uint64_t element;
+        uint64_t present;
+        uint64_t position;
+        uint64_t scratch;
+        uint64_t length;
+        uint64_t width;
+        uint64_t value;
+        uint64_t offset;
+        const struct linearbuffers_encoder_table_field *field;
+
+        length = encoder->scratch.length;
+        header = entry->count_size + entry->u.table.present;
+        buffer = linearbuffers_table_buffer_get(&encoder->scratch, &entry->u.table.buffer);
+
+        if (encoder->alignment != 0) {
+                rc = linearbuffers_encoder_pad(encoder, sizeof(uint64_t));
+                if (rc != 0) {
+                        linearbuffers_errorf("can not align table fields");
+                        goto bail;
+                }
+        }
+        if (entry->u.table.promoted) {
+                /* promoted block offset keeps log2 of the chosen width in its low bits */
+                offset = entry->offset + linearbuffers_encoder_aligned(encoder->emitter.offset - entry->offset, sizeof(uint32_t));
+                if (offset != encoder->emitter.offset) {
+                        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, NULL, offset - encoder->emitter.offset);
+                        if (rc != 0) {
+                                linearbuffers_errorf("can not align table fields");
+                                goto bail;
+                        }
+                        encoder->emitter.offset = offset;
+                }
+                for (width = sizeof(uint8_t); width < sizeof(uint64_t); width <<= 1) {
+                        if (linearbuffers_encoder_table_sparse_layout(encoder, entry, buffer, width, &position) == 0) {
+                                break;
+                        }
+                }
+        } else {
+                width = entry->offset_size;
+        }
+        rc = linearbuffers_encoder_table_sparse_layout(encoder, entry, buffer, width, &position);
+        if (rc != 0) {
+                linearbuffers_errorf("table fields are out of range, width: %" PRIu64 "", width);
+                goto bail;
+        }
+
+        rc = linearbuffers_scratch_push(&encoder->scratch, position, &scratch);
+        if (rc != 0) {
+                linearbuffers_errorf("can not push scratch");
+                goto bail;
+        }
+        block = encoder->scratch.buffer + scratch;
+        buffer = linearbuffers_table_buffer_get(&encoder->scratch, &entry->u.table.buffer);
+        memset(block, 0, position);
+
+        present = 0;
+        for (element = 0; element < entry->u.table.elements; element++) {
+                if (buffer[entry->count_size + element / 8] & (1 << (element % 8))) {
+                        present += 1;
+                }
+        }
+        position = present * width;
+        present = 0;
+        for (element = 0; element < entry->u.table.elements; element++) {
+                if (!(buffer[entry->count_size + element / 8] & (1 << (element % 8)))) {
+                        continue;
+                }
+                field = &entry->u.table.fields[element];
+                if (encoder->alignment != 0) {
+                        position = linearbuffers_encoder_aligned(position, (field->promote) ? width : field->alignment);
+                }
+                rc = linearbuffers_table_buffer_store(block + present * width, width, position);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not store table field slot");
+                        goto bail;
+                }
+                if (field->promote) {
+                        memcpy(&value, buffer + header + field->offset, sizeof(value));
+                        rc = linearbuffers_table_buffer_store(block + position, width, value);
+                        if (rc != 0) {
+                                linearbuffers_errorf("can not store table field offset");
+                                goto bail;
+                        }
+                        position += width;
+                } else {
+                        memcpy(block + position, buffer + header + field->offset, field->size);
+                        position += field->size;
+                }
+                present += 1;
+        }
+
+        value = encoder->emitter.offset - entry->offset;
+        if (entry->u.table.promoted) {
+                value |= (width == sizeof(uint8_t)) ? 0 : (width == sizeof(uint16_t)) ? 1 : (width == sizeof(uint32_t)) ? 2 : 3;
+        }
+        rc = linearbuffers_table_buffer_store(buffer + header - entry->u.table.block, entry->u.table.block, value);
+        if (rc != 0) {
+                linearbuffers_errorf("can not store table fields offset");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, block, position);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit table fields");
+                goto bail;
+        }
+        encoder->emitter.offset += position;
+        linearbuffers_scratch_pop(&encoder->scratch, length);
+
+        rc = linearbuffers_encoder_emit(encoder, entry->offset, buffer, header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit table");
+                goto bail;
+        }
+        return 0;
+bail:   linearbuffers_scratch_pop(&encoder->scratch, length);
+        return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_end (struct linearbuffers_encoder *encoder, uint64_t *offset)
+{
+        int rc;
+        uint8_t *buffer;
+        struct linearbuffers_entry *entry;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries);
+        if (entry == NULL ||
+            entry != encoder->current) {
+                linearbuffers_errorf("logic error: entry is invalid");
+                goto bail;
+        }
+        if (entry->type != linearbuffers_entry_type_table) {
+                linearbuffers_errorf("logic error: entry type is not table");
+                goto bail;
+        }
+        if (offset != NULL) {
+                *offset = entry->offset;
+        }
+        buffer = linearbuffers_table_buffer_get(&encoder->scratch, &entry->u.table.buffer);
+        rc = linearbuffers_table_buffer_store(buffer, entry->count_size, entry->u.table.elements);
+        if (rc != 0) {
+                linearbuffers_errorf("can not store table count");
+                goto bail;
+        }
+        if (entry->u.table.fields != NULL) {
+                rc = linearbuffers_encoder_table_emit_sparse(encoder, entry);
+        } else {
+                rc = linearbuffers_encoder_emit(encoder, entry->offset, buffer, entry->u.table.buffer.size);
+        }
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit table");
+                goto bail;
+        }
+        linearbuffers_entry_remove(encoder, entry);
+        linearbuffers_entry_destroy(encoder, entry);
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_cancel (struct linearbuffers_encoder *encoder)
+{
+        int rc;
+        struct linearbuffers_entry *entry;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries);
+        if (entry == NULL ||
+            entry != encoder->current) {
+                linearbuffers_errorf("logic error: entry is invalid");
+                goto bail;
+        }
+        if (entry->type != linearbuffers_entry_type_table) {
+                linearbuffers_errorf("logic error: entry is invalid");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, NULL, entry->offset - encoder->emitter.offset);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit table cancel");
+                goto bail;
+        }
+        encoder->emitter.offset = entry->offset;
+        linearbuffers_entry_remove(encoder, entry);
+        linearbuffers_entry_destroy(encoder, entry);
+        return 0;
+bail:   return -1;
+}
+
+#define linearbuffers_encoder_table_set_scalar_type(__type__, __type_t__) \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_ ## __type__ (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, __type_t__ value) \
+        { \
+                struct linearbuffers_entry *parent; \
+                if (encoder == NULL) { \
+                        linearbuffers_errorf("encoder is invalid"); \
+                        goto bail; \
+                } \
+                if (TAILQ_EMPTY(&encoder->entries)) { \
+                        linearbuffers_errorf("logic error: entries is empty"); \
+                        goto bail; \
+                } \
+                parent = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
+                if (parent == NULL) { \
+                        linearbuffers_errorf("logic error: parent is invalid"); \
+                        goto bail; \
+                } \
+                if (parent->type != linearbuffers_entry_type_table) { \
+                        linearbuffers_errorf("logic error: parent is invalid"); \
+                        goto bail; \
+                } \
+                if (element >= parent->u.table.elements) { \
+                        linearbuffers_errorf("logic error: element is invalid"); \
+                        goto bail; \
+                } \
+                if (offset + sizeof(__type_t__) > parent->u.table.buffer.size - parent->count_size - parent->u.table.present) { \
+                        linearbuffers_errorf("logic error: offset is invalid"); \
+                        goto bail; \
+                } \
+                return linearbuffers_encoder_table_set_ ## __type__ ## _unchecked(encoder, element, offset, value); \
+        bail:   return -1; \
+        } \
+        \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_ ## __type__ ## _unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, __type_t__ value) \
+        { \
+                uint8_t *buffer; \
+                struct linearbuffers_entry *parent; \
+                parent = encoder->current; \
+                if (parent == NULL || \
+                    parent->type != linearbuffers_entry_type_table) { \
+                        linearbuffers_errorf("logic error: parent is invalid"); \
+                        return -1; \
+                } \
+                buffer = linearbuffers_table_buffer_get(&encoder->scratch, &parent->u.table.buffer); \
+                memcpy(buffer + parent->count_size + parent->u.table.present + offset, &value, sizeof(__type_t__)); \
+                buffer[parent->count_size + element / 8] |= (1 << (element % 8)); \
+                return 0; \
+        }
+
+linearbuffers_encoder_table_set_scalar_type(int8, int8_t);
+linearbuffers_encoder_table_set_scalar_type(int16, int16_t);
+linearbuffers_encoder_table_set_scalar_type(int32, int32_t);
+linearbuffers_encoder_table_set_scalar_type(int64, int64_t);
+
+linearbuffers_encoder_table_set_scalar_type(uint8, uint8_t);
+linearbuffers_encoder_table_set_scalar_type(uint16, uint16_t);
+linearbuffers_encoder_table_set_scalar_type(uint32, uint32_t);
+linearbuffers_encoder_table_set_scalar_type(uint64, uint64_t);
+
+linearbuffers_encoder_table_set_scalar_type(float, float);
+linearbuffers_encoder_table_set_scalar_type(double, double);
+
+linearbuffers_encoder_table_set_scalar_type(float16, uint16_t);
+linearbuffers_encoder_table_set_scalar_type(bfloat16, uint16_t);
+
+#define linearbuffers_encoder_table_set_type(__type__) \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_ ## __type__ (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value) \
+        { \
+                struct linearbuffers_entry *parent; \
+                if (encoder == NULL) { \
+                        linearbuffers_errorf("encoder is invalid"); \
+                        goto bail; \
+                } \
+                if (value <= 0) { \
+                        linearbuffers_errorf("value is invalid"); \
+                        goto bail; \
+                } \
+                if (TAILQ_EMPTY(&encoder->entries)) { \
+                        linearbuffers_errorf("logic error: entries is empty"); \
+                        goto bail; \
+                } \
+                parent = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
+                if (parent == NULL) { \
+                        linearbuffers_errorf("logic error: parent is invalid"); \
+                        goto bail; \
+                } \
+                if (parent->type != linearbuffers_entry_type_table) { \
+                        linearbuffers_errorf("logic error: parent is invalid"); \
+                        goto bail; \
+                } \
+                if (element >= parent->u.table.elements) { \
+                        linearbuffers_errorf("logic error: element is invalid"); \
+                        goto bail; \
+                } \
+                if (offset + parent->offset_size > parent->u.table.buffer.size - parent->count_size - parent->u.table.present) { \
+                        linearbuffers_errorf("logic error: offset is invalid"); \
+                        goto bail; \
+                } \
+                return linearbuffers_encoder_table_set_ ## __type__ ## _unchecked(encoder, element, offset, value); \
+        bail:   return -1; \
+        } \
+        \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_ ## __type__ ## _unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value) \
+        { \
+                uint8_t *buffer; \
+                struct linearbuffers_entry *parent; \
+                if (value <= 0) { \
+                        linearbuffers_errorf("value is invalid"); \
+                        return -1; \
+                } \
+                parent = encoder->current; \
+                if (parent == NULL || \
+                    parent->type != linearbuffers_entry_type_table) { \
+                        linearbuffers_errorf("logic error: parent is invalid"); \
+                        return -1; \
+                } \
+                buffer = linearbuffers_table_buffer_get(&encoder->scratch, &parent->u.table.buffer); \
+                if (linearbuffers_table_buffer_store(buffer + parent->count_size + parent->u.table.present + offset, parent->offset_size, value - parent->offset) != 0) { \
+                        linearbuffers_errorf("can not store table element offset"); \
+                        return -1; \
+                } \
+                buffer[parent->count_size + element / 8] |= (1 << (element % 8)); \
+                return 0; \
+        }
+
+linearbuffers_encoder_table_set_type(string);
+linearbuffers_encoder_table_set_type(table);
+linearbuffers_encoder_table_set_type(vector);
+linearbuffers_encoder_table_set_type(bytes);
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_struct (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, const void *value, uint64_t size)
+{
+        struct linearbuffers_entry *parent;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (value == NULL) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        parent = TAILQ_LAST(&encoder->entries, linearbuffers_entries);
+        if (parent == NULL) {
+                linearbuffers_errorf("logic error: parent is invalid");
+                goto bail;
+        }
+        if (parent->type != linearbuffers_entry_type_table) {
+                linearbuffers_errorf("logic error: parent is invalid");
+                goto bail;
+        }
+        if (element >= parent->u.table.elements) {
+                linearbuffers_errorf("logic error: element is invalid");
+                goto bail;
+        }
+        if (offset + size > parent->u.table.buffer.size - parent->count_size - parent->u.table.present) {
+                linearbuffers_errorf("logic error: offset is invalid");
+                goto bail;
+        }
+        return linearbuffers_encoder_table_set_struct_unchecked(encoder, element, offset, value, size);
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_struct_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, const void *value, uint64_t size)
+{
+        uint8_t *buffer;
+        struct linearbuffers_entry *parent;
+        parent = encoder->current;
+        if (parent == NULL ||
+            parent->type != linearbuffers_entry_type_table) {
+                linearbuffers_errorf("logic error: parent is invalid");
+                return -1;
+        }
+        buffer = linearbuffers_table_buffer_get(&encoder->scratch, &parent->u.table.buffer);
+        memcpy(buffer + parent->count_size + parent->u.table.present + offset, value, size);
+        buffer[parent->count_size + element / 8] |= (1 << (element % 8));
+        return 0;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_bool (struct linearbuffers_encoder *encoder, uint64_t element, int value)
+{
+        struct linearbuffers_entry *parent;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        parent = TAILQ_LAST(&encoder->entries, linearbuffers_entries);
+        if (parent == NULL) {
+                linearbuffers_errorf("logic error: parent is invalid");
+                goto bail;
+        }
+        if (parent->type != linearbuffers_entry_type_table) {
+                linearbuffers_errorf("logic error: parent is invalid");
+                goto bail;
+        }
+        if (element >= parent->u.table.elements) {
+                linearbuffers_errorf("logic error: element is invalid");
+                goto bail;
+        }
+        return linearbuffers_encoder_table_set_bool_unchecked(encoder, element, value);
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_table_set_bool_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, int value)
+{
+        uint8_t *buffer;
+        struct linearbuffers_entry *parent;
+        parent = encoder->current;
+        if (parent == NULL ||
+            parent->type != linearbuffers_entry_type_table) {
+                linearbuffers_errorf("logic error: parent is invalid");
+                return -1;
+        }
+        buffer = linearbuffers_table_buffer_get(&encoder->scratch, &parent->u.table.buffer);
+        /* bool fields have no payload, the present bit is the value */
+        if (value) {
+                buffer[parent->count_size + element / 8] |= (1 << (element % 8));
+        } else {
+                buffer[parent->count_size + element / 8] &= ~(1 << (element % 8));
+        }
+        return 0;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_create (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value)
+{
+        int rc;
+        uint64_t length;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_string_prefix_reserve(encoder);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve string length");
+                goto bail;
+        }
+        *offset = encoder->emitter.offset;
+        length = strlen(value) + 1;
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, value, length);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit element");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_string_prefix_emit(encoder, *offset, length - 1);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit string length");
+                goto bail;
+        }
+        encoder->emitter.offset += length;
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_createf (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value, ...)
+{
+        int rc;
+        va_list ap;
+        va_start(ap, value);
+        rc = linearbuffers_encoder_string_createv(encoder, offset, value, ap);
+        va_end(ap);
+        return rc;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_createv (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value, va_list va)
+{
+        int rc;
+        va_list vs;
+        int length;
+        char *buffer;
+        uint64_t size;
+        struct linearbuffers_output_chunk *chunk;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_string_prefix_reserve(encoder);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve string length");
+                goto bail;
+        }
+        buffer = NULL;
+        size = 0;
+        chunk = encoder->output.cchunk;
+        if (encoder->emitter.direct &&
+            chunk != NULL &&
+            encoder->emitter.offset >= chunk->offset &&
+            encoder->emitter.offset < chunk->offset + chunk->size) {
+                buffer = (char *) chunk->buffer + (encoder->emitter.offset - chunk->offset);
+                size = chunk->offset + chunk->size - encoder->emitter.offset;
+        }
+        va_copy(vs, va);
+        length = vsnprintf(buffer, MIN(size, INT_MAX), value, vs);
+        va_end(vs);
+        if (length < 0) {
+                linearbuffers_errorf("can not print string");
+                goto bail;
+        }
+        if ((uint64_t) length < size) {
+                *offset = encoder->emitter.offset;
+                encoder->emitter.offset += length + 1;
+                encoder->output.length = MAX(encoder->output.length, encoder->emitter.offset);
+                rc = linearbuffers_encoder_string_prefix_emit(encoder, *offset, length);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not emit string length");
+                        goto bail;
+                }
+                return 0;
+        }
+        rc = linearbuffers_encoder_span_reserve(encoder, 0, NULL, length + 1, (void **) &buffer);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve string");
+                goto bail;
+        }
+        va_copy(vs, va);
+        length = vsnprintf(buffer, length + 1, value, vs);
+        va_end(vs);
+        if (length < 0) {
+                linearbuffers_errorf("can not print string");
+                if (encoder->emitter.direct == 0) {
+                        linearbuffers_scratch_pop(&encoder->scratch, encoder->reserve.scratch);
+                }
+                memset(&encoder->reserve, 0, sizeof(encoder->reserve));
+                goto bail;
+        }
+        rc = linearbuffers_encoder_span_commit(encoder, offset, 0, length + 1);
+        if (rc != 0) {
+                linearbuffers_errorf("can not commit string");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_string_prefix_emit(encoder, *offset, length);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit string length");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_ncreate (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t n, const char *value)
+{
+        const char _null = 0;
+        int rc;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_string_prefix_reserve(encoder);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve string length");
+                goto bail;
+        }
+        *offset = encoder->emitter.offset;
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, value, n);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit element");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset + n, &_null, 1);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit element");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_string_prefix_emit(encoder, *offset, n);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit string length");
+                goto bail;
+        }
+        encoder->emitter.offset += n + 1;
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_reserve (struct linearbuffers_encoder *encoder, uint64_t n, char **value)
+{
+        int rc;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (value == NULL) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_string_prefix_reserve(encoder);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve string length");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_span_reserve(encoder, 0, NULL, n + 1, (void **) value);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve string");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_string_commit (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t n)
+{
+        int rc;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (encoder->reserve.buffer == NULL ||
+            encoder->reserve.count_emitter != NULL) {
+                linearbuffers_errorf("logic error: reserve is invalid");
+                goto bail;
+        }
+        if (n + 1 > encoder->reserve.length) {
+                linearbuffers_errorf("n is invalid");
+                goto bail;
+        }
+        encoder->reserve.buffer[n] = '\0';
+        rc = linearbuffers_encoder_span_commit(encoder, offset, 0, n + 1);
+        if (rc != 0) {
+                linearbuffers_errorf("can not commit string");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_string_prefix_emit(encoder, *offset, n);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit string length");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+static int linearbuffers_encoder_bytes_align (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, uint64_t alignment)
+{
+        int rc;
+        if (count_type > linearbuffers_encoder_count_type_uint64) {
+                linearbuffers_errorf("count type is invalid");
+                goto bail;
+        }
+        if (alignment == 0 ||
+            alignment > 4096 ||
+            (alignment & (alignment - 1)) != 0) {
+                linearbuffers_errorf("alignment is invalid: %" PRIu64 "", alignment);
+                goto bail;
+        }
+        rc = linearbuffers_encoder_payload_align(encoder, linearbuffers_encoder_count_types[count_type].size, alignment);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align bytes");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_bytes_create (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, uint64_t alignment, uint64_t *offset, const void *value, uint64_t length)
+{
+        int rc;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL &&
+            length != 0) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_bytes_align(encoder, count_type, alignment);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align bytes");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_count_types[count_type].emitter(encoder, encoder->emitter.offset, length);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit count");
+                goto bail;
+        }
+        if (length != 0) {
+                rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset + linearbuffers_encoder_count_types[count_type].size, value, length);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not emit bytes");
+                        goto bail;
+                }
+        }
+        *offset = encoder->emitter.offset;
+        encoder->emitter.offset += linearbuffers_encoder_count_types[count_type].size + length;
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_bytes_reserve (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, uint64_t alignment, uint64_t length, void **value)
+{
+        int rc;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (value == NULL) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_bytes_align(encoder, count_type, alignment);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align bytes");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_span_reserve(encoder, linearbuffers_encoder_count_types[count_type].size, linearbuffers_encoder_count_types[count_type].emitter, length, value);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve bytes");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_bytes_commit (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t length)
+{
+        int rc;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (encoder->reserve.buffer == NULL ||
+            encoder->reserve.count_emitter == NULL) {
+                linearbuffers_errorf("logic error: reserve is invalid");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_span_commit(encoder, offset, length, length);
+        if (rc != 0) {
+                linearbuffers_errorf("can not commit bytes");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
 }
 
 #define linearbuffers_encoder_vector_start_scalar_type(__type__, __type_t__) \
         __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_create_ ## __type__ (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const __type_t__ *value, uint64_t count) \
         { \
                 int rc; \
+                uint64_t header; \
                 (void) offset_type; \
                 if (encoder == NULL) { \
                         linearbuffers_errorf("encoder is invalid"); \
@@ -916,26 +2652,108 @@ bail:   return -1;
                         linearbuffers_errorf("logic error: entries is empty"); \
                         goto bail; \
                 } \
+                rc = linearbuffers_encoder_vector_align(encoder, linearbuffers_encoder_count_types[count_type].size, MAX(sizeof(__type_t__), encoder->alignment), &header); \
+                if (rc != 0) { \
+                        linearbuffers_errorf("can not align vector"); \
+                        goto bail; \
+                } \
                 *offset = encoder->emitter.offset; \
-                rc = linearbuffers_encoder_count_types[count_type].emitter(encoder->emitter.function, encoder->emitter.context, encoder->emitter.offset, count); \
+                rc = linearbuffers_encoder_count_types[count_type].emitter(encoder, encoder->emitter.offset, count); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector count"); \
                         goto bail; \
                 } \
-                rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset + linearbuffers_encoder_count_types[count_type].size, value, count * sizeof(__type_t__)); \
+                if (header > linearbuffers_encoder_count_types[count_type].size) { \
+                        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset + linearbuffers_encoder_count_types[count_type].size, NULL, header - linearbuffers_encoder_count_types[count_type].size); \
+                        if (rc != 0) { \
+                                linearbuffers_errorf("can not emit vector padding"); \
+                                goto bail; \
+                        } \
+                } \
+                rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset + header, value, count * sizeof(__type_t__)); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector values"); \
                         goto bail; \
                 } \
-                encoder->emitter.offset += linearbuffers_encoder_count_types[count_type].size; \
+                encoder->emitter.offset += header; \
                 encoder->emitter.offset += count * sizeof(__type_t__); \
                 return 0; \
         bail:   return -1; \
         } \
         \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_reserve_ ## __type__ (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, __type_t__ **value) \
+        { \
+                int rc; \
+                uint64_t header; \
+                (void) offset_type; \
+                if (encoder == NULL) { \
+                        linearbuffers_errorf("encoder is invalid"); \
+                        goto bail; \
+                } \
+                if (value == NULL) { \
+                        linearbuffers_errorf("value is invalid"); \
+                        goto bail; \
+                } \
+                if (TAILQ_EMPTY(&encoder->entries)) { \
+                        linearbuffers_errorf("logic error: entries is empty"); \
+                        goto bail; \
+                } \
+                if (encoder->alignment == 0) { \
+                        rc = linearbuffers_encoder_payload_align(encoder, linearbuffers_encoder_count_types[count_type].size, sizeof(__type_t__)); \
+                        if (rc != 0) { \
+                                linearbuffers_errorf("can not align vector"); \
+                                goto bail; \
+                        } \
+                } \
+                rc = linearbuffers_encoder_vector_align(encoder, linearbuffers_encoder_count_types[count_type].size, MAX(sizeof(__type_t__), encoder->alignment), &header); \
+                if (rc != 0) { \
+                        linearbuffers_errorf("can not align vector"); \
+                        goto bail; \
+                } \
+                if (header > linearbuffers_encoder_count_types[count_type].size) { \
+                        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset + linearbuffers_encoder_count_types[count_type].size, NULL, header - linearbuffers_encoder_count_types[count_type].size); \
+                        if (rc != 0) { \
+                                linearbuffers_errorf("can not emit vector padding"); \
+                                goto bail; \
+                        } \
+                } \
+                rc = linearbuffers_encoder_span_reserve(encoder, header, linearbuffers_encoder_count_types[count_type].emitter, count * sizeof(__type_t__), (void **) value); \
+                if (rc != 0) { \
+                        linearbuffers_errorf("can not reserve vector values"); \
+                        goto bail; \
+                } \
+                return 0; \
+        bail:   return -1; \
+        } \
+        \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_commit_ ## __type__ (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count) \
+        { \
+                int rc; \
+                if (encoder == NULL) { \
+                        linearbuffers_errorf("encoder is invalid"); \
+                        goto bail; \
+                } \
+                if (offset == NULL) { \
+                        linearbuffers_errorf("offset is invalid"); \
+                        goto bail; \
+                } \
+                if (encoder->reserve.count_emitter == NULL) { \
+                        linearbuffers_errorf("logic error: reserve is invalid"); \
+                        goto bail; \
+                } \
+                rc = linearbuffers_encoder_span_commit(encoder, offset, count, count * sizeof(__type_t__)); \
+                if (rc != 0) { \
+                        linearbuffers_errorf("can not commit vector values"); \
+                        goto bail; \
+                } \
+                return 0; \
+        bail:   return -1; \
+        } \
+        \
         __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_start_ ## __type__ (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type) \
         { \
                 int rc; \
+                uint64_t header; \
                 struct linearbuffers_entry *entry; \
                 entry = NULL; \
                 if (encoder == NULL) { \
@@ -946,7 +2764,7 @@ bail:   return -1;
                         linearbuffers_errorf("logic error: entries is empty"); \
                         goto bail; \
                 } \
-                entry = linearbuffers_pool_malloc(&encoder->pool.entry); \
+                entry = linearbuffers_entry_create(encoder); \
                 if (entry == NULL) { \
                         linearbuffers_errorf("can not allocate memory"); \
                         goto bail; \
@@ -959,23 +2777,29 @@ bail:   return -1;
                 entry->count_emitter = linearbuffers_encoder_count_types[count_type].emitter; \
                 entry->offset_size = linearbuffers_encoder_offset_types[offset_type].size; \
                 entry->offset_emitter = linearbuffers_encoder_offset_types[offset_type].emitter; \
-                rc = linearbuffers_offset_table_init(&encoder->pool.offset, &entry->u.vector.offset, offset_type); \
+                rc = linearbuffers_offset_table_init(&encoder->scratch, &entry->u.vector.offset, offset_type); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not init table present"); \
                         goto bail; \
                 } \
+                rc = linearbuffers_encoder_vector_align(encoder, entry->count_size, MAX(sizeof(__type_t__), encoder->alignment), &header); \
+                if (rc != 0) { \
+                        linearbuffers_errorf("can not align vector"); \
+                        goto bail; \
+                } \
                 entry->offset = encoder->emitter.offset; \
-                rc = encoder->emitter.function(encoder->emitter.context, entry->offset, NULL, entry->count_size); \
+                rc = linearbuffers_encoder_emit(encoder, entry->offset, NULL, header); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector place"); \
                         goto bail; \
                 } \
-                encoder->emitter.offset += entry->count_size; \
-                TAILQ_INSERT_TAIL(&encoder->entries, entry, entries); \
+                encoder->emitter.offset += header; \
+                linearbuffers_entry_push(encoder, entry); \
                 return 0; \
         bail:   if (entry != NULL) { \
-                        linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry); \
+                        linearbuffers_entry_destroy(encoder, entry); \
                 } \
+                linearbuffers_entry_fail(encoder); \
                 return -1; \
         } \
         \
@@ -996,7 +2820,8 @@ bail:   return -1;
                         goto bail; \
                 } \
                 entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
-                if (entry == NULL) { \
+                if (entry == NULL || \
+                    entry != encoder->current) { \
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
@@ -1009,13 +2834,13 @@ bail:   return -1;
                         goto bail; \
                 } \
                 *offset = entry->offset; \
-                rc = entry->count_emitter(encoder->emitter.function, encoder->emitter.context, entry->offset, entry->u.vector.elements); \
+                rc = entry->count_emitter(encoder, entry->offset, entry->u.vector.elements); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector count"); \
                         goto bail; \
                 } \
-                TAILQ_REMOVE(&encoder->entries, entry, entries); \
-                linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry); \
+                linearbuffers_entry_remove(encoder, entry); \
+                linearbuffers_entry_destroy(encoder, entry); \
                 return 0; \
         bail:   return -1; \
         } \
@@ -1033,7 +2858,8 @@ bail:   return -1;
                         goto bail; \
                 } \
                 entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
-                if (entry == NULL) { \
+                if (entry == NULL || \
+                    entry != encoder->current) { \
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
@@ -1045,71 +2871,648 @@ bail:   return -1;
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
-                rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset, NULL, entry->offset - encoder->emitter.offset); \
+                rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, NULL, entry->offset - encoder->emitter.offset); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector cancel"); \
                         goto bail; \
                 } \
                 encoder->emitter.offset = entry->offset; \
-                TAILQ_REMOVE(&encoder->entries, entry, entries); \
-                linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry); \
+                linearbuffers_entry_remove(encoder, entry); \
+                linearbuffers_entry_destroy(encoder, entry); \
                 return 0; \
         bail:   return -1; \
         } \
         \
         __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_push_ ## __type__ (struct linearbuffers_encoder *encoder, __type_t__ value) \
         { \
-                int rc; \
-                struct linearbuffers_entry *entry; \
-                if (encoder == NULL) { \
-                        linearbuffers_errorf("encoder is invalid"); \
-                        goto bail; \
-                } \
-                if (TAILQ_EMPTY(&encoder->entries)) { \
-                        linearbuffers_errorf("logic error: entries is empty"); \
-                        goto bail; \
-                } \
-                entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
-                if (entry == NULL) { \
-                        linearbuffers_errorf("logic error: entry is invalid"); \
-                        goto bail; \
-                } \
-                if (entry->type != linearbuffers_entry_type_vector) { \
-                        linearbuffers_errorf("logic error: entry is invalid"); \
-                        goto bail; \
-                } \
-                if (entry->u.vector.type != linearbuffers_vector_type_ ## __type__) { \
-                        linearbuffers_errorf("logic error: entry is invalid"); \
-                        goto bail; \
-                } \
-                rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset, &value, sizeof(__type_t__)); \
-                if (rc != 0) { \
-                        linearbuffers_errorf("can not emit vector element"); \
-                        goto bail; \
-                } \
-                entry->u.vector.elements += 1; \
-                encoder->emitter.offset += sizeof(__type_t__); \
-                return 0; \
-        bail:   return -1; \
+                struct linearbuffers_entry *entry; \
+                if (encoder == NULL) { \
+                        linearbuffers_errorf("encoder is invalid"); \
+                        goto bail; \
+                } \
+                if (TAILQ_EMPTY(&encoder->entries)) { \
+                        linearbuffers_errorf("logic error: entries is empty"); \
+                        goto bail; \
+                } \
+                entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
+                if (entry == NULL || \
+                    entry != encoder->current) { \
+                        linearbuffers_errorf("logic error: entry is invalid"); \
+                        goto bail; \
+                } \
+                if (entry->type != linearbuffers_entry_type_vector) { \
+                        linearbuffers_errorf("logic error: entry is invalid"); \
+                        goto bail; \
+                } \
+                if (entry->u.vector.type != linearbuffers_vector_type_ ## __type__) { \
+                        linearbuffers_errorf("logic error: entry is invalid"); \
+                        goto bail; \
+                } \
+                return linearbuffers_encoder_vector_push_ ## __type__ ## _unchecked(encoder, value); \
+        bail:   return -1; \
+        } \
+        \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_push_ ## __type__ ## _unchecked (struct linearbuffers_encoder *encoder, __type_t__ value) \
+        { \
+                int rc; \
+                if (encoder->current == NULL || \
+                    encoder->current->type != linearbuffers_entry_type_vector || \
+                    encoder->current->u.vector.type != linearbuffers_vector_type_ ## __type__) { \
+                        linearbuffers_errorf("logic error: entry is invalid"); \
+                        return -1; \
+                } \
+                rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, &value, sizeof(__type_t__)); \
+                if (rc != 0) { \
+                        linearbuffers_errorf("can not emit vector element"); \
+                        return -1; \
+                } \
+                encoder->current->u.vector.elements += 1; \
+                encoder->emitter.offset += sizeof(__type_t__); \
+                return 0; \
+        }
+
+linearbuffers_encoder_vector_start_scalar_type(int8, int8_t);
+linearbuffers_encoder_vector_start_scalar_type(int16, int16_t);
+linearbuffers_encoder_vector_start_scalar_type(int32, int32_t);
+linearbuffers_encoder_vector_start_scalar_type(int64, int64_t);
+
+linearbuffers_encoder_vector_start_scalar_type(uint8, uint8_t);
+linearbuffers_encoder_vector_start_scalar_type(uint16, uint16_t);
+linearbuffers_encoder_vector_start_scalar_type(uint32, uint32_t);
+linearbuffers_encoder_vector_start_scalar_type(uint64, uint64_t);
+
+linearbuffers_encoder_vector_start_scalar_type(float, float);
+linearbuffers_encoder_vector_start_scalar_type(double, double);
+
+linearbuffers_encoder_vector_start_scalar_type(float16, uint16_t);
+linearbuffers_encoder_vector_start_scalar_type(bfloat16, uint16_t);
+
+__attribute__ ((__visibility__("default"))) uint16_t linearbuffers_float16_from_float (float value)
+{
+        uint32_t sign;
+        union {
+                float f;
+                uint32_t u;
+        } bits;
+
+        bits.f = value;
+        sign = (bits.u >> 16) & 0x8000;
+        bits.u &= 0x7fffffff;
+        if (bits.u > 0x7f800000) {
+                /* nan stays a quiet nan and keeps the top payload bits */
+                return sign | 0x7e00 | ((bits.u >> 13) & 0x3ff);
+        }
+        if (bits.u >= 0x47800000) {
+                /* overflow goes to infinity */
+                return sign | 0x7c00;
+        }
+        if (bits.u < 0x38800000) {
+                /* subnormal or zero, let the fpu round the mantissa by adding
+                 * 0.5 which lines up the ten result bits at the bottom. */
+                bits.f += 0.5f;
+                return sign | (uint16_t) (bits.u - 0x3f000000);
+        }
+        /* rebias exponent and round to nearest even */
+        bits.u += 0xc8000fff + ((bits.u >> 13) & 1);
+        return sign | (uint16_t) (bits.u >> 13);
+}
+
+__attribute__ ((__visibility__("default"))) uint16_t linearbuffers_bfloat16_from_float (float value)
+{
+        union {
+                float f;
+                uint32_t u;
+        } bits;
+
+        bits.f = value;
+        if ((bits.u & 0x7fffffff) > 0x7f800000) {
+                return (bits.u >> 16) | 0x0040;
+        }
+        bits.u += 0x7fff + ((bits.u >> 16) & 1);
+        return bits.u >> 16;
+}
+
+static void linearbuffers_float16_narrow (uint16_t *output, const float *value, uint64_t count)
+{
+        uint64_t i;
+        uint16_t half;
+        i = 0;
+#if defined(__F16C__)
+        for (; i + 8 <= count; i += 8) {
+                _mm_storeu_si128((__m128i *) (output + i), _mm256_cvtps_ph(_mm256_loadu_ps(value + i), _MM_FROUND_TO_NEAREST_INT));
+        }
+#endif
+        for (; i < count; i++) {
+                /* store through memcpy like the simd path, output is a raw span */
+                half = linearbuffers_float16_from_float(value[i]);
+                memcpy(output + i, &half, sizeof(half));
+        }
+}
+
+static void linearbuffers_bfloat16_narrow (uint16_t *output, const float *value, uint64_t count)
+{
+        uint64_t i;
+        uint16_t half;
+        i = 0;
+#if defined(__AVX2__)
+        for (; i + 8 <= count; i += 8) {
+                __m256i bits;
+                __m256i nan;
+                __m256i round;
+                bits  = _mm256_loadu_si256((const __m256i *) (value + i));
+                nan   = _mm256_cmpgt_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7fffffff)), _mm256_set1_epi32(0x7f800000));
+                round = _mm256_add_epi32(_mm256_set1_epi32(0x7fff), _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1)));
+                bits  = _mm256_blendv_epi8(_mm256_add_epi32(bits, round), _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000)), nan);
+                bits  = _mm256_srli_epi32(bits, 16);
+                bits  = _mm256_permute4x64_epi64(_mm256_packus_epi32(bits, bits), 0x08);
+                _mm_storeu_si128((__m128i *) (output + i), _mm256_castsi256_si128(bits));
+        }
+#endif
+        for (; i < count; i++) {
+                /* store through memcpy like the simd path, output is a raw span */
+                half = linearbuffers_bfloat16_from_float(value[i]);
+                memcpy(output + i, &half, sizeof(half));
+        }
+}
+
+#define linearbuffers_encoder_vector_create_half_type(__type__) \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_create_ ## __type__ ## _from_float (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const float *value, uint64_t count) \
+        { \
+                int rc; \
+                uint16_t *output; \
+                if (encoder == NULL) { \
+                        linearbuffers_errorf("encoder is invalid"); \
+                        goto bail; \
+                } \
+                if (offset == NULL) { \
+                        linearbuffers_errorf("offset is invalid"); \
+                        goto bail; \
+                } \
+                if (value == NULL && \
+                    count != 0) { \
+                        linearbuffers_errorf("value is invalid"); \
+                        goto bail; \
+                } \
+                rc = linearbuffers_encoder_vector_reserve_ ## __type__(encoder, count_type, offset_type, count, &output); \
+                if (rc != 0) { \
+                        linearbuffers_errorf("can not reserve vector"); \
+                        goto bail; \
+                } \
+                linearbuffers_ ## __type__ ## _narrow(output, value, count); \
+                return linearbuffers_encoder_vector_commit_ ## __type__(encoder, offset, count); \
+        bail:   return -1; \
+        }
+
+linearbuffers_encoder_vector_create_half_type(float16);
+linearbuffers_encoder_vector_create_half_type(bfloat16);
+
+static int linearbuffers_encoder_vector_struct_header (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, uint64_t size, uint64_t alignment, uint64_t count, uint64_t *header)
+{
+        int rc;
+        if (count_type > linearbuffers_encoder_count_type_uint64) {
+                linearbuffers_errorf("count type is invalid");
+                goto bail;
+        }
+        if (size == 0) {
+                linearbuffers_errorf("size is invalid");
+                goto bail;
+        }
+        if (alignment == 0 ||
+            (alignment & (alignment - 1)) != 0) {
+                linearbuffers_errorf("alignment is invalid: %" PRIu64 "", alignment);
+                goto bail;
+        }
+        if (count > UINT64_MAX / size) {
+                linearbuffers_errorf("count is invalid");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_vector_align(encoder, linearbuffers_encoder_count_types[count_type].size, MAX(alignment, encoder->alignment), header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align vector");
+                goto bail;
+        }
+        if (*header > linearbuffers_encoder_count_types[count_type].size) {
+                rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset + linearbuffers_encoder_count_types[count_type].size, NULL, *header - linearbuffers_encoder_count_types[count_type].size);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not emit vector padding");
+                        goto bail;
+                }
+        }
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_create_struct (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t size, uint64_t alignment, uint64_t *offset, const void *value, uint64_t count)
+{
+        int rc;
+        uint64_t header;
+        (void) offset_type;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL &&
+            count != 0) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_vector_struct_header(encoder, count_type, size, alignment, count, &header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector header");
+                goto bail;
+        }
+        *offset = encoder->emitter.offset;
+        rc = linearbuffers_encoder_count_types[count_type].emitter(encoder, encoder->emitter.offset, count);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector count");
+                goto bail;
+        }
+        if (count != 0) {
+                rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset + header, value, count * size);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not emit vector values");
+                        goto bail;
+                }
+        }
+        encoder->emitter.offset += header;
+        encoder->emitter.offset += count * size;
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_reserve_struct (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t size, uint64_t alignment, uint64_t count, void **value)
+{
+        int rc;
+        uint64_t header;
+        (void) offset_type;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (value == NULL) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_vector_struct_header(encoder, count_type, size, alignment, count, &header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector header");
+                goto bail;
+        }
+        if (encoder->alignment == 0) {
+                rc = linearbuffers_encoder_payload_align(encoder, header, alignment);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not align vector");
+                        goto bail;
+                }
+        }
+        rc = linearbuffers_encoder_span_reserve(encoder, header, linearbuffers_encoder_count_types[count_type].emitter, count * size, value);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve vector values");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_commit_struct (struct linearbuffers_encoder *encoder, uint64_t size, uint64_t *offset, uint64_t count)
+{
+        int rc;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (encoder->reserve.count_emitter == NULL) {
+                linearbuffers_errorf("logic error: reserve is invalid");
+                goto bail;
+        }
+        if (size == 0 ||
+            count > encoder->reserve.length / size) {
+                linearbuffers_errorf("count is invalid");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_span_commit(encoder, offset, count, count * size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not commit vector values");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+#define LINEARBUFFERS_VECTOR_BLOCK_SIZE         (128)
+
+static inline uint64_t linearbuffers_vector_packed_load (const void *value, uint64_t size, int sign, uint64_t at)
+{
+        switch (size) {
+                case sizeof(uint8_t):
+                        return (sign) ? (uint64_t) ((const int8_t *) value)[at] : ((const uint8_t *) value)[at];
+                case sizeof(uint16_t):
+                        return (sign) ? (uint64_t) ((const int16_t *) value)[at] : ((const uint16_t *) value)[at];
+                case sizeof(uint32_t):
+                        return (sign) ? (uint64_t) ((const int32_t *) value)[at] : ((const uint32_t *) value)[at];
+        }
+        return ((const uint64_t *) value)[at];
+}
+
+static inline void linearbuffers_vector_packed_bits (uint8_t *payload, uint64_t bit, uint64_t value, uint64_t width)
+{
+        uint64_t take;
+        while (width > 0) {
+                take = MIN(8 - (bit % 8), width);
+                payload[bit / 8] |= (value & ((UINT64_C(1) << take) - 1)) << (bit % 8);
+                value >>= take;
+                bit += take;
+                width -= take;
+        }
+}
+
+static inline uint64_t linearbuffers_vector_packed_varint (uint8_t *payload, uint64_t value)
+{
+        uint64_t length;
+        length = 0;
+        while (value >= 0x80) {
+                payload[length++] = (value & 0x7f) | 0x80;
+                value >>= 7;
+        }
+        payload[length++] = value;
+        return length;
+}
+
+static int linearbuffers_encoder_vector_create_packed (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const void *value, uint64_t size, int sign, uint64_t count)
+{
+        int rc;
+        int delta;
+        int varint;
+        uint8_t *buffer;
+        uint64_t i;
+        uint64_t n;
+        uint64_t block;
+        uint64_t blocks;
+        uint64_t header;
+        uint64_t length;
+        uint64_t scratch;
+        uint64_t capacity;
+        uint64_t maximum;
+        uint64_t position;
+        uint64_t reference;
+        uint64_t width;
+        uint64_t count_size;
+        uint64_t offset_size;
+        uint64_t *residual;
+        uint64_t values[LINEARBUFFERS_VECTOR_BLOCK_SIZE];
+
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                return -1;
+        }
+        length = encoder->scratch.length;
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL &&
+            count != 0) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (count_type > linearbuffers_encoder_count_type_uint64) {
+                linearbuffers_errorf("count type is invalid");
+                goto bail;
+        }
+        if (offset_type > linearbuffers_encoder_offset_type_uint64) {
+                linearbuffers_errorf("offset type is invalid");
+                goto bail;
+        }
+        if (encoding > linearbuffers_encoder_vector_encoding_delta_varint) {
+                linearbuffers_errorf("encoding is invalid");
+                goto bail;
+        }
+        if (count > UINT64_MAX / 32) {
+                linearbuffers_errorf("count is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        delta = (encoding == linearbuffers_encoder_vector_encoding_delta_bitpack || encoding == linearbuffers_encoder_vector_encoding_delta_varint);
+        varint = (encoding == linearbuffers_encoder_vector_encoding_varint || encoding == linearbuffers_encoder_vector_encoding_delta_varint);
+        count_size = linearbuffers_encoder_count_types[count_type].size;
+        offset_size = linearbuffers_encoder_offset_types[offset_type].size;
+
+        rc = linearbuffers_encoder_vector_align(encoder, count_size, offset_size, &header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align vector");
+                goto bail;
+        }
+
+        /* layout: count, block offsets, then per block reference value, bit
+         * width and residuals. residuals are value - minimum, or zigzag of
+         * the difference to the previous value for delta encodings. */
+        blocks = (count + LINEARBUFFERS_VECTOR_BLOCK_SIZE - 1) / LINEARBUFFERS_VECTOR_BLOCK_SIZE;
+        capacity = header + blocks * (offset_size + sizeof(uint64_t) + sizeof(uint8_t)) + count * 10 + sizeof(uint64_t);
+        rc = linearbuffers_scratch_push(&encoder->scratch, capacity, &scratch);
+        if (rc != 0) {
+                linearbuffers_errorf("can not push scratch");
+                goto bail;
+        }
+        buffer = encoder->scratch.buffer + scratch;
+        memset(buffer, 0, capacity);
+        rc = linearbuffers_table_buffer_store(buffer, count_size, count);
+        if (rc != 0) {
+                linearbuffers_errorf("can not store vector count");
+                goto bail;
+        }
+
+        position = header + blocks * offset_size;
+        for (block = 0; block < blocks; block++) {
+                n = MIN(count - block * LINEARBUFFERS_VECTOR_BLOCK_SIZE, LINEARBUFFERS_VECTOR_BLOCK_SIZE);
+                for (i = 0; i < n; i++) {
+                        values[i] = linearbuffers_vector_packed_load(value, size, sign, block * LINEARBUFFERS_VECTOR_BLOCK_SIZE + i);
+                }
+                if (delta) {
+                        reference = values[0];
+                        for (i = n - 1; i > 0; i--) {
+                                values[i] = ((values[i] - values[i - 1]) << 1) ^ (uint64_t) (((int64_t) (values[i] - values[i - 1])) >> 63);
+                        }
+                        residual = values + 1;
+                        n -= 1;
+                } else {
+                        reference = values[0];
+                        for (i = 1; i < n; i++) {
+                                if ((sign) ? ((int64_t) values[i] < (int64_t) reference) : (values[i] < reference)) {
+                                        reference = values[i];
+                                }
+                        }
+                        for (i = 0; i < n; i++) {
+                                values[i] -= reference;
+                        }
+                        residual = values;
+                }
+                maximum = 0;
+                for (i = 0; i < n; i++) {
+                        maximum |= residual[i];
+                }
+                width = (maximum == 0) ? 0 : 64 - __builtin_clzll(maximum);
+
+                rc = linearbuffers_table_buffer_store(buffer + header + block * offset_size, offset_size, position);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not store vector block offset");
+                        goto bail;
+                }
+                memcpy(buffer + position, &reference, sizeof(reference));
+                position += sizeof(uint64_t);
+                if (varint) {
+                        buffer[position] = 0;
+                        position += sizeof(uint8_t);
+                        for (i = 0; i < n; i++) {
+                                position += linearbuffers_vector_packed_varint(buffer + position, residual[i]);
+                        }
+                } else {
+                        buffer[position] = width;
+                        position += sizeof(uint8_t);
+                        for (i = 0; i < n; i++) {
+                                linearbuffers_vector_packed_bits(buffer + position, i * width, residual[i], width);
+                        }
+                        position += (n * width + 7) / 8;
+                }
+        }
+        /* trailing padding lets decoders load a full word at any bit offset */
+        position += sizeof(uint64_t);
+
+        *offset = encoder->emitter.offset;
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, buffer, position);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector");
+                goto bail;
+        }
+        encoder->emitter.offset += position;
+        linearbuffers_scratch_pop(&encoder->scratch, length);
+        return 0;
+bail:   linearbuffers_scratch_pop(&encoder->scratch, length);
+        return -1;
+}
+
+#define linearbuffers_encoder_vector_create_packed_type(__type__, __type_t__, __sign__) \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_create_packed_ ## __type__ (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const __type_t__ *value, uint64_t count) \
+        { \
+                return linearbuffers_encoder_vector_create_packed(encoder, count_type, offset_type, encoding, offset, value, sizeof(__type_t__), __sign__, count); \
         }
 
-linearbuffers_encoder_vector_start_scalar_type(int8, int8_t);
-linearbuffers_encoder_vector_start_scalar_type(int16, int16_t);
-linearbuffers_encoder_vector_start_scalar_type(int32, int32_t);
-linearbuffers_encoder_vector_start_scalar_type(int64, int64_t);
+linearbuffers_encoder_vector_create_packed_type(int8, int8_t, 1);
+linearbuffers_encoder_vector_create_packed_type(int16, int16_t, 1);
+linearbuffers_encoder_vector_create_packed_type(int32, int32_t, 1);
+linearbuffers_encoder_vector_create_packed_type(int64, int64_t, 1);
 
-linearbuffers_encoder_vector_start_scalar_type(uint8, uint8_t);
-linearbuffers_encoder_vector_start_scalar_type(uint16, uint16_t);
-linearbuffers_encoder_vector_start_scalar_type(uint32, uint32_t);
-linearbuffers_encoder_vector_start_scalar_type(uint64, uint64_t);
+linearbuffers_encoder_vector_create_packed_type(uint8, uint8_t, 0);
+linearbuffers_encoder_vector_create_packed_type(uint16, uint16_t, 0);
+linearbuffers_encoder_vector_create_packed_type(uint32, uint32_t, 0);
+linearbuffers_encoder_vector_create_packed_type(uint64, uint64_t, 0);
 
-linearbuffers_encoder_vector_start_scalar_type(float, float);
-linearbuffers_encoder_vector_start_scalar_type(double, double);
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_create_bool (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const uint8_t *value, uint64_t count)
+{
+        int rc;
+        uint8_t *buffer;
+        uint64_t i;
+        uint64_t header;
+        uint64_t length;
+        uint64_t scratch;
+        uint64_t position;
+        uint64_t count_size;
+
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                return -1;
+        }
+        length = encoder->scratch.length;
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL &&
+            count != 0) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (count_type > linearbuffers_encoder_count_type_uint64) {
+                linearbuffers_errorf("count type is invalid");
+                goto bail;
+        }
+        if (offset_type > linearbuffers_encoder_offset_type_uint64) {
+                linearbuffers_errorf("offset type is invalid");
+                goto bail;
+        }
+        if (count > UINT64_MAX - 63) {
+                linearbuffers_errorf("count is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        count_size = linearbuffers_encoder_count_types[count_type].size;
+
+        rc = linearbuffers_encoder_vector_align(encoder, count_size, MAX(sizeof(uint64_t), encoder->alignment), &header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align vector");
+                goto bail;
+        }
+
+        /* layout: count, then one bit per element rounded up to whole 64 bit
+         * words so decoders can popcount and scan a word at a time. */
+        position = header + ((count + 63) / 64) * sizeof(uint64_t);
+        rc = linearbuffers_scratch_push(&encoder->scratch, position, &scratch);
+        if (rc != 0) {
+                linearbuffers_errorf("can not push scratch");
+                goto bail;
+        }
+        buffer = encoder->scratch.buffer + scratch;
+        memset(buffer, 0, position);
+        rc = linearbuffers_table_buffer_store(buffer, count_size, count);
+        if (rc != 0) {
+                linearbuffers_errorf("can not store vector count");
+                goto bail;
+        }
+        for (i = 0; i < count; i++) {
+                if (value[i]) {
+                        buffer[header + i / 8] |= (1 << (i % 8));
+                }
+        }
+
+        *offset = encoder->emitter.offset;
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, buffer, position);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector");
+                goto bail;
+        }
+        encoder->emitter.offset += position;
+        linearbuffers_scratch_pop(&encoder->scratch, length);
+        return 0;
+bail:   linearbuffers_scratch_pop(&encoder->scratch, length);
+        return -1;
+}
 
 #define linearbuffers_encoder_vector_start_type(__type__) \
         __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_start_ ## __type__ (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type) \
         { \
                 int rc; \
+                uint64_t header; \
                 struct linearbuffers_entry *entry; \
                 entry = NULL; \
                 if (encoder == NULL) { \
@@ -1120,7 +3523,7 @@ linearbuffers_encoder_vector_start_scalar_type(double, double);
                         linearbuffers_errorf("logic error: entries is empty"); \
                         goto bail; \
                 } \
-                entry = linearbuffers_pool_malloc(&encoder->pool.entry); \
+                entry = linearbuffers_entry_create(encoder); \
                 if (entry == NULL) { \
                         linearbuffers_errorf("can not allocate memory"); \
                         goto bail; \
@@ -1133,29 +3536,36 @@ linearbuffers_encoder_vector_start_scalar_type(double, double);
                 entry->count_emitter = linearbuffers_encoder_count_types[count_type].emitter; \
                 entry->offset_size = linearbuffers_encoder_offset_types[offset_type].size; \
                 entry->offset_emitter = linearbuffers_encoder_offset_types[offset_type].emitter; \
-                rc = linearbuffers_offset_table_init(&encoder->pool.offset, &entry->u.vector.offset, offset_type); \
+                rc = linearbuffers_offset_table_init(&encoder->scratch, &entry->u.vector.offset, offset_type); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not init table present"); \
                         goto bail; \
                 } \
+                rc = linearbuffers_encoder_vector_align(encoder, entry->count_size, entry->offset_size, &header); \
+                if (rc != 0) { \
+                        linearbuffers_errorf("can not align vector"); \
+                        goto bail; \
+                } \
                 entry->offset = encoder->emitter.offset; \
-                rc = encoder->emitter.function(encoder->emitter.context, entry->offset, NULL, entry->count_size + entry->offset_size); \
+                rc = linearbuffers_encoder_emit(encoder, entry->offset, NULL, header + entry->offset_size); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector place"); \
                         goto bail; \
                 } \
-                encoder->emitter.offset += entry->count_size + entry->offset_size; \
-                TAILQ_INSERT_TAIL(&encoder->entries, entry, entries); \
+                encoder->emitter.offset += header + entry->offset_size; \
+                linearbuffers_entry_push(encoder, entry); \
                 return 0; \
         bail:   if (entry != NULL) { \
-                        linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry); \
+                        linearbuffers_entry_destroy(encoder, entry); \
                 } \
+                linearbuffers_entry_fail(encoder); \
                 return -1; \
         } \
         \
         __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_end_ ## __type__ (struct linearbuffers_encoder *encoder, uint64_t *offset) \
         { \
                 int rc; \
+                uint64_t header; \
                 struct linearbuffers_entry *entry; \
                 uint64_t offset_table; \
                 if (encoder == NULL) { \
@@ -1171,7 +3581,8 @@ linearbuffers_encoder_vector_start_scalar_type(double, double);
                         goto bail; \
                 } \
                 entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
-                if (entry == NULL) { \
+                if (entry == NULL || \
+                    entry != encoder->current) { \
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
@@ -1183,25 +3594,34 @@ linearbuffers_encoder_vector_start_scalar_type(double, double);
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
+                header = entry->count_size; \
+                if (encoder->alignment != 0) { \
+                        rc = linearbuffers_encoder_pad(encoder, entry->offset_size); \
+                        if (rc != 0) { \
+                                linearbuffers_errorf("can not align offset table"); \
+                                goto bail; \
+                        } \
+                        header = linearbuffers_encoder_aligned(entry->count_size, entry->offset_size); \
+                } \
                 *offset = entry->offset; \
                 offset_table = encoder->emitter.offset - entry->offset; \
-                rc = entry->count_emitter(encoder->emitter.function, encoder->emitter.context, entry->offset, entry->u.vector.elements); \
+                rc = entry->count_emitter(encoder, entry->offset, entry->u.vector.elements); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector count"); \
                         goto bail; \
                 } \
-                rc = entry->offset_emitter(encoder->emitter.function, encoder->emitter.context, entry->offset + entry->count_size, offset_table); \
+                rc = entry->offset_emitter(encoder, entry->offset + header, offset_table); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector offset"); \
                         goto bail; \
                 } \
-                rc = linearbuffers_offset_table_emit(&entry->u.vector.offset, encoder->emitter.function, encoder->emitter.context, &encoder->emitter.offset, offset_table + entry->offset); \
+                rc = linearbuffers_offset_table_emit(&encoder->scratch, &entry->u.vector.offset, encoder, &encoder->emitter.offset, offset_table + entry->offset); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit offset table"); \
                         goto bail; \
                 } \
-                TAILQ_REMOVE(&encoder->entries, entry, entries); \
-                linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry); \
+                linearbuffers_entry_remove(encoder, entry); \
+                linearbuffers_entry_destroy(encoder, entry); \
                 return 0; \
         bail:   return -1; \
         } \
@@ -1219,7 +3639,8 @@ linearbuffers_encoder_vector_start_scalar_type(double, double);
                         goto bail; \
                 } \
                 entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
-                if (entry == NULL) { \
+                if (entry == NULL || \
+                    entry != encoder->current) { \
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
@@ -1231,21 +3652,20 @@ linearbuffers_encoder_vector_start_scalar_type(double, double);
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
-                rc = encoder->emitter.function(encoder->emitter.context, encoder->emitter.offset, NULL, entry->offset - encoder->emitter.offset); \
+                rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, NULL, entry->offset - encoder->emitter.offset); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not emit vector cancel"); \
                         goto bail; \
                 } \
                 encoder->emitter.offset = entry->offset; \
-                TAILQ_REMOVE(&encoder->entries, entry, entries); \
-                linearbuffers_entry_destroy(&encoder->pool.entry, &encoder->pool.present, &encoder->pool.offset, entry); \
+                linearbuffers_entry_remove(encoder, entry); \
+                linearbuffers_entry_destroy(encoder, entry); \
                 return 0; \
         bail:   return -1; \
         } \
         \
         __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_push_ ## __type__ (struct linearbuffers_encoder *encoder, uint64_t value) \
         { \
-                int rc; \
                 struct linearbuffers_entry *entry; \
                 if (encoder == NULL) { \
                         linearbuffers_errorf("encoder is invalid"); \
@@ -1256,7 +3676,8 @@ linearbuffers_encoder_vector_start_scalar_type(double, double);
                         goto bail; \
                 } \
                 entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries); \
-                if (entry == NULL) { \
+                if (entry == NULL || \
+                    entry != encoder->current) { \
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
@@ -1268,15 +3689,547 @@ linearbuffers_encoder_vector_start_scalar_type(double, double);
                         linearbuffers_errorf("logic error: entry is invalid"); \
                         goto bail; \
                 } \
-                rc = linearbuffers_offset_table_push(&entry->u.vector.offset, value, &encoder->pool.offset); \
+                return linearbuffers_encoder_vector_push_ ## __type__ ## _unchecked(encoder, value); \
+        bail:   return -1; \
+        } \
+        \
+        __attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_push_ ## __type__ ## _unchecked (struct linearbuffers_encoder *encoder, uint64_t value) \
+        { \
+                int rc; \
+                if (encoder->current == NULL || \
+                    encoder->current->type != linearbuffers_entry_type_vector || \
+                    encoder->current->u.vector.type != linearbuffers_vector_type_ ## __type__) { \
+                        linearbuffers_errorf("logic error: entry is invalid"); \
+                        return -1; \
+                } \
+                rc = linearbuffers_offset_table_push(&encoder->scratch, &encoder->current->u.vector.offset, value); \
                 if (rc != 0) { \
                         linearbuffers_errorf("can not push element offset"); \
-                        goto bail; \
+                        return -1; \
                 } \
-                entry->u.vector.elements += 1; \
+                encoder->current->u.vector.elements += 1; \
                 return 0; \
-        bail:   return -1; \
         }
 
 linearbuffers_encoder_vector_start_type(string);
 linearbuffers_encoder_vector_start_type(table);
+
+static int linearbuffers_encoder_vector_create_strings (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count)
+{
+        const char _null = 0;
+        int rc;
+        uint64_t i;
+        uint64_t l;
+        uint64_t o;
+        uint64_t header;
+        uint64_t count_size;
+        uint64_t offset_size;
+        struct linearbuffers_offset_table table;
+        memset(&table, 0, sizeof(struct linearbuffers_offset_table));
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL && count > 0) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        count_size = linearbuffers_encoder_count_types[count_type].size;
+        offset_size = linearbuffers_encoder_offset_types[offset_type].size;
+        rc = linearbuffers_offset_table_init(&encoder->scratch, &table, offset_type);
+        if (rc != 0) {
+                linearbuffers_errorf("can not init offset table");
+                goto bail;
+        }
+        rc = linearbuffers_scratch_reserve(&encoder->scratch, table.offset + count * offset_size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve offset table");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_vector_align(encoder, count_size, offset_size, &header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align vector");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_count_types[count_type].emitter(encoder, encoder->emitter.offset, count);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector count");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset + count_size, NULL, header - count_size + offset_size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector place");
+                goto bail;
+        }
+        o = encoder->emitter.offset + header + offset_size;
+        for (i = 0; i < count; i++) {
+                if (value[i] == NULL) {
+                        linearbuffers_errorf("value is invalid");
+                        goto bail;
+                }
+                l = (length == NULL) ? strlen(value[i]) : length[i];
+                if (encoder->string.prefix_size != 0) {
+                        if (encoder->alignment != 0 &&
+                            linearbuffers_encoder_aligned(o, encoder->string.prefix_size) != o) {
+                                rc = linearbuffers_encoder_emit(encoder, o, NULL, linearbuffers_encoder_aligned(o, encoder->string.prefix_size) - o);
+                                if (rc != 0) {
+                                        linearbuffers_errorf("can not emit padding");
+                                        goto bail;
+                                }
+                                o = linearbuffers_encoder_aligned(o, encoder->string.prefix_size);
+                        }
+                        rc = encoder->string.prefix_emitter(encoder, o, l);
+                        if (rc != 0) {
+                                linearbuffers_errorf("can not emit string length");
+                                goto bail;
+                        }
+                        o += encoder->string.prefix_size;
+                }
+                rc = linearbuffers_offset_table_push(&encoder->scratch, &table, o);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not push element offset");
+                        goto bail;
+                }
+                if (length == NULL) {
+                        rc = linearbuffers_encoder_emit(encoder, o, value[i], l + 1);
+                } else {
+                        rc  = linearbuffers_encoder_emit(encoder, o, value[i], l);
+                        rc |= linearbuffers_encoder_emit(encoder, o + l, &_null, 1);
+                }
+                if (rc != 0) {
+                        linearbuffers_errorf("can not emit element");
+                        goto bail;
+                }
+                o += l + 1;
+        }
+        if (encoder->alignment != 0 &&
+            linearbuffers_encoder_aligned(o, offset_size) != o) {
+                rc = linearbuffers_encoder_emit(encoder, o, NULL, linearbuffers_encoder_aligned(o, offset_size) - o);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not emit padding");
+                        goto bail;
+                }
+                o = linearbuffers_encoder_aligned(o, offset_size);
+        }
+        *offset = encoder->emitter.offset;
+        rc = linearbuffers_encoder_offset_types[offset_type].emitter(encoder, encoder->emitter.offset + header, o - encoder->emitter.offset);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector offset");
+                goto bail;
+        }
+        rc = linearbuffers_offset_table_emit(&encoder->scratch, &table, encoder, &o, o);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit offset table");
+                goto bail;
+        }
+        encoder->emitter.offset = o;
+        linearbuffers_offset_table_uninit(&encoder->scratch, &table);
+        return 0;
+bail:   if (encoder != NULL) {
+                linearbuffers_offset_table_uninit(&encoder->scratch, &table);
+        }
+        return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_create_string (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, uint64_t count)
+{
+        return linearbuffers_encoder_vector_create_strings(encoder, count_type, offset_type, offset, value, NULL, count);
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_ncreate_string (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count)
+{
+        if (length == NULL && count > 0) {
+                linearbuffers_errorf("length is invalid");
+                return -1;
+        }
+        return linearbuffers_encoder_vector_create_strings(encoder, count_type, offset_type, offset, value, length, count);
+}
+
+static int linearbuffers_encoder_vector_create_dictionaries (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count)
+{
+        int rc;
+        uint64_t i;
+        uint64_t h;
+        uint64_t l;
+        uint64_t o;
+        uint64_t slot;
+        uint64_t slots;
+        uint64_t start;
+        uint64_t header;
+        uint64_t uniques;
+        uint64_t index_size;
+        uint64_t count_size;
+        uint64_t offset_size;
+        uint64_t dictionary;
+        uint64_t scratch;
+        uint64_t scratch_length;
+        uint64_t *table;
+        uint64_t *indices;
+        uint64_t *lengths;
+        const char **values;
+        uint8_t index8;
+        uint16_t index16;
+        uint32_t index32;
+        scratch_length = UINT64_MAX;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL && count > 0) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (count > UINT32_MAX) {
+                linearbuffers_errorf("count is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        count_size = linearbuffers_encoder_count_types[count_type].size;
+        offset_size = linearbuffers_encoder_offset_types[offset_type].size;
+        scratch_length = encoder->scratch.length;
+
+        /* open addressing hash table of unique index + 1, followed by the
+         * element indices and the unique values with their lengths */
+        slots = 16;
+        while (slots < count * 2) {
+                slots *= 2;
+        }
+        rc = linearbuffers_scratch_push(&encoder->scratch, (slots + count * 3) * sizeof(uint64_t), &scratch);
+        if (rc != 0) {
+                linearbuffers_errorf("can not push scratch");
+                goto bail;
+        }
+        table = (uint64_t *) (encoder->scratch.buffer + scratch);
+        memset(table, 0, slots * sizeof(uint64_t));
+        indices = table + slots;
+        lengths = indices + count;
+        values = (const char **) (lengths + count);
+
+        uniques = 0;
+        for (i = 0; i < count; i++) {
+                if (value[i] == NULL) {
+                        linearbuffers_errorf("value is invalid");
+                        goto bail;
+                }
+                l = (length == NULL) ? strlen(value[i]) : length[i];
+                h = UINT64_C(0xcbf29ce484222325);
+                for (o = 0; o < l; o++) {
+                        h ^= (uint8_t) value[i][o];
+                        h *= UINT64_C(0x100000001b3);
+                }
+                for (slot = h & (slots - 1); table[slot] != 0; slot = (slot + 1) & (slots - 1)) {
+                        if (lengths[table[slot] - 1] == l &&
+                            memcmp(values[table[slot] - 1], value[i], l) == 0) {
+                                break;
+                        }
+                }
+                if (table[slot] == 0) {
+                        values[uniques] = value[i];
+                        lengths[uniques] = l;
+                        uniques += 1;
+                        table[slot] = uniques;
+                }
+                indices[i] = table[slot] - 1;
+        }
+        if (uniques <= UINT8_MAX + 1) {
+                index_size = sizeof(uint8_t);
+        } else if (uniques <= UINT16_MAX + 1) {
+                index_size = sizeof(uint16_t);
+        } else {
+                index_size = sizeof(uint32_t);
+        }
+
+        /* the string vector below pushes its offset table on top of this
+         * one, reserve for it now so values and lengths do not move */
+        rc = linearbuffers_scratch_reserve(&encoder->scratch, encoder->scratch.length + LINEARBUFFERS_SCRATCH_ALIGN + uniques * offset_size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve scratch");
+                goto bail;
+        }
+        table = (uint64_t *) (encoder->scratch.buffer + scratch);
+        indices = table + slots;
+        lengths = indices + count;
+        values = (const char **) (lengths + count);
+
+        /* layout: count, dictionary offset, index size, indices, then the
+         * unique values as a regular string vector */
+        rc = linearbuffers_encoder_vector_align(encoder, count_size, offset_size, &header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align vector");
+                goto bail;
+        }
+        start = encoder->emitter.offset;
+        o = header + offset_size + sizeof(uint8_t);
+        if (encoder->alignment != 0) {
+                o = linearbuffers_encoder_aligned(o, index_size);
+        }
+        rc = linearbuffers_encoder_count_types[count_type].emitter(encoder, start, count);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector count");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_emit(encoder, start + count_size, NULL, header - count_size + offset_size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector place");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_uint8_emitter(encoder, start + header + offset_size, index_size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit index size");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_emit(encoder, start + header + offset_size + sizeof(uint8_t), NULL, o - (header + offset_size + sizeof(uint8_t)));
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit padding");
+                goto bail;
+        }
+        for (i = 0; i < count; i++) {
+                if (index_size == sizeof(uint8_t)) {
+                        index8 = indices[i];
+                        memcpy(((uint8_t *) indices) + i * index_size, &index8, index_size);
+                } else if (index_size == sizeof(uint16_t)) {
+                        index16 = indices[i];
+                        memcpy(((uint8_t *) indices) + i * index_size, &index16, index_size);
+                } else {
+                        index32 = indices[i];
+                        memcpy(((uint8_t *) indices) + i * index_size, &index32, index_size);
+                }
+        }
+        rc = linearbuffers_encoder_emit(encoder, start + o, indices, count * index_size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit indices");
+                goto bail;
+        }
+        encoder->emitter.offset = start + o + count * index_size;
+
+        rc = linearbuffers_encoder_vector_create_strings(encoder, count_type, offset_type, &dictionary, values, lengths, uniques);
+        if (rc != 0) {
+                linearbuffers_errorf("can not create dictionary");
+                goto bail;
+        }
+        rc = linearbuffers_encoder_offset_types[offset_type].emitter(encoder, start + header, dictionary - start);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit dictionary offset");
+                goto bail;
+        }
+        *offset = start;
+        linearbuffers_scratch_pop(&encoder->scratch, scratch_length);
+        return 0;
+bail:   if (scratch_length != UINT64_MAX) {
+                linearbuffers_scratch_pop(&encoder->scratch, scratch_length);
+        }
+        return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_create_dictionary (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, uint64_t count)
+{
+        return linearbuffers_encoder_vector_create_dictionaries(encoder, count_type, offset_type, offset, value, NULL, count);
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_ncreate_dictionary (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count)
+{
+        if (length == NULL && count > 0) {
+                linearbuffers_errorf("length is invalid");
+                return -1;
+        }
+        return linearbuffers_encoder_vector_create_dictionaries(encoder, count_type, offset_type, offset, value, length, count);
+}
+
+#define LINEARBUFFERS_VECTOR_RESTART_INTERVAL   (16)
+
+static int linearbuffers_encoder_vector_create_front_codeds (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count)
+{
+        int rc;
+        uint8_t *buffer;
+        uint64_t i;
+        uint64_t l;
+        uint64_t p;
+        uint64_t shared;
+        uint64_t header;
+        uint64_t scratch;
+        uint64_t capacity;
+        uint64_t position;
+        uint64_t restarts;
+        uint64_t count_size;
+        uint64_t offset_size;
+        uint64_t scratch_length;
+
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                return -1;
+        }
+        scratch_length = encoder->scratch.length;
+        if (offset == NULL) {
+                linearbuffers_errorf("offset is invalid");
+                goto bail;
+        }
+        if (value == NULL && count > 0) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        count_size = linearbuffers_encoder_count_types[count_type].size;
+        offset_size = linearbuffers_encoder_offset_types[offset_type].size;
+
+        capacity = 0;
+        for (i = 0; i < count; i++) {
+                if (value[i] == NULL) {
+                        linearbuffers_errorf("value is invalid");
+                        goto bail;
+                }
+                l = (length == NULL) ? strlen(value[i]) : length[i];
+                if (i > 0) {
+                        p = (length == NULL) ? strlen(value[i - 1]) : length[i - 1];
+                        rc = memcmp(value[i - 1], value[i], MIN(p, l));
+                        if (rc > 0 || (rc == 0 && p > l)) {
+                                linearbuffers_errorf("value is not sorted: %" PRIu64 "", i);
+                                goto bail;
+                        }
+                }
+                capacity += l + 20;
+        }
+
+        rc = linearbuffers_encoder_vector_align(encoder, count_size, offset_size, &header);
+        if (rc != 0) {
+                linearbuffers_errorf("can not align vector");
+                goto bail;
+        }
+
+        /* layout: count, restart offsets, then per element the length
+         * shared with the previous element, suffix length and suffix. every
+         * restart element is stored in full. */
+        restarts = (count + LINEARBUFFERS_VECTOR_RESTART_INTERVAL - 1) / LINEARBUFFERS_VECTOR_RESTART_INTERVAL;
+        capacity += header + restarts * offset_size;
+        rc = linearbuffers_scratch_push(&encoder->scratch, capacity, &scratch);
+        if (rc != 0) {
+                linearbuffers_errorf("can not push scratch");
+                goto bail;
+        }
+        buffer = encoder->scratch.buffer + scratch;
+        memset(buffer, 0, header + restarts * offset_size);
+        rc = linearbuffers_table_buffer_store(buffer, count_size, count);
+        if (rc != 0) {
+                linearbuffers_errorf("can not store vector count");
+                goto bail;
+        }
+
+        p = 0;
+        position = header + restarts * offset_size;
+        for (i = 0; i < count; i++) {
+                l = (length == NULL) ? strlen(value[i]) : length[i];
+                shared = 0;
+                if ((i % LINEARBUFFERS_VECTOR_RESTART_INTERVAL) == 0) {
+                        rc = linearbuffers_table_buffer_store(buffer + header + (i / LINEARBUFFERS_VECTOR_RESTART_INTERVAL) * offset_size, offset_size, position);
+                        if (rc != 0) {
+                                linearbuffers_errorf("can not store vector restart offset");
+                                goto bail;
+                        }
+                } else {
+                        while (shared < MIN(p, l) &&
+                               value[i - 1][shared] == value[i][shared]) {
+                                shared += 1;
+                        }
+                }
+                position += linearbuffers_vector_packed_varint(buffer + position, shared);
+                position += linearbuffers_vector_packed_varint(buffer + position, l - shared);
+                memcpy(buffer + position, value[i] + shared, l - shared);
+                position += l - shared;
+                p = l;
+        }
+
+        *offset = encoder->emitter.offset;
+        rc = linearbuffers_encoder_emit(encoder, encoder->emitter.offset, buffer, position);
+        if (rc != 0) {
+                linearbuffers_errorf("can not emit vector");
+                goto bail;
+        }
+        encoder->emitter.offset += position;
+        linearbuffers_scratch_pop(&encoder->scratch, scratch_length);
+        return 0;
+bail:   linearbuffers_scratch_pop(&encoder->scratch, scratch_length);
+        return -1;
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_create_front_coded (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, uint64_t count)
+{
+        return linearbuffers_encoder_vector_create_front_codeds(encoder, count_type, offset_type, offset, value, NULL, count);
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_ncreate_front_coded (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count)
+{
+        if (length == NULL && count > 0) {
+                linearbuffers_errorf("length is invalid");
+                return -1;
+        }
+        return linearbuffers_encoder_vector_create_front_codeds(encoder, count_type, offset_type, offset, value, length, count);
+}
+
+__attribute__ ((__visibility__("default"))) int linearbuffers_encoder_vector_push_tables (struct linearbuffers_encoder *encoder, const uint64_t *value, uint64_t count)
+{
+        int rc;
+        uint64_t i;
+        struct linearbuffers_entry *entry;
+        if (encoder == NULL) {
+                linearbuffers_errorf("encoder is invalid");
+                goto bail;
+        }
+        if (value == NULL && count > 0) {
+                linearbuffers_errorf("value is invalid");
+                goto bail;
+        }
+        if (TAILQ_EMPTY(&encoder->entries)) {
+                linearbuffers_errorf("logic error: entries is empty");
+                goto bail;
+        }
+        entry = TAILQ_LAST(&encoder->entries, linearbuffers_entries);
+        if (entry == NULL ||
+            entry != encoder->current) {
+                linearbuffers_errorf("logic error: entry is invalid");
+                goto bail;
+        }
+        if (entry->type != linearbuffers_entry_type_vector) {
+                linearbuffers_errorf("logic error: entry is invalid");
+                goto bail;
+        }
+        if (entry->u.vector.type != linearbuffers_vector_type_table) {
+                linearbuffers_errorf("logic error: entry is invalid");
+                goto bail;
+        }
+        rc = linearbuffers_scratch_reserve(&encoder->scratch, entry->u.vector.offset.offset + (entry->u.vector.offset.count + count) * entry->offset_size);
+        if (rc != 0) {
+                linearbuffers_errorf("can not reserve offset table");
+                goto bail;
+        }
+        for (i = 0; i < count; i++) {
+                if (value[i] <= entry->offset) {
+                        linearbuffers_errorf("value is invalid");
+                        goto bail;
+                }
+                rc = linearbuffers_offset_table_push(&encoder->scratch, &entry->u.vector.offset, value[i]);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not push element offset");
+                        goto bail;
+                }
+                entry->u.vector.elements += 1;
+        }
+        return 0;
+bail:   return -1;
+}
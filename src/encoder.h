@@ -22,11 +22,54 @@ enum linearbuffers_encoder_offset_type {
 	linearbuffers_encoder_offset_type_uint64
 };
 
+enum linearbuffers_encoder_vector_encoding {
+	linearbuffers_encoder_vector_encoding_bitpack,
+	linearbuffers_encoder_vector_encoding_delta_bitpack,
+	linearbuffers_encoder_vector_encoding_varint,
+	linearbuffers_encoder_vector_encoding_delta_varint
+};
+
+enum linearbuffers_encoder_string_type {
+	linearbuffers_encoder_string_type_terminated,
+	linearbuffers_encoder_string_type_prefixed
+};
+
+struct linearbuffers_encoder_iovec {
+	const void *base;
+	uint64_t length;
+};
+
+struct linearbuffers_encoder_table_field {
+	uint64_t offset;
+	uint64_t size;
+	uint64_t alignment;
+	int promote;
+};
+
 struct linearbuffers_encoder_create_options {
 	struct {
 		int (*function) (void *context, uint64_t offset, const void *buffer, int64_t length);
 		void *context;
 	} emitter;
+	struct {
+		void *buffer;
+		uint64_t size;
+	} output;
+	struct {
+		void *buffer;
+		uint64_t size;
+	} arena;
+	struct {
+		void * (*malloc) (void *context, uint64_t size);
+		void * (*realloc) (void *context, void *ptr, uint64_t size);
+		void (*free) (void *context, void *ptr);
+		void * (*aligned_malloc) (void *context, uint64_t alignment, uint64_t size);
+		void *context;
+	} allocator;
+	struct {
+		uint64_t watermark;
+		int adaptive;
+	} memory;
 };
 
 struct linearbuffers_encoder_reset_options {
@@ -39,9 +82,18 @@ struct linearbuffers_encoder_reset_options {
 struct linearbuffers_encoder * linearbuffers_encoder_create (struct linearbuffers_encoder_create_options *options);
 void linearbuffers_encoder_destroy (struct linearbuffers_encoder *encoder);
 
+uint64_t linearbuffers_encoder_sizeof (void);
+struct linearbuffers_encoder * linearbuffers_encoder_init (void *buffer, uint64_t size, struct linearbuffers_encoder_create_options *options);
+void linearbuffers_encoder_uninit (struct linearbuffers_encoder *encoder);
+
 int linearbuffers_encoder_reset (struct linearbuffers_encoder *encoder, struct linearbuffers_encoder_reset_options *options);
+int linearbuffers_encoder_reserve (struct linearbuffers_encoder *encoder, uint64_t size);
+int linearbuffers_encoder_set_alignment (struct linearbuffers_encoder *encoder, uint64_t alignment);
+int linearbuffers_encoder_set_string_type (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_string_type string_type, enum linearbuffers_encoder_count_type count_type);
 
 int linearbuffers_encoder_table_start (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size);
+int linearbuffers_encoder_table_start_sparse (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size, const struct linearbuffers_encoder_table_field *fields);
+int linearbuffers_encoder_table_start_promoted (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t elements, uint64_t size, const struct linearbuffers_encoder_table_field *fields);
 int linearbuffers_encoder_table_end (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_table_cancel (struct linearbuffers_encoder *encoder);
 
@@ -57,87 +109,200 @@ int linearbuffers_encoder_table_set_uint64 (struct linearbuffers_encoder *encode
 
 int linearbuffers_encoder_table_set_float (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, float value);
 int linearbuffers_encoder_table_set_double (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, double value);
+int linearbuffers_encoder_table_set_float16 (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint16_t value);
+int linearbuffers_encoder_table_set_bfloat16 (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint16_t value);
 
 int linearbuffers_encoder_table_set_string (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
 int linearbuffers_encoder_table_set_table (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
 int linearbuffers_encoder_table_set_vector (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
+int linearbuffers_encoder_table_set_bytes (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
+int linearbuffers_encoder_table_set_struct (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, const void *value, uint64_t size);
+int linearbuffers_encoder_table_set_bool (struct linearbuffers_encoder *encoder, uint64_t element, int value);
+
+int linearbuffers_encoder_table_set_int8_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, int8_t value);
+int linearbuffers_encoder_table_set_int16_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, int16_t value);
+int linearbuffers_encoder_table_set_int32_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, int32_t value);
+int linearbuffers_encoder_table_set_int64_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, int64_t value);
+
+int linearbuffers_encoder_table_set_uint8_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint8_t value);
+int linearbuffers_encoder_table_set_uint16_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint16_t value);
+int linearbuffers_encoder_table_set_uint32_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint32_t value);
+int linearbuffers_encoder_table_set_uint64_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
+
+int linearbuffers_encoder_table_set_float_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, float value);
+int linearbuffers_encoder_table_set_double_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, double value);
+int linearbuffers_encoder_table_set_float16_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint16_t value);
+int linearbuffers_encoder_table_set_bfloat16_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint16_t value);
+
+int linearbuffers_encoder_table_set_string_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
+int linearbuffers_encoder_table_set_table_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
+int linearbuffers_encoder_table_set_vector_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
+int linearbuffers_encoder_table_set_bytes_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, uint64_t value);
+int linearbuffers_encoder_table_set_struct_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, uint64_t offset, const void *value, uint64_t size);
+int linearbuffers_encoder_table_set_bool_unchecked (struct linearbuffers_encoder *encoder, uint64_t element, int value);
 
 int linearbuffers_encoder_string_create (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value);
 int linearbuffers_encoder_string_createf (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value, ...)  __attribute__((format(printf, 3, 4)));
 int linearbuffers_encoder_string_createv (struct linearbuffers_encoder *encoder, uint64_t *offset, const char *value, va_list va);
 int linearbuffers_encoder_string_ncreate (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t n, const char *value);
+int linearbuffers_encoder_string_reserve (struct linearbuffers_encoder *encoder, uint64_t n, char **value);
+int linearbuffers_encoder_string_commit (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t n);
+
+int linearbuffers_encoder_bytes_create (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, uint64_t alignment, uint64_t *offset, const void *value, uint64_t length);
+int linearbuffers_encoder_bytes_reserve (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, uint64_t alignment, uint64_t length, void **value);
+int linearbuffers_encoder_bytes_commit (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t length);
 
 int linearbuffers_encoder_vector_start_int8 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_int8 (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_int8 (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_int8 (struct linearbuffers_encoder *encoder, int8_t value);
+int linearbuffers_encoder_vector_push_int8_unchecked (struct linearbuffers_encoder *encoder, int8_t value);
 int linearbuffers_encoder_vector_create_int8 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const int8_t *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_int8 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, int8_t **value);
+int linearbuffers_encoder_vector_commit_int8 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_int16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_int16 (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_int16 (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_int16 (struct linearbuffers_encoder *encoder, int16_t value);
+int linearbuffers_encoder_vector_push_int16_unchecked (struct linearbuffers_encoder *encoder, int16_t value);
 int linearbuffers_encoder_vector_create_int16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const int16_t *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_int16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, int16_t **value);
+int linearbuffers_encoder_vector_commit_int16 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_int32 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_int32 (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_int32 (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_int32 (struct linearbuffers_encoder *encoder, int32_t value);
+int linearbuffers_encoder_vector_push_int32_unchecked (struct linearbuffers_encoder *encoder, int32_t value);
 int linearbuffers_encoder_vector_create_int32 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const int32_t *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_int32 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, int32_t **value);
+int linearbuffers_encoder_vector_commit_int32 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_int64 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_int64 (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_int64 (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_int64 (struct linearbuffers_encoder *encoder, int64_t value);
+int linearbuffers_encoder_vector_push_int64_unchecked (struct linearbuffers_encoder *encoder, int64_t value);
 int linearbuffers_encoder_vector_create_int64 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const int64_t *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_int64 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, int64_t **value);
+int linearbuffers_encoder_vector_commit_int64 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_uint8 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_uint8 (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_uint8 (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_uint8 (struct linearbuffers_encoder *encoder, uint8_t value);
+int linearbuffers_encoder_vector_push_uint8_unchecked (struct linearbuffers_encoder *encoder, uint8_t value);
 int linearbuffers_encoder_vector_create_uint8 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const uint8_t *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_uint8 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, uint8_t **value);
+int linearbuffers_encoder_vector_commit_uint8 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_uint16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_uint16 (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_uint16 (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_uint16 (struct linearbuffers_encoder *encoder, uint16_t value);
+int linearbuffers_encoder_vector_push_uint16_unchecked (struct linearbuffers_encoder *encoder, uint16_t value);
 int linearbuffers_encoder_vector_create_uint16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const uint16_t *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_uint16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, uint16_t **value);
+int linearbuffers_encoder_vector_commit_uint16 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_uint32 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_uint32 (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_uint32 (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_uint32 (struct linearbuffers_encoder *encoder, uint32_t value);
+int linearbuffers_encoder_vector_push_uint32_unchecked (struct linearbuffers_encoder *encoder, uint32_t value);
 int linearbuffers_encoder_vector_create_uint32 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const uint32_t *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_uint32 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, uint32_t **value);
+int linearbuffers_encoder_vector_commit_uint32 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_uint64 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_uint64 (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_uint64 (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_uint64 (struct linearbuffers_encoder *encoder, uint64_t value);
+int linearbuffers_encoder_vector_push_uint64_unchecked (struct linearbuffers_encoder *encoder, uint64_t value);
 int linearbuffers_encoder_vector_create_uint64 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const uint64_t *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_uint64 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, uint64_t **value);
+int linearbuffers_encoder_vector_commit_uint64 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_float (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_float (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_float (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_float (struct linearbuffers_encoder *encoder, float value);
+int linearbuffers_encoder_vector_push_float_unchecked (struct linearbuffers_encoder *encoder, float value);
 int linearbuffers_encoder_vector_create_float (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const float *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_float (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, float **value);
+int linearbuffers_encoder_vector_commit_float (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
 
 int linearbuffers_encoder_vector_start_double (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_double (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_double (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_double (struct linearbuffers_encoder *encoder, double value);
+int linearbuffers_encoder_vector_push_double_unchecked (struct linearbuffers_encoder *encoder, double value);
 int linearbuffers_encoder_vector_create_double (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const double *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_double (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, double **value);
+int linearbuffers_encoder_vector_commit_double (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
+
+int linearbuffers_encoder_vector_start_float16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
+int linearbuffers_encoder_vector_end_float16 (struct linearbuffers_encoder *encoder, uint64_t *offset);
+int linearbuffers_encoder_vector_cancel_float16 (struct linearbuffers_encoder *encoder);
+int linearbuffers_encoder_vector_push_float16 (struct linearbuffers_encoder *encoder, uint16_t value);
+int linearbuffers_encoder_vector_push_float16_unchecked (struct linearbuffers_encoder *encoder, uint16_t value);
+int linearbuffers_encoder_vector_create_float16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const uint16_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_float16_from_float (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const float *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_float16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, uint16_t **value);
+int linearbuffers_encoder_vector_commit_float16 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
+
+int linearbuffers_encoder_vector_start_bfloat16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
+int linearbuffers_encoder_vector_end_bfloat16 (struct linearbuffers_encoder *encoder, uint64_t *offset);
+int linearbuffers_encoder_vector_cancel_bfloat16 (struct linearbuffers_encoder *encoder);
+int linearbuffers_encoder_vector_push_bfloat16 (struct linearbuffers_encoder *encoder, uint16_t value);
+int linearbuffers_encoder_vector_push_bfloat16_unchecked (struct linearbuffers_encoder *encoder, uint16_t value);
+int linearbuffers_encoder_vector_create_bfloat16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const uint16_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_bfloat16_from_float (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const float *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_bfloat16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t count, uint16_t **value);
+int linearbuffers_encoder_vector_commit_bfloat16 (struct linearbuffers_encoder *encoder, uint64_t *offset, uint64_t count);
+
+uint16_t linearbuffers_float16_from_float (float value);
+uint16_t linearbuffers_bfloat16_from_float (float value);
+
+int linearbuffers_encoder_vector_create_struct (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t size, uint64_t alignment, uint64_t *offset, const void *value, uint64_t count);
+int linearbuffers_encoder_vector_reserve_struct (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t size, uint64_t alignment, uint64_t count, void **value);
+int linearbuffers_encoder_vector_commit_struct (struct linearbuffers_encoder *encoder, uint64_t size, uint64_t *offset, uint64_t count);
+
+int linearbuffers_encoder_vector_create_packed_int8 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const int8_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_packed_int16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const int16_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_packed_int32 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const int32_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_packed_int64 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const int64_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_packed_uint8 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const uint8_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_packed_uint16 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const uint16_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_packed_uint32 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const uint32_t *value, uint64_t count);
+int linearbuffers_encoder_vector_create_packed_uint64 (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, enum linearbuffers_encoder_vector_encoding encoding, uint64_t *offset, const uint64_t *value, uint64_t count);
+
+int linearbuffers_encoder_vector_create_bool (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const uint8_t *value, uint64_t count);
 
 int linearbuffers_encoder_vector_start_string (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_string (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_string (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_string (struct linearbuffers_encoder *encoder, uint64_t value);
+int linearbuffers_encoder_vector_push_string_unchecked (struct linearbuffers_encoder *encoder, uint64_t value);
+int linearbuffers_encoder_vector_create_string (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, uint64_t count);
+int linearbuffers_encoder_vector_ncreate_string (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count);
+int linearbuffers_encoder_vector_create_dictionary (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, uint64_t count);
+int linearbuffers_encoder_vector_ncreate_dictionary (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count);
+int linearbuffers_encoder_vector_create_front_coded (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, uint64_t count);
+int linearbuffers_encoder_vector_ncreate_front_coded (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type, uint64_t *offset, const char **value, const uint64_t *length, uint64_t count);
 
 int linearbuffers_encoder_vector_start_table (struct linearbuffers_encoder *encoder, enum linearbuffers_encoder_count_type count_type, enum linearbuffers_encoder_offset_type offset_type);
 int linearbuffers_encoder_vector_end_table (struct linearbuffers_encoder *encoder, uint64_t *offset);
 int linearbuffers_encoder_vector_cancel_table (struct linearbuffers_encoder *encoder);
 int linearbuffers_encoder_vector_push_table (struct linearbuffers_encoder *encoder, uint64_t value);
+int linearbuffers_encoder_vector_push_table_unchecked (struct linearbuffers_encoder *encoder, uint64_t value);
+int linearbuffers_encoder_vector_push_tables (struct linearbuffers_encoder *encoder, const uint64_t *value, uint64_t count);
 
 const void * linearbuffers_encoder_linearized (struct linearbuffers_encoder *encoder, uint64_t *length);
+int64_t linearbuffers_encoder_iovec (struct linearbuffers_encoder *encoder, struct linearbuffers_encoder_iovec *iovec, uint64_t count);
+int linearbuffers_encoder_detach (struct linearbuffers_encoder *encoder, void **buffer, uint64_t *length);
+int linearbuffers_encoder_attach (struct linearbuffers_encoder *encoder, void *buffer, uint64_t size);
 
 #endif
 
@@ -503,6 +503,30 @@ LinearBuffersEncoder.prototype.tableSetString = function (element, offset, value
         return 0;
 }
 
+LinearBuffersEncoder.prototype.tableSetStruct = function (element, offset, value) {
+        var rc;
+        var parent;
+        if (this.__entries.length <= 0) {
+                throw("logic error: entries is empty");
+        }
+        parent = this.__entries[this.__entries.length - 1];
+        if (parent == undefined) {
+                throw("logic error: parent is invalid");
+        }
+        if (parent.__type != LinearBufferEncoderEntryType.Table) {
+                throw("logic error: parent is invalid")
+        }
+        if (element >= parent.__elements) {
+                throw("logic error: element is invalid")
+        }
+        rc = this.__emitterFunction(this.__emitterContext, parent.__offset + parent.__countSize + parent.__presentBytes + offset, value, value.length);
+        if (rc != 0) {
+                throw("can not emit table element")
+        }
+        parent.__presentBuffer[Math.floor(element / 8)] |= 1 << (element % 8);
+        return 0;
+}
+
 LinearBuffersEncoder.prototype.tableSetTable = function (element, offset, value) {
         throw("not implemented yet");
 }
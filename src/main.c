@@ -88,7 +88,7 @@ static void print_help (const char *name)
         fprintf(stdout, "  -p, --pretty   : generate pretty (values: { 0, 1 }, default: %d)\n", DEFAULT_PRETTY);
         fprintf(stdout, "  -l, --language : generate language (values: { c, js }, default: %s)\n", DEFAULT_LANGUAGE);
         fprintf(stdout, "  -e, --encoder: generate encoder (values: { 0, 1 }, default: %d)\n", DEFAULT_ENCODER);
-        fprintf(stdout, "  -i, --encoder-include-library: generate encoder with builtin library(values: { 0, 1 }, default: %d)\n", DEFAULT_ENCODER_INCLUDE_LIBRARY);
+        fprintf(stdout, "  -i, --encoder-include-library: generate encoder with builtin library, using unchecked calls (values: { 0, 1 }, default: %d)\n", DEFAULT_ENCODER_INCLUDE_LIBRARY);
         fprintf(stdout, "  -d, --decoder  : generate decoder (values: { 0, 1 }, default: %d)\n", DEFAULT_DECODER);
         fprintf(stdout, "  -m, --decoder-use-memcpy: decode using memcpy, rather than casting (values: { 0, 1 }, default: %d)\n", DEFAULT_DECODER_USE_MEMCPY);
         fprintf(stdout, "  -j, --jsonify  : generate jsonify (values: { 0, 1 }, default: %d)\n", DEFAULT_JSONIFY);
@@ -85,6 +85,18 @@ Option:
                                                                     fprintf(stderr, "can not set schema offset_type\n");
                                                                     YYERROR;
                                                                 }
+                                                            } else if (strcmp($2, "align") == 0) {
+                                                                rc = schema_set_align(schema_parser->schema, $4);
+                                                                if (rc != 0) {
+                                                                    fprintf(stderr, "can not set schema align\n");
+                                                                    YYERROR;
+                                                                }
+                                                            } else if (strcmp($2, "string_type") == 0) {
+                                                                rc = schema_set_string_type(schema_parser->schema, $4);
+                                                                if (rc != 0) {
+                                                                    fprintf(stderr, "can not set schema string_type\n");
+                                                                    YYERROR;
+                                                                }
                                                             } else {
                                                                 fprintf(stderr, "unknown option: '%s' = '%s';\n", $2, $4);
                                                                 YYERROR;
@@ -234,7 +246,7 @@ Struct:
     ;
 
 Table:
-        TABLE STRING BLOCK                              {
+        TABLE STRING                                    {
                                                             int rc;
                                                             schema_parser->schema_table = schema_table_create();
                                                             if (schema_parser->schema_table == NULL) {
@@ -248,6 +260,8 @@ Table:
                                                             }
                                                             free($2);
                                                         }
+            Attributes
+        BLOCK
             TableFields
         ENDBLOCK                                        {
                                                             int rc;
@@ -387,6 +401,12 @@ AttributeEntry:
                                                                     fprintf(stderr, "can not add schema table field attribute\n");
                                                                     YYERROR;
                                                                 }
+                                                            } else if (schema_parser->schema_table != NULL) {
+                                                                rc = schema_table_add_attribute(schema_parser->schema_table, $1, "true");
+                                                                if (rc != 0) {
+                                                                    fprintf(stderr, "can not add schema table attribute\n");
+                                                                    YYERROR;
+                                                                }
                                                             }
                                                             free($1);
                                                         }
@@ -399,6 +419,12 @@ AttributeEntry:
                                                                     fprintf(stderr, "can not add schema table field attribute\n");
                                                                     YYERROR;
                                                                 }
+                                                            } else if (schema_parser->schema_table != NULL) {
+                                                                rc = schema_table_add_attribute(schema_parser->schema_table, $1, $3);
+                                                                if (rc != 0) {
+                                                                    fprintf(stderr, "can not add schema table attribute\n");
+                                                                    YYERROR;
+                                                                }
                                                             }
                                                             free($1);
                                                             free($3);
@@ -59,6 +59,102 @@ static int schema_has_string (struct schema *schema)
         return 0;
 }
 
+static int schema_table_has_bytes (struct schema_table *schema_table)
+{
+        struct schema_table_field *schema_table_field;
+        TAILQ_FOREACH(schema_table_field, &schema_table->fields, list) {
+                if (strcmp(schema_table_field->type, "bytes") == 0) {
+                        return 1;
+                }
+        }
+        return 0;
+}
+
+static int schema_has_bytes (struct schema *schema)
+{
+        int rc;
+        struct schema_table *schema_table;
+        TAILQ_FOREACH(schema_table, &schema->tables, list) {
+                rc = schema_table_has_bytes(schema_table);
+                if (rc != 0) {
+                        return rc;
+                }
+        }
+        return 0;
+}
+
+static int schema_table_field_packed (struct schema_table_field *schema_table_field)
+{
+        return schema_table_field_encoding(schema_table_field) != schema_encoding_type_none &&
+               schema_table_field_encoding(schema_table_field) != schema_encoding_type_dictionary &&
+               schema_table_field_encoding(schema_table_field) != schema_encoding_type_front_coded;
+}
+
+static int schema_table_field_dictionary (struct schema_table_field *schema_table_field)
+{
+        return schema_table_field_encoding(schema_table_field) == schema_encoding_type_dictionary;
+}
+
+static int schema_table_field_front_coded (struct schema_table_field *schema_table_field)
+{
+        return schema_table_field_encoding(schema_table_field) == schema_encoding_type_front_coded;
+}
+
+static int schema_table_field_bool_default (struct schema_table_field *schema_table_field)
+{
+        return schema_table_field->value != NULL &&
+               strcmp(schema_table_field->value, "true") == 0;
+}
+
+static int schema_table_field_half (struct schema_table_field *schema_table_field)
+{
+        return schema_type_is_half(schema_table_field->type);
+}
+
+static int schema_table_field_offset (struct schema *schema, struct schema_table_field *schema_table_field)
+{
+        return schema_table_field->container == schema_container_type_vector ||
+               schema_type_is_string(schema_table_field->type) ||
+               schema_type_is_bytes(schema_table_field->type) ||
+               (schema_table_field->container == schema_container_type_none &&
+                schema_type_is_table(schema, schema_table_field->type));
+}
+
+static const char * schema_float_value_type (const char *type)
+{
+        return (schema_type_is_half(type)) ? "float" : type;
+}
+
+static const char * schema_float_storage_type (const char *type)
+{
+        return (schema_type_is_half(type)) ? "uint16_t" : type;
+}
+
+static int schema_has_encoding (struct schema *schema, int (*match) (struct schema_table_field *schema_table_field))
+{
+        struct schema_table *schema_table;
+        struct schema_table_field *schema_table_field;
+        TAILQ_FOREACH(schema_table, &schema->tables, list) {
+                TAILQ_FOREACH(schema_table_field, &schema_table->fields, list) {
+                        if (match(schema_table_field)) {
+                                return 1;
+                        }
+                }
+        }
+        return 0;
+}
+
+static int schema_has_promoted (struct schema *schema)
+{
+        struct schema_table *schema_table;
+        TAILQ_FOREACH(schema_table, &schema->tables, list) {
+                if (schema_table_promoted(schema_table)) {
+                        return 1;
+                }
+        }
+        return 0;
+}
+
 static int schema_generate_enum (struct schema *schema, struct schema_enum *anum, FILE *fp)
 {
         struct schema_enum_field *anum_field;
@@ -118,6 +214,151 @@ static int schema_generate_enum (struct schema *schema, struct schema_enum *anum
 bail:   return -1;
 }
 
+static int schema_generate_half (struct schema *schema, FILE *fp)
+{
+        if (schema == NULL) {
+                linearbuffers_errorf("schema is invalid");
+                goto bail;
+        }
+        if (fp == NULL) {
+                linearbuffers_errorf("fp is invalid");
+                goto bail;
+        }
+
+        fprintf(fp, "\n");
+        fprintf(fp, "#if !defined(%s_HALF_API)\n", schema->NAMESPACE);
+        fprintf(fp, "#define %s_HALF_API\n", schema->NAMESPACE);
+
+        fprintf(fp, "\n");
+        fprintf(fp, "#if defined(__AVX2__) || defined(__F16C__)\n");
+        fprintf(fp, "#include <immintrin.h>\n");
+        fprintf(fp, "#endif\n");
+        fprintf(fp, "\n");
+        fprintf(fp, "__attribute__((unused)) static inline float %s_float16_to_float (uint16_t value)\n", schema->namespace);
+        fprintf(fp, "{\n");
+        fprintf(fp, "    union {\n");
+        fprintf(fp, "        float f;\n");
+        fprintf(fp, "        uint32_t u;\n");
+        fprintf(fp, "    } bits;\n");
+        fprintf(fp, "    uint32_t exponent;\n");
+        fprintf(fp, "    uint32_t mantissa;\n");
+        fprintf(fp, "    exponent = (value >> 10) & 0x1f;\n");
+        fprintf(fp, "    mantissa = value & 0x3ff;\n");
+        fprintf(fp, "    if (exponent == 0x1f) {\n");
+        fprintf(fp, "        bits.u = 0x7f800000 | (mantissa << 13);\n");
+        fprintf(fp, "    } else if (exponent != 0) {\n");
+        fprintf(fp, "        bits.u = ((exponent + 112) << 23) | (mantissa << 13);\n");
+        fprintf(fp, "    } else {\n");
+        fprintf(fp, "        bits.f = (float) mantissa * 5.9604644775390625e-08f;\n");
+        fprintf(fp, "    }\n");
+        fprintf(fp, "    bits.u |= ((uint32_t) (value & 0x8000)) << 16;\n");
+        fprintf(fp, "    return bits.f;\n");
+        fprintf(fp, "}\n");
+        fprintf(fp, "__attribute__((unused)) static inline float %s_bfloat16_to_float (uint16_t value)\n", schema->namespace);
+        fprintf(fp, "{\n");
+        fprintf(fp, "    union {\n");
+        fprintf(fp, "        float f;\n");
+        fprintf(fp, "        uint32_t u;\n");
+        fprintf(fp, "    } bits;\n");
+        fprintf(fp, "    bits.u = ((uint32_t) value) << 16;\n");
+        fprintf(fp, "    return bits.f;\n");
+        fprintf(fp, "}\n");
+
+        fprintf(fp, "\n");
+        fprintf(fp, "#endif\n");
+
+        return 0;
+bail:   return -1;
+}
+
+static int schema_generate_struct (struct schema *schema, struct schema_table *table, FILE *fp)
+{
+        uint64_t padding;
+        uint64_t table_field_s;
+        uint64_t table_field_a;
+        struct schema_table_field *table_field;
+
+        if (schema == NULL) {
+                linearbuffers_errorf("schema is invalid");
+                goto bail;
+        }
+        if (table == NULL) {
+                linearbuffers_errorf("table is invalid");
+                goto bail;
+        }
+        if (fp == NULL) {
+                linearbuffers_errorf("fp is invalid");
+                goto bail;
+        }
+
+        fprintf(fp, "\n");
+        fprintf(fp, "#if !defined(%s_%s_STRUCT_API)\n", schema->NAMESPACE, table->name);
+        fprintf(fp, "#define %s_%s_STRUCT_API\n", schema->NAMESPACE, table->name);
+        fprintf(fp, "\n");
+
+        padding = 0;
+        table_field_s = 0;
+        fprintf(fp, "struct __attribute__((packed)) %s_%s {\n", schema->namespace, table->name);
+        TAILQ_FOREACH(table_field, &table->fields, list) {
+                table_field_a = schema_align_offset(schema, table_field_s, schema_table_field_alignment(schema, schema->offset_type, table_field));
+                if (table_field_a != table_field_s) {
+                        fprintf(fp, "    uint8_t _pad%" PRIu64 "[%" PRIu64 "];\n", padding++, table_field_a - table_field_s);
+                }
+                if (schema_type_is_scalar(table_field->type)) {
+                        fprintf(fp, "    %s_t %s;\n", table_field->type, table_field->name);
+                } else if (schema_type_is_float(table_field->type)) {
+                        fprintf(fp, "    %s %s;\n", schema_float_storage_type(table_field->type), table_field->name);
+                } else if (schema_type_is_enum(schema, table_field->type)) {
+                        fprintf(fp, "    %s_%s_t %s;\n", schema->namespace, table_field->type, table_field->name);
+                } else if (schema_type_is_struct(schema, table_field->type)) {
+                        fprintf(fp, "    struct %s_%s %s;\n", schema->namespace, table_field->type, table_field->name);
+                } else {
+                        linearbuffers_errorf("type is invalid: %s", table_field->type);
+                        goto bail;
+                }
+                table_field_s = table_field_a + schema_table_field_size(schema, schema->offset_type, table_field);
+        }
+        if (schema_struct_size(schema, table) != table_field_s) {
+                fprintf(fp, "    uint8_t _pad%" PRIu64 "[%" PRIu64 "];\n", padding++, schema_struct_size(schema, table) - table_field_s);
+        }
+        fprintf(fp, "};\n");
+        fprintf(fp, "\n");
+
+        TAILQ_FOREACH(table_field, &table->fields, list) {
+                if (schema_type_is_scalar(table_field->type)) {
+                        fprintf(fp, "__attribute__((unused)) static inline %s_t %s_%s_%s_get (const struct %s_%s *value)\n", table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                } else if (schema_type_is_float(table_field->type)) {
+                        fprintf(fp, "__attribute__((unused)) static inline %s %s_%s_%s_get (const struct %s_%s *value)\n", schema_float_value_type(table_field->type), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                } else if (schema_type_is_enum(schema, table_field->type)) {
+                        fprintf(fp, "__attribute__((unused)) static inline %s_%s_t %s_%s_%s_get (const struct %s_%s *value)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                } else if (schema_type_is_struct(schema, table_field->type)) {
+                        fprintf(fp, "__attribute__((unused)) static inline const struct %s_%s * %s_%s_%s_get (const struct %s_%s *value)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                }
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (value == NULL) {\n");
+                if (schema_type_is_struct(schema, table_field->type)) {
+                        fprintf(fp, "        return NULL;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return &value->%s;\n", table_field->name);
+                } else if (schema_type_is_half(table_field->type)) {
+                        fprintf(fp, "        return 0;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return %s_%s_to_float(value->%s);\n", schema->namespace, table_field->type, table_field->name);
+                } else {
+                        fprintf(fp, "        return 0;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return value->%s;\n", table_field->name);
+                }
+                fprintf(fp, "}\n");
+        }
+
+        fprintf(fp, "\n");
+        fprintf(fp, "#endif\n");
+
+        return 0;
+bail:   return -1;
+}
+
 static int schema_generate_vector_decoder (struct schema *schema, const char *type, int decoder_use_memcpy, FILE *fp)
 {
         if (schema == NULL) {
@@ -133,7 +374,73 @@ static int schema_generate_vector_decoder (struct schema *schema, const char *ty
         fprintf(fp, "#if !defined(%s_%s_VECTOR_DECODER_API)\n", schema->NAMESPACE, type);
         fprintf(fp, "#define %s_%s_VECTOR_DECODER_API\n", schema->NAMESPACE, type);
 
-        if (schema_type_is_scalar(type)) {
+        if (schema_type_is_bool(type)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_vector_get_count (const struct %s_%s_vector *decoder)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                if (decoder_use_memcpy) {
+                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(schema->count_type));
+                        fprintf(fp, "    return *(%s_t *) memcpy(&count, ((const uint8_t *) decoder), sizeof(count));\n", schema_count_type_name(schema->count_type));
+                } else {
+                        fprintf(fp, "    return *(%s_t *) (((const uint8_t *) decoder));\n", schema_count_type_name(schema->count_type));
+                }
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline const uint8_t * %s_%s_vector_get_bits (const struct %s_%s_vector *decoder)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ");\n", schema_vector_header_size(schema, type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_get_at (const struct %s_%s_vector *decoder, uint64_t at)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return (%s_%s_vector_get_bits(decoder)[at / 8] >> (at %% 8)) & 1;\n", schema->namespace, type);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_vector_get_popcount (const struct %s_%s_vector *decoder)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint64_t w;\n");
+                fprintf(fp, "    uint64_t word;\n");
+                fprintf(fp, "    uint64_t words;\n");
+                fprintf(fp, "    uint64_t popcount;\n");
+                fprintf(fp, "    const uint8_t *bits;\n");
+                fprintf(fp, "    bits = %s_%s_vector_get_bits(decoder);\n", schema->namespace, type);
+                fprintf(fp, "    words = (%s_%s_vector_get_count(decoder) + 63) / 64;\n", schema->namespace, type);
+                fprintf(fp, "    popcount = 0;\n");
+                fprintf(fp, "    for (w = 0; w < words; w++) {\n");
+                fprintf(fp, "        memcpy(&word, bits + (w * 8), sizeof(word));\n");
+                fprintf(fp, "        popcount += __builtin_popcountll(word);\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return popcount;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_vector_get_next (const struct %s_%s_vector *decoder, uint64_t at)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint64_t w;\n");
+                fprintf(fp, "    uint64_t word;\n");
+                fprintf(fp, "    uint64_t count;\n");
+                fprintf(fp, "    const uint8_t *bits;\n");
+                fprintf(fp, "    count = %s_%s_vector_get_count(decoder);\n", schema->namespace, type);
+                fprintf(fp, "    if (at >= count) {\n");
+                fprintf(fp, "        return count;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    bits = %s_%s_vector_get_bits(decoder);\n", schema->namespace, type);
+                fprintf(fp, "    w = at / 64;\n");
+                fprintf(fp, "    memcpy(&word, bits + (w * 8), sizeof(word));\n");
+                fprintf(fp, "    word &= ~UINT64_C(0) << (at %% 64);\n");
+                fprintf(fp, "    while (word == 0) {\n");
+                fprintf(fp, "        w += 1;\n");
+                fprintf(fp, "        if (w * 64 >= count) {\n");
+                fprintf(fp, "            return count;\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "        memcpy(&word, bits + (w * 8), sizeof(word));\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (w * 64) + __builtin_ctzll(word);\n");
+                fprintf(fp, "}\n");
+        } else if (schema_type_is_scalar(type)) {
                 fprintf(fp, "\n");
                 fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
                 fprintf(fp, "\n");
@@ -158,11 +465,11 @@ static int schema_generate_vector_decoder (struct schema *schema, const char *ty
                 fprintf(fp, "    if (decoder == NULL) {\n");
                 fprintf(fp, "        return NULL;\n");
                 fprintf(fp, "    }\n");
-                fprintf(fp, "    return (const %s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", type, schema_count_type_size(schema->count_type));
+                fprintf(fp, "    return (const %s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", type, schema_vector_header_size(schema, type));
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline %s_t %s_%s_vector_get_at (const struct %s_%s_vector *decoder, uint64_t at)\n", type, schema->namespace, type, schema->namespace, type);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return ((const %s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ")))[at];\n", type, schema_count_type_size(schema->count_type));
+                fprintf(fp, "    return ((const %s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ")))[at];\n", type, schema_vector_header_size(schema, type));
                 fprintf(fp, "}\n");
         } else if (schema_type_is_float(type)) {
                 fprintf(fp, "\n");
@@ -182,19 +489,65 @@ static int schema_generate_vector_decoder (struct schema *schema, const char *ty
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_vector_get_length (const struct %s_%s_vector *decoder)\n", schema->namespace, type, schema->namespace, type);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return %s_%s_vector_get_count(decoder) * sizeof(%s);\n", schema->namespace, type, type);
+                fprintf(fp, "    return %s_%s_vector_get_count(decoder) * sizeof(%s);\n", schema->namespace, type, schema_float_storage_type(type));
                 fprintf(fp, "}\n");
-                fprintf(fp, "__attribute__((unused)) static inline const %s * %s_%s_vector_get_values (const struct %s_%s_vector *decoder)\n", type, schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "__attribute__((unused)) static inline const %s * %s_%s_vector_get_values (const struct %s_%s_vector *decoder)\n", schema_float_storage_type(type), schema->namespace, type, schema->namespace, type);
                 fprintf(fp, "{\n");
                 fprintf(fp, "    if (decoder == NULL) {\n");
                 fprintf(fp, "        return NULL;\n");
                 fprintf(fp, "    }\n");
-                fprintf(fp, "    return (const %s *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", type, schema_count_type_size(schema->count_type));
-                fprintf(fp, "}\n");
-                fprintf(fp, "__attribute__((unused)) static inline %s %s_%s_vector_get_at (const struct %s_%s_vector *decoder, uint64_t at)\n", type, schema->namespace, type, schema->namespace, type);
-                fprintf(fp, "{\n");
-                fprintf(fp, "    return ((const %s *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ")))[at];\n", type, schema_count_type_size(schema->count_type));
+                fprintf(fp, "    return (const %s *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_float_storage_type(type), schema_vector_header_size(schema, type));
                 fprintf(fp, "}\n");
+                if (schema_type_is_half(type)) {
+                        fprintf(fp, "__attribute__((unused)) static inline float %s_%s_vector_get_at (const struct %s_%s_vector *decoder, uint64_t at)\n", schema->namespace, type, schema->namespace, type);
+                        fprintf(fp, "{\n");
+                        if (decoder_use_memcpy) {
+                                fprintf(fp, "    uint16_t value;\n");
+                                fprintf(fp, "    memcpy(&value, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + (at * sizeof(value)), sizeof(value));\n", schema_vector_header_size(schema, type));
+                                fprintf(fp, "    return %s_%s_to_float(value);\n", schema->namespace, type);
+                        } else {
+                                fprintf(fp, "    return %s_%s_to_float(((const uint16_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ")))[at]);\n", schema->namespace, type, schema_vector_header_size(schema, type));
+                        }
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_vector_get_floats (const struct %s_%s_vector *decoder, float *values, uint64_t count)\n", schema->namespace, type, schema->namespace, type);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    uint64_t i;\n");
+                        fprintf(fp, "    const uint16_t *input;\n");
+                        fprintf(fp, "    if (count > %s_%s_vector_get_count(decoder)) {\n", schema->namespace, type);
+                        fprintf(fp, "        count = %s_%s_vector_get_count(decoder);\n", schema->namespace, type);
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    input = %s_%s_vector_get_values(decoder);\n", schema->namespace, type);
+                        fprintf(fp, "    i = 0;\n");
+                        if (strcmp(type, "float16") == 0) {
+                                fprintf(fp, "#if defined(__F16C__)\n");
+                                fprintf(fp, "    for (; i + 8 <= count; i += 8) {\n");
+                                fprintf(fp, "        _mm256_storeu_ps(values + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *) (input + i))));\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "#endif\n");
+                        } else {
+                                fprintf(fp, "#if defined(__AVX2__)\n");
+                                fprintf(fp, "    for (; i + 8 <= count; i += 8) {\n");
+                                fprintf(fp, "        _mm256_storeu_ps(values + i, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) (input + i))), 16)));\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "#endif\n");
+                        }
+                        fprintf(fp, "    for (; i < count; i++) {\n");
+                        if (decoder_use_memcpy) {
+                                fprintf(fp, "        uint16_t value;\n");
+                                fprintf(fp, "        memcpy(&value, input + i, sizeof(value));\n");
+                                fprintf(fp, "        values[i] = %s_%s_to_float(value);\n", schema->namespace, type);
+                        } else {
+                                fprintf(fp, "        values[i] = %s_%s_to_float(input[i]);\n", schema->namespace, type);
+                        }
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return count;\n");
+                        fprintf(fp, "}\n");
+                } else {
+                        fprintf(fp, "__attribute__((unused)) static inline %s %s_%s_vector_get_at (const struct %s_%s_vector *decoder, uint64_t at)\n", type, schema->namespace, type, schema->namespace, type);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return ((const %s *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ")))[at];\n", type, schema_vector_header_size(schema, type));
+                        fprintf(fp, "}\n");
+                }
         } else if (schema_type_is_enum(schema, type)) {
                 fprintf(fp, "\n");
                 fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
@@ -220,11 +573,11 @@ static int schema_generate_vector_decoder (struct schema *schema, const char *ty
                 fprintf(fp, "    if (decoder == NULL) {\n");
                 fprintf(fp, "        return NULL;\n");
                 fprintf(fp, "    }\n");
-                fprintf(fp, "    return (const %s_%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema->namespace, type, schema_count_type_size(schema->count_type));
+                fprintf(fp, "    return (const %s_%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema->namespace, type, schema_vector_header_size(schema, type));
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline %s_%s_t %s_%s_vector_get_at (const struct %s_%s_vector *decoder, uint64_t at)\n", schema->namespace, type, schema->namespace, type, schema->namespace, type);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return ((const %s_%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ")))[at];\n", schema->namespace, type, schema_count_type_size(schema->count_type));
+                fprintf(fp, "    return ((const %s_%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ")))[at];\n", schema->namespace, type, schema_vector_header_size(schema, type));
                 fprintf(fp, "}\n");
         } else if (schema_type_is_string(type)) {
                 fprintf(fp, "\n");
@@ -249,14 +602,18 @@ static int schema_generate_vector_decoder (struct schema *schema, const char *ty
                         fprintf(fp, "    %s_t toffset;\n", schema_offset_type_name(schema->offset_type));
                 }
                 if (decoder_use_memcpy) {
-                        fprintf(fp, "    offset  = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type));
+                        fprintf(fp, "    offset  = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(schema->offset_type), schema_vector_header_size(schema, type));
                         fprintf(fp, "    offset += *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + offset + (sizeof(offset) * at), sizeof(offset));\n", schema_offset_type_name(schema->offset_type));
                 } else {
-                        fprintf(fp, "    offset  = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type));
+                        fprintf(fp, "    offset  = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(schema->offset_type), schema_vector_header_size(schema, type));
                         fprintf(fp, "    offset += ((%s_t *) (((const uint8_t *) decoder) + offset))[at];\n", schema_offset_type_name(schema->offset_type));
                 }
                         fprintf(fp, "    return (const char *) (((const uint8_t *) decoder) + offset);\n");
                 fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_vector_get_length_at (const struct %s_%s_vector *decoder, uint64_t at)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return %s_string_length((const struct %s_string *) %s_%s_vector_get_at(decoder, at));\n", schema->namespace, schema->namespace, schema->namespace, type);
+                fprintf(fp, "}\n");
         } else if (schema_type_is_table(schema, type)) {
                 fprintf(fp, "\n");
                 fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
@@ -280,14 +637,45 @@ static int schema_generate_vector_decoder (struct schema *schema, const char *ty
                         fprintf(fp, "    %s_t toffset;\n", schema_offset_type_name(schema->offset_type));
                 }
                 if (decoder_use_memcpy) {
-                        fprintf(fp, "    offset  = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type));
+                        fprintf(fp, "    offset  = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(schema->offset_type), schema_vector_header_size(schema, type));
                         fprintf(fp, "    offset += *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + offset + (sizeof(offset) * at), sizeof(offset));\n", schema_offset_type_name(schema->offset_type));
                 } else {
-                        fprintf(fp, "    offset  = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type));
+                        fprintf(fp, "    offset  = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(schema->offset_type), schema_vector_header_size(schema, type));
                         fprintf(fp, "    offset += ((%s_t *) (((const uint8_t *) decoder) + offset))[at];\n", schema_offset_type_name(schema->offset_type));
                 }
                         fprintf(fp, "    return (const struct %s_%s *) (((const uint8_t *) decoder) + offset);\n", schema->namespace, type);
                 fprintf(fp, "}\n");
+        } else if (schema_type_is_struct(schema, type)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_vector_get_count (const struct %s_%s_vector *decoder)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                if (decoder_use_memcpy) {
+                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(schema->count_type));
+                        fprintf(fp, "    return *(%s_t *) memcpy(&count, ((const uint8_t *) decoder), sizeof(count));\n", schema_count_type_name(schema->count_type));
+                } else {
+                        fprintf(fp, "    return *(%s_t *) (((const uint8_t *) decoder));\n", schema_count_type_name(schema->count_type));
+                }
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_vector_get_length (const struct %s_%s_vector *decoder)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return %s_%s_vector_get_count(decoder) * sizeof(struct %s_%s);\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline const struct %s_%s * %s_%s_vector_get_values (const struct %s_%s_vector *decoder)\n", schema->namespace, type, schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema->namespace, type, schema_vector_header_size(schema, type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline const struct %s_%s * %s_%s_vector_get_at (const struct %s_%s_vector *decoder, uint64_t at)\n", schema->namespace, type, schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return ((const struct %s_%s *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "))) + at;\n", schema->namespace, type, schema_vector_header_size(schema, type));
+                fprintf(fp, "}\n");
         }
 
         fprintf(fp, "\n");
@@ -297,8 +685,9 @@ static int schema_generate_vector_decoder (struct schema *schema, const char *ty
 bail:   return -1;
 }
 
-static int schema_generate_vector_encoder (struct schema *schema, const char *type, FILE *fp)
+static int schema_generate_vector_encoder (struct schema *schema, const char *type, int encoder_include_library, FILE *fp)
 {
+        const char *unchecked;
         if (schema == NULL) {
                 linearbuffers_errorf("schema is invalid");
                 goto bail;
@@ -308,11 +697,27 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 goto bail;
         }
 
+        unchecked = (encoder_include_library) ? "_unchecked" : "";
+
         fprintf(fp, "\n");
         fprintf(fp, "#if !defined(%s_%s_VECTOR_ENCODER_API)\n", schema->NAMESPACE, type);
         fprintf(fp, "#define %s_%s_VECTOR_ENCODER_API\n", schema->NAMESPACE, type);
 
-        if (schema_type_is_scalar(type)) {
+        if (schema_type_is_bool(type)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_create (struct linearbuffers_encoder *encoder, const uint8_t *value, uint64_t count)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_create_%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, value, count);\n", type, schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
+                fprintf(fp, "}\n");
+        } else if (schema_type_is_scalar(type)) {
                 fprintf(fp, "\n");
                 fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
                 fprintf(fp, "\n");
@@ -336,7 +741,7 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_push (struct linearbuffers_encoder *encoder, %s_t value)\n", schema->namespace, type, type);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s(encoder, value);\n", type);
+                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s%s(encoder, value);\n", type, unchecked);
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_create (struct linearbuffers_encoder *encoder, const %s_t *value, uint64_t count)\n", schema->namespace, type, schema->namespace, type, type);
                 fprintf(fp, "{\n");
@@ -348,6 +753,20 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "    }\n");
                 fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
                 fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline int %s_%s_vector_reserve (struct linearbuffers_encoder *encoder, uint64_t count, %s_t **value)\n", schema->namespace, type, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return linearbuffers_encoder_vector_reserve_%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, count, value);\n", type, schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_commit (struct linearbuffers_encoder *encoder, uint64_t count)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_commit_%s(encoder, &offset, count);\n", type);
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
+                fprintf(fp, "}\n");
         } else if (schema_type_is_float(type)) {
                 fprintf(fp, "\n");
                 fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
@@ -370,15 +789,33 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "{\n");
                 fprintf(fp, "    return linearbuffers_encoder_vector_cancel_%s(encoder);\n", type);
                 fprintf(fp, "}\n");
-                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_push (struct linearbuffers_encoder *encoder, %s value)\n", schema->namespace, type, type);
+                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_push (struct linearbuffers_encoder *encoder, %s value)\n", schema->namespace, type, schema_float_value_type(type));
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s(encoder, value);\n", type);
+                if (schema_type_is_half(type)) {
+                        fprintf(fp, "    return linearbuffers_encoder_vector_push_%s%s(encoder, linearbuffers_%s_from_float(value));\n", type, unchecked, type);
+                } else {
+                        fprintf(fp, "    return linearbuffers_encoder_vector_push_%s%s(encoder, value);\n", type, unchecked);
+                }
                 fprintf(fp, "}\n");
-                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_create (struct linearbuffers_encoder *encoder, const %s *value, uint64_t count)\n", schema->namespace, type, schema->namespace, type, type);
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_create (struct linearbuffers_encoder *encoder, const %s *value, uint64_t count)\n", schema->namespace, type, schema->namespace, type, schema_float_value_type(type));
                 fprintf(fp, "{\n");
                 fprintf(fp, "    int rc;\n");
                 fprintf(fp, "    uint64_t offset;\n");
-                fprintf(fp, "    rc = linearbuffers_encoder_vector_create_%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, value, count);\n", type, schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_create_%s%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, value, count);\n", type, (schema_type_is_half(type)) ? "_from_float" : "", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline int %s_%s_vector_reserve (struct linearbuffers_encoder *encoder, uint64_t count, %s **value)\n", schema->namespace, type, schema_float_storage_type(type));
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return linearbuffers_encoder_vector_reserve_%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, count, value);\n", type, schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_commit (struct linearbuffers_encoder *encoder, uint64_t count)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_commit_%s(encoder, &offset, count);\n", type);
                 fprintf(fp, "    if (rc != 0) {\n");
                 fprintf(fp, "        return NULL;\n");
                 fprintf(fp, "    }\n");
@@ -408,7 +845,7 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_push (struct linearbuffers_encoder *encoder, %s_%s_t value)\n", schema->namespace, type, schema->namespace, type);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s(encoder, value);\n", schema_type_get_enum(schema, type)->type);
+                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s%s(encoder, value);\n", schema_type_get_enum(schema, type)->type, unchecked);
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_create (struct linearbuffers_encoder *encoder, const %s_%s_t *value, uint64_t count)\n", schema->namespace, type, schema->namespace, type, schema->namespace, schema_type_get_enum(schema, type)->name);
                 fprintf(fp, "{\n");
@@ -420,6 +857,20 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "    }\n");
                 fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
                 fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline int %s_%s_vector_reserve (struct linearbuffers_encoder *encoder, uint64_t count, %s_%s_t **value)\n", schema->namespace, type, schema->namespace, schema_type_get_enum(schema, type)->name);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return linearbuffers_encoder_vector_reserve_%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, count, value);\n", schema_type_get_enum(schema, type)->type, schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_commit (struct linearbuffers_encoder *encoder, uint64_t count)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_commit_%s(encoder, &offset, count);\n", schema_type_get_enum(schema, type)->type);
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
+                fprintf(fp, "}\n");
         } else if (schema_type_is_string(type)) {
                 fprintf(fp, "\n");
                 fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
@@ -444,7 +895,7 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_push (struct linearbuffers_encoder *encoder, const struct %s_string *value)\n", schema->namespace, type, schema->namespace);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s(encoder, (uint64_t) (ptrdiff_t) value);\n", type);
+                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s%s(encoder, (uint64_t) (ptrdiff_t) value);\n", type, unchecked);
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_push_create (struct linearbuffers_encoder *encoder, const char *value)\n", schema->namespace, type);
                 fprintf(fp, "{\n");
@@ -453,7 +904,7 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "    if (string == NULL) {\n");
                 fprintf(fp, "        return -1;\n");
                 fprintf(fp, "    }\n");
-                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s(encoder, (uint64_t) (ptrdiff_t) string);\n", type);
+                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s%s(encoder, (uint64_t) (ptrdiff_t) string);\n", type, unchecked);
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_push_ncreate (struct linearbuffers_encoder *encoder, uint64_t n, const char *value)\n", schema->namespace, type);
                 fprintf(fp, "{\n");
@@ -462,7 +913,27 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "    if (string == NULL) {\n");
                 fprintf(fp, "        return -1;\n");
                 fprintf(fp, "    }\n");
-                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s(encoder, (uint64_t) (ptrdiff_t) string);\n", type);
+                fprintf(fp, "    return linearbuffers_encoder_vector_push_%s%s(encoder, (uint64_t) (ptrdiff_t) string);\n", type, unchecked);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_create (struct linearbuffers_encoder *encoder, const char **value, uint64_t count)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_create_%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, value, count);\n", type, schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_ncreate (struct linearbuffers_encoder *encoder, const char **value, const uint64_t *length, uint64_t count)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_ncreate_%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, value, length, count);\n", type, schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
                 fprintf(fp, "}\n");
         } else if (schema_type_is_table(schema, type)) {
                 fprintf(fp, "\n");
@@ -489,7 +960,35 @@ static int schema_generate_vector_encoder (struct schema *schema, const char *ty
                 fprintf(fp, "}\n");
                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_vector_push (struct linearbuffers_encoder *encoder, const struct %s_%s *value)\n", schema->namespace, type, schema->namespace, type);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return linearbuffers_encoder_vector_push_table(encoder, (uint64_t) (ptrdiff_t) value);\n");
+                fprintf(fp, "    return linearbuffers_encoder_vector_push_table%s(encoder, (uint64_t) (ptrdiff_t) value);\n", unchecked);
+                fprintf(fp, "}\n");
+        } else if (schema_type_is_struct(schema, type)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_%s_vector;\n", schema->namespace, type);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_create (struct linearbuffers_encoder *encoder, const struct %s_%s *value, uint64_t count)\n", schema->namespace, type, schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_create_struct(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, sizeof(struct %s_%s), UINT64_C(%" PRIu64 "), &offset, value, count);\n", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type), schema->namespace, type, schema_struct_alignment(schema, schema_type_get_table(schema, type)));
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline int %s_%s_vector_reserve (struct linearbuffers_encoder *encoder, uint64_t count, struct %s_%s **value)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return linearbuffers_encoder_vector_reserve_struct(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, sizeof(struct %s_%s), UINT64_C(%" PRIu64 "), count, (void **) value);\n", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type), schema->namespace, type, schema_struct_alignment(schema, schema_type_get_table(schema, type)));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_%s_vector * %s_%s_vector_commit (struct linearbuffers_encoder *encoder, uint64_t count)\n", schema->namespace, type, schema->namespace, type);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_vector_commit_struct(encoder, sizeof(struct %s_%s), &offset, count);\n", schema->namespace, type);
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_%s_vector *) (ptrdiff_t) offset;\n", schema->namespace, type);
                 fprintf(fp, "}\n");
         }
 
@@ -799,8 +1298,14 @@ bail:   if (namespace != NULL) {
         return NULL;
 }
 
-static int schema_generate_encoder_table (struct schema *schema, struct schema_table *table, FILE *fp)
+static int schema_generate_encoder_table (struct schema *schema, struct schema_table *table, int encoder_include_library, FILE *fp)
 {
+        uint32_t count_type;
+        uint32_t offset_type;
+        uint32_t block_type;
+        const char *unchecked;
+        uint64_t padding;
+        uint64_t prefix;
         uint64_t table_field_i;
         uint64_t table_field_s;
         struct schema_table_field *table_field;
@@ -818,6 +1323,15 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                 goto bail;
         }
 
+        count_type = schema_table_count_type(schema, table);
+        offset_type = schema_table_offset_type(schema, table);
+        block_type = offset_type;
+        if (schema_table_promoted(table)) {
+                /* promoted tables stage offsets as uint64, width is picked at table end */
+                offset_type = schema_offset_type_uint64;
+        }
+        unchecked = (encoder_include_library) ? "_unchecked" : "";
+
         fprintf(fp, "\n");
         fprintf(fp, "#if !defined(%s_%s_ENCODER_API)\n", schema->NAMESPACE, table->name);
         fprintf(fp, "#define %s_%s_ENCODER_API\n", schema->NAMESPACE, table->name);
@@ -828,18 +1342,25 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
 
         table_field_s = 0;
         TAILQ_FOREACH(table_field, &table->fields, list) {
+                table_field_s = schema_align_offset(schema, table_field_s, schema_table_field_alignment(schema, offset_type, table_field));
                 if (table_field->container == schema_container_type_vector) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_scalar(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_float(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
+                } else if (schema_type_is_bool(table_field->type)) {
+                        table_field_s += schema_table_field_size(schema, offset_type, table_field);
                 } else if (schema_type_is_string(table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_bytes(table_field->type)) {
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_enum(schema, table_field->type)) {
                         table_field_s += schema_inttype_size(schema_type_get_enum(schema, table_field->type)->type);
                 } else if (schema_type_is_table(schema, table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_struct(schema, table_field->type)) {
+                        table_field_s += schema_struct_size(schema, schema_type_get_table(schema, table_field->type));
                 } else {
                         linearbuffers_errorf("type is invalid: %s", table_field->type);
                         goto bail;
@@ -847,9 +1368,121 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
 
         }
 
+        fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_fixed_size (void)\n", schema->namespace, table->name);
+        fprintf(fp, "{\n");
+        if (schema_table_sparse(table)) {
+                table_field_s += schema_offset_type_size(offset_type) * (table->nfields + 1);
+                if (schema->align != 0) {
+                        table_field_s += (sizeof(uint64_t) - 1) * (table->nfields + 1);
+                }
+                if (schema_table_promoted(table)) {
+                        table_field_s += sizeof(uint32_t) - 1;
+                }
+        }
+        fprintf(fp, "    return UINT64_C(%" PRIu64 ");\n", schema_table_header_size(schema, count_type, table->nfields) + table_field_s);
+        fprintf(fp, "}\n");
+
+        table_field_i = 0;
+        fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_estimate_size (", schema->namespace, table->name);
+        TAILQ_FOREACH(table_field, &table->fields, list) {
+                if (table_field->container == schema_container_type_vector) {
+                        if (schema_type_is_string(table_field->type)) {
+                                fprintf(fp, "%suint64_t count_%s, uint64_t length_%s", (table_field_i++) ? ", " : "", table_field->name, table_field->name);
+                        } else if (schema_type_is_table(schema, table_field->type)) {
+                                fprintf(fp, "%suint64_t count_%s, uint64_t size_%s", (table_field_i++) ? ", " : "", table_field->name, table_field->name);
+                        } else {
+                                fprintf(fp, "%suint64_t count_%s", (table_field_i++) ? ", " : "", table_field->name);
+                        }
+                } else if (schema_type_is_string(table_field->type) ||
+                           schema_type_is_bytes(table_field->type)) {
+                        fprintf(fp, "%suint64_t length_%s", (table_field_i++) ? ", " : "", table_field->name);
+                } else if (schema_type_is_table(schema, table_field->type)) {
+                        fprintf(fp, "%suint64_t size_%s", (table_field_i++) ? ", " : "", table_field->name);
+                }
+        }
+        fprintf(fp, "%s)\n", (table_field_i) ? "" : "void");
+        fprintf(fp, "{\n");
+        padding = (schema->align != 0) ? ((schema->align > sizeof(uint64_t)) ? schema->align : sizeof(uint64_t)) - 1 : 0;
+        prefix = 0;
+        if (schema->string_type == schema_string_type_prefixed) {
+                prefix = schema_count_type_size(schema->count_type);
+                prefix += (schema->align != 0) ? prefix - 1 : 0;
+        }
+        fprintf(fp, "    return %s_%s_fixed_size()", schema->namespace, table->name);
+        TAILQ_FOREACH(table_field, &table->fields, list) {
+                if (schema_table_field_packed(table_field)) {
+                        uint64_t bound;
+                        if (schema_table_field_encoding(table_field) == schema_encoding_type_varint ||
+                            schema_table_field_encoding(table_field) == schema_encoding_type_delta_varint) {
+                                bound = (schema_inttype_size(table_field->type) * 8 + 6) / 7;
+                        } else {
+                                bound = schema_inttype_size(table_field->type) + 1;
+                        }
+                        fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (((count_%s + 127) / 128) * UINT64_C(%" PRIu64 ")) + (count_%s * UINT64_C(%" PRIu64 "))", padding + schema_align_offset(schema, schema_count_type_size(schema->count_type), schema_offset_type_size(schema->offset_type)) + sizeof(uint64_t), table_field->name, schema_offset_type_size(schema->offset_type) + sizeof(uint64_t) + sizeof(uint8_t), table_field->name, bound);
+                } else if (schema_table_field_front_coded(table_field)) {
+                        fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (((count_%s + 15) / 16) * UINT64_C(%" PRIu64 ")) + (count_%s * UINT64_C(20)) + length_%s", padding + schema_align_offset(schema, schema_count_type_size(schema->count_type), schema_offset_type_size(schema->offset_type)), table_field->name, schema_offset_type_size(schema->offset_type), table_field->name, table_field->name);
+                } else if (schema_table_field_dictionary(table_field)) {
+                        fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (count_%s * UINT64_C(%" PRIu64 ")) + length_%s", (padding + schema_align_offset(schema, schema_count_type_size(schema->count_type), schema_offset_type_size(schema->offset_type)) + schema_offset_type_size(schema->offset_type) + sizeof(uint32_t)) + (padding + schema_vector_header_size(schema, table_field->type) + schema_offset_type_size(schema->offset_type)), table_field->name, sizeof(uint32_t) + schema_offset_type_size(schema->offset_type) + prefix + 1, table_field->name);
+                } else if (table_field->container == schema_container_type_vector) {
+                        if (schema_type_is_string(table_field->type)) {
+                                fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (count_%s * UINT64_C(%" PRIu64 ")) + length_%s", padding + schema_vector_header_size(schema, table_field->type) + schema_offset_type_size(schema->offset_type), table_field->name, schema_offset_type_size(schema->offset_type) + prefix + 1, table_field->name);
+                        } else if (schema_type_is_table(schema, table_field->type)) {
+                                fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (count_%s * UINT64_C(%" PRIu64 ")) + size_%s", padding + schema_vector_header_size(schema, table_field->type) + schema_offset_type_size(schema->offset_type), table_field->name, schema_offset_type_size(schema->offset_type), table_field->name);
+                        } else if (schema_type_is_enum(schema, table_field->type)) {
+                                fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (count_%s * UINT64_C(%" PRIu64 "))", padding + schema_vector_header_size(schema, table_field->type), table_field->name, schema_inttype_size(schema_type_get_enum(schema, table_field->type)->type));
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (count_%s * UINT64_C(%" PRIu64 "))", padding + schema_vector_header_size(schema, table_field->type), table_field->name, schema_struct_size(schema, schema_type_get_table(schema, table_field->type)));
+                        } else if (schema_type_is_bool(table_field->type)) {
+                                fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (((count_%s + 63) / 64) * UINT64_C(%" PRIu64 "))", padding + schema_vector_header_size(schema, table_field->type), table_field->name, sizeof(uint64_t));
+                        } else {
+                                fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + (count_%s * UINT64_C(%" PRIu64 "))", padding + schema_vector_header_size(schema, table_field->type), table_field->name, schema_inttype_size(table_field->type));
+                        }
+                } else if (schema_type_is_string(table_field->type)) {
+                        if (prefix != 0) {
+                                fprintf(fp, "\n        + UINT64_C(%" PRIu64 ")", prefix);
+                        }
+                        fprintf(fp, "\n        + length_%s + 1", table_field->name);
+                } else if (schema_type_is_bytes(table_field->type)) {
+                        fprintf(fp, "\n        + UINT64_C(%" PRIu64 ") + length_%s", schema_count_type_size(schema->count_type) + schema_table_field_align(table_field) - 1, table_field->name);
+                } else if (schema_type_is_table(schema, table_field->type)) {
+                        if (padding != 0) {
+                                fprintf(fp, "\n        + UINT64_C(%" PRIu64 ")", padding);
+                        }
+                        fprintf(fp, "\n        + size_%s", table_field->name);
+                }
+        }
+        fprintf(fp, ";\n");
+        fprintf(fp, "}\n");
+
         fprintf(fp, "__attribute__((unused)) static inline int %s_%s_start (struct linearbuffers_encoder *encoder)\n", schema->namespace, table->name);
         fprintf(fp, "{\n");
-        fprintf(fp, "    return linearbuffers_encoder_table_start(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "));\n", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type), table->nfields, table_field_s);
+        if (schema_table_sparse(table)) {
+                fprintf(fp, "    static const struct linearbuffers_encoder_table_field fields[] = {\n");
+                table_field_s = 0;
+                TAILQ_FOREACH(table_field, &table->fields, list) {
+                        table_field_s = schema_align_offset(schema, table_field_s, schema_table_field_alignment(schema, offset_type, table_field));
+                        fprintf(fp, "        { UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), %d },\n", table_field_s, schema_table_field_size(schema, offset_type, table_field), schema_table_field_alignment(schema, offset_type, table_field), schema_table_promoted(table) && schema_table_field_offset(schema, table_field));
+                        table_field_s += schema_table_field_size(schema, offset_type, table_field);
+                }
+                fprintf(fp, "    };\n");
+        }
+        if (schema->align != 0) {
+                fprintf(fp, "    if (linearbuffers_encoder_set_alignment(encoder, UINT64_C(%" PRIu64 ")) != 0) {\n", schema->align);
+                fprintf(fp, "        return -1;\n");
+                fprintf(fp, "    }\n");
+        }
+        if (schema->string_type == schema_string_type_prefixed) {
+                fprintf(fp, "    if (linearbuffers_encoder_set_string_type(encoder, linearbuffers_encoder_string_type_prefixed, linearbuffers_encoder_count_type_%s) != 0) {\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "        return -1;\n");
+                fprintf(fp, "    }\n");
+        }
+        if (schema_table_promoted(table)) {
+                fprintf(fp, "    return linearbuffers_encoder_table_start_promoted(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), fields);\n", schema_count_type_name(count_type), schema_offset_type_name(block_type), table->nfields, table_field_s);
+        } else if (schema_table_sparse(table)) {
+                fprintf(fp, "    return linearbuffers_encoder_table_start_sparse(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), fields);\n", schema_count_type_name(count_type), schema_offset_type_name(offset_type), table->nfields, table_field_s);
+        } else {
+                fprintf(fp, "    return linearbuffers_encoder_table_start(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "));\n", schema_count_type_name(count_type), schema_offset_type_name(offset_type), table->nfields, table_field_s);
+        }
         fprintf(fp, "}\n");
 
         table_field_i = 0;
@@ -857,6 +1490,7 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
         TAILQ_FOREACH(table_field, &table->fields, list) {
                 struct schema_attribute *attribute;
                 struct namespace *attribute_string;
+                table_field_s = schema_align_offset(schema, table_field_s, schema_table_field_alignment(schema, offset_type, table_field));
                 attribute_string = namespace_create();
                 namespace_push(attribute_string, "__attribute__ (( unused");
                 TAILQ_FOREACH(attribute, &table_field->attributes, list) {
@@ -871,11 +1505,64 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                 }
                 namespace_push(attribute_string, " )) static inline");
 
-                if (table_field->container == schema_container_type_vector) {
+                if (schema_table_field_packed(table_field)) {
+                        fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const %s_t *values, uint64_t count)\n", schema->namespace, table->name, table_field->name, table_field->type);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    int rc;\n");
+                        fprintf(fp, "    uint64_t offset;\n");
+                        fprintf(fp, "    rc = linearbuffers_encoder_vector_create_packed_%s(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, linearbuffers_encoder_vector_encoding_%s, &offset, values, count);\n", table_field->type, schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type), schema_encoding_type_name(schema_table_field_encoding(table_field)));
+                        fprintf(fp, "    if (rc != 0) {\n");
+                        fprintf(fp, "        return -1;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", unchecked, table_field_i, table_field_s);
+                        fprintf(fp, "}\n");
+                } else if (schema_table_field_front_coded(table_field)) {
+                        fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const char **values, uint64_t count)\n", schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    int rc;\n");
+                        fprintf(fp, "    uint64_t offset;\n");
+                        fprintf(fp, "    rc = linearbuffers_encoder_vector_create_front_coded(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, values, count);\n", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                        fprintf(fp, "    if (rc != 0) {\n");
+                        fprintf(fp, "        return -1;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", unchecked, table_field_i, table_field_s);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_ncreate (struct linearbuffers_encoder *encoder, const char **values, const uint64_t *lengths, uint64_t count)\n", schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    int rc;\n");
+                        fprintf(fp, "    uint64_t offset;\n");
+                        fprintf(fp, "    rc = linearbuffers_encoder_vector_ncreate_front_coded(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, values, lengths, count);\n", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                        fprintf(fp, "    if (rc != 0) {\n");
+                        fprintf(fp, "        return -1;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", unchecked, table_field_i, table_field_s);
+                        fprintf(fp, "}\n");
+                } else if (schema_table_field_dictionary(table_field)) {
+                        fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const char **values, uint64_t count)\n", schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    int rc;\n");
+                        fprintf(fp, "    uint64_t offset;\n");
+                        fprintf(fp, "    rc = linearbuffers_encoder_vector_create_dictionary(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, values, count);\n", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                        fprintf(fp, "    if (rc != 0) {\n");
+                        fprintf(fp, "        return -1;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", unchecked, table_field_i, table_field_s);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_ncreate (struct linearbuffers_encoder *encoder, const char **values, const uint64_t *lengths, uint64_t count)\n", schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    int rc;\n");
+                        fprintf(fp, "    uint64_t offset;\n");
+                        fprintf(fp, "    rc = linearbuffers_encoder_vector_ncreate_dictionary(encoder, linearbuffers_encoder_count_type_%s, linearbuffers_encoder_offset_type_%s, &offset, values, lengths, count);\n", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type));
+                        fprintf(fp, "    if (rc != 0) {\n");
+                        fprintf(fp, "        return -1;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", unchecked, table_field_i, table_field_s);
+                        fprintf(fp, "}\n");
+                } else if (table_field->container == schema_container_type_vector) {
                         if (schema_type_is_scalar(table_field->type)) {
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_%s_vector *value)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const %s_t *values, uint64_t count)\n", schema->namespace, table->name, table_field->name, table_field->type);
                                 fprintf(fp, "{\n");
@@ -905,9 +1592,9 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                         } else if (schema_type_is_float(table_field->type)) {
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_%s_vector *value)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
-                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const %s *values, uint64_t count)\n", schema->namespace, table->name, table_field->name, table_field->type);
+                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const %s *values, uint64_t count)\n", schema->namespace, table->name, table_field->name, schema_float_value_type(table_field->type));
                                 fprintf(fp, "{\n");
                                 fprintf(fp, "    const struct %s_%s_vector *vector;\n", schema->namespace, table_field->type);
                                 fprintf(fp, "    vector = %s_%s_vector_create(encoder, values, count);\n", schema->namespace, table_field->type);
@@ -928,14 +1615,28 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "{\n");
                                 fprintf(fp, "    return %s_%s_vector_cancel(encoder);\n", schema->namespace, table_field->type);
                                 fprintf(fp, "}\n");
-                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_push (struct linearbuffers_encoder *encoder, %s value)\n", schema->namespace, table->name, table_field->name, table_field->type);
+                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_push (struct linearbuffers_encoder *encoder, %s value)\n", schema->namespace, table->name, table_field->name, schema_float_value_type(table_field->type));
                                 fprintf(fp, "{\n");
                                 fprintf(fp, "    return %s_%s_vector_push(encoder, value);\n", schema->namespace, table_field->type);
                                 fprintf(fp, "}\n");
+                        } else if (schema_type_is_bool(table_field->type)) {
+                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_%s_vector *value)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const uint8_t *values, uint64_t count)\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    const struct %s_%s_vector *vector;\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    vector = %s_%s_vector_create(encoder, values, count);\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    if (vector == NULL) {\n");
+                                fprintf(fp, "        return -1;\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "    return %s_%s_%s_set(encoder, vector);\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
                         } else if (schema_type_is_enum(schema, table_field->type)) {
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_%s_vector *value)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const %s_%s_t *values, uint64_t count)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
                                 fprintf(fp, "{\n");
@@ -965,29 +1666,21 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                         } else if (schema_type_is_string(table_field->type)) {
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_string_vector *value)\n", schema->namespace, table->name, table_field->name, schema->namespace);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const char **values, uint64_t count)\n", schema->namespace, table->name, table_field->name);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    int rc;\n");
-                                fprintf(fp, "    uint64_t i;\n");
-                                fprintf(fp, "    const struct %s_%s *string;\n", schema->namespace, table_field->type);
                                 fprintf(fp, "    const struct %s_%s_vector *vector;\n", schema->namespace, table_field->type);
-                                fprintf(fp, "    rc = %s_%s_vector_start(encoder);\n", schema->namespace, table_field->type);
-                                fprintf(fp, "    if (rc != 0) {\n");
-                                fprintf(fp, "        return rc;\n");
-                                fprintf(fp, "    }\n");
-                                fprintf(fp, "    for (i = 0; i < count; i++) {\n");
-                                fprintf(fp, "        string = %s_%s_create(encoder, values[i]);\n", schema->namespace, table_field->type);
-                                fprintf(fp, "        if (string == NULL) {\n");
-                                fprintf(fp, "            return -1;\n");
-                                fprintf(fp, "        }\n");
-                                fprintf(fp, "        rc = %s_%s_vector_push(encoder, string);\n", schema->namespace, table_field->type);
-                                fprintf(fp, "        if (rc != 0) {\n");
-                                fprintf(fp, "            return rc;\n");
-                                fprintf(fp, "        }\n");
+                                fprintf(fp, "    vector = %s_%s_vector_create(encoder, values, count);\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    if (vector == NULL) {\n");
+                                fprintf(fp, "        return -1;\n");
                                 fprintf(fp, "    }\n");
-                                fprintf(fp, "    vector = %s_%s_vector_end(encoder);\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    return %s_%s_%s_set(encoder, vector);\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_ncreate (struct linearbuffers_encoder *encoder, const char **values, const uint64_t *lengths, uint64_t count)\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    const struct %s_%s_vector *vector;\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    vector = %s_%s_vector_ncreate(encoder, values, lengths, count);\n", schema->namespace, table_field->type);
                                 fprintf(fp, "    if (vector == NULL) {\n");
                                 fprintf(fp, "        return -1;\n");
                                 fprintf(fp, "    }\n");
@@ -1020,7 +1713,7 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                         } else if (schema_type_is_table(schema, table_field->type)) {
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_%s_vector *value)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_table(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_table%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                                 fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_start (struct linearbuffers_encoder *encoder)\n", schema->namespace, table->name, table_field->name);
                                 fprintf(fp, "{\n");
@@ -1038,6 +1731,33 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "{\n");
                                 fprintf(fp, "    return %s_%s_vector_push(encoder, value);\n", schema->namespace, table_field->type);
                                 fprintf(fp, "}\n");
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_%s_vector *value)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_vector%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const struct %s_%s *values, uint64_t count)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    const struct %s_%s_vector *vector;\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    vector = %s_%s_vector_create(encoder, values, count);\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    if (vector == NULL) {\n");
+                                fprintf(fp, "        return -1;\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "    return %s_%s_%s_set(encoder, vector);\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline int %s_%s_%s_reserve (struct linearbuffers_encoder *encoder, uint64_t count, struct %s_%s **values)\n", schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return %s_%s_vector_reserve(encoder, count, values);\n", schema->namespace, table_field->type);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "__attribute__((unused)) static inline int %s_%s_%s_commit (struct linearbuffers_encoder *encoder, uint64_t count)\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    const struct %s_%s_vector *vector;\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    vector = %s_%s_vector_commit(encoder, count);\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    if (vector == NULL) {\n");
+                                fprintf(fp, "        return -1;\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "    return %s_%s_%s_set(encoder, vector);\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
                         } else {
                                 linearbuffers_errorf("type is invalid: %s", table_field->type);
                                 goto bail;
@@ -1046,12 +1766,33 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                         if (schema_type_is_scalar(table_field->type)) {
                                 fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, %s_t value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, table_field->type);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), value);\n", table_field->type, table_field_i, table_field_s);
+                                if (schema_table_sparse(table) &&
+                                    table_field->value != NULL) {
+                                        fprintf(fp, "    if (value == %s) {\n", table_field->value);
+                                        fprintf(fp, "        return 0;\n");
+                                        fprintf(fp, "    }\n");
+                                }
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), value);\n", table_field->type, unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                         } else if (schema_type_is_float(table_field->type)) {
-                                fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, %s value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, table_field->type);
+                                fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, %s value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema_float_value_type(table_field->type));
+                                fprintf(fp, "{\n");
+                                if (schema_table_sparse(table) &&
+                                    table_field->value != NULL) {
+                                        fprintf(fp, "    if (value == %s) {\n", table_field->value);
+                                        fprintf(fp, "        return 0;\n");
+                                        fprintf(fp, "    }\n");
+                                }
+                                if (schema_type_is_half(table_field->type)) {
+                                        fprintf(fp, "    return linearbuffers_encoder_table_set_%s%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), linearbuffers_%s_from_float(value));\n", table_field->type, unchecked, table_field_i, table_field_s, table_field->type);
+                                } else {
+                                        fprintf(fp, "    return linearbuffers_encoder_table_set_%s%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), value);\n", table_field->type, unchecked, table_field_i, table_field_s);
+                                }
+                                fprintf(fp, "}\n");
+                        } else if (schema_type_is_bool(table_field->type)) {
+                                fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, int value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), value);\n", table_field->type, table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_bool%s(encoder, UINT64_C(%" PRIu64 "), %s);\n", unchecked, table_field_i, (schema_table_field_bool_default(table_field)) ? "!value" : "!!value");
                                 fprintf(fp, "}\n");
                         } else if (schema_type_is_string(table_field->type)) {
                                 fprintf(fp, "%s int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const char *value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name);
@@ -1062,7 +1803,7 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "    if (rc != 0) { \n");
                                 fprintf(fp, "        return rc;\n");
                                 fprintf(fp, "    }\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", table_field->type, table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", table_field->type, unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                                 fprintf(fp, "%s int %s_%s_%s_createf (struct linearbuffers_encoder *encoder, const char *value, ...)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name);
                                 fprintf(fp, "{\n");
@@ -1075,31 +1816,71 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "    if (rc != 0) { \n");
                                 fprintf(fp, "        return rc;\n");
                                 fprintf(fp, "    }\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", table_field->type, table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", table_field->type, unchecked, table_field_i, table_field_s);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "%s int %s_%s_%s_ncreate (struct linearbuffers_encoder *encoder, uint64_t n, const char *value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    int rc;\n");
+                                fprintf(fp, "    uint64_t offset;\n");
+                                fprintf(fp, "    rc = linearbuffers_encoder_string_ncreate(encoder, &offset, n, value);\n");
+                                fprintf(fp, "    if (rc != 0) { \n");
+                                fprintf(fp, "        return rc;\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", table_field->type, unchecked, table_field_i, table_field_s);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_string *value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", table_field->type, unchecked, table_field_i, table_field_s);
+                                fprintf(fp, "}\n");
+                        } else if (schema_type_is_bytes(table_field->type)) {
+                                fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_bytes *value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_bytes%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "%s int %s_%s_%s_create (struct linearbuffers_encoder *encoder, const void *value, uint64_t length)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    int rc;\n");
+                                fprintf(fp, "    uint64_t offset;\n");
+                                fprintf(fp, "    rc = linearbuffers_encoder_bytes_create(encoder, linearbuffers_encoder_count_type_%s, UINT64_C(%" PRIu64 "), &offset, value, length);\n", schema_count_type_name(schema->count_type), schema_table_field_align(table_field));
+                                fprintf(fp, "    if (rc != 0) {\n");
+                                fprintf(fp, "        return rc;\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_bytes%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
-                                fprintf(fp, "%s int %s_%s_%s_ncreate (struct linearbuffers_encoder *encoder, uint64_t n, const char *value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "%s int %s_%s_%s_reserve (struct linearbuffers_encoder *encoder, uint64_t length, void **value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return linearbuffers_encoder_bytes_reserve(encoder, linearbuffers_encoder_count_type_%s, UINT64_C(%" PRIu64 "), length, value);\n", schema_count_type_name(schema->count_type), schema_table_field_align(table_field));
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "%s int %s_%s_%s_commit (struct linearbuffers_encoder *encoder, uint64_t length)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name);
                                 fprintf(fp, "{\n");
                                 fprintf(fp, "    int rc;\n");
                                 fprintf(fp, "    uint64_t offset;\n");
-                                fprintf(fp, "    rc = linearbuffers_encoder_string_ncreate(encoder, &offset, n, value);\n");
-                                fprintf(fp, "    if (rc != 0) { \n");
+                                fprintf(fp, "    rc = linearbuffers_encoder_bytes_commit(encoder, &offset, length);\n");
+                                fprintf(fp, "    if (rc != 0) {\n");
                                 fprintf(fp, "        return rc;\n");
                                 fprintf(fp, "    }\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", table_field->type, table_field_i, table_field_s);
-                                fprintf(fp, "}\n");
-                                fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_string *value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace);
-                                fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", table_field->type, table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_bytes%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), offset);\n", unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                         } else if (schema_type_is_enum(schema, table_field->type)) {
                                 fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, %s_%s_t value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), value);\n", schema_type_get_enum(schema, table_field->type)->type, table_field_i, table_field_s);
+                                if (schema_table_sparse(table) &&
+                                    table_field->value != NULL) {
+                                        fprintf(fp, "    if (value == %s_%s_%s) {\n", schema->namespace, table_field->type, table_field->value);
+                                        fprintf(fp, "        return 0;\n");
+                                        fprintf(fp, "    }\n");
+                                }
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_%s%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), value);\n", schema_type_get_enum(schema, table_field->type)->type, unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                         } else if (schema_type_is_table(schema, table_field->type)) {
                                 fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_%s *value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
                                 fprintf(fp, "{\n");
-                                fprintf(fp, "    return linearbuffers_encoder_table_set_table(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", table_field_i, table_field_s);
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_table%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), (uint64_t) (ptrdiff_t) value);\n", unchecked, table_field_i, table_field_s);
+                                fprintf(fp, "}\n");
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "%s int %s_%s_%s_set (struct linearbuffers_encoder *encoder, const struct %s_%s *value)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table_field->type);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return linearbuffers_encoder_table_set_struct%s(encoder, UINT64_C(%" PRIu64 "), UINT64_C(%" PRIu64 "), value, sizeof(*value));\n", unchecked, table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
                         } else {
                                 linearbuffers_errorf("type is invalid: %s", table_field->type);
@@ -1108,17 +1889,23 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                 }
                 table_field_i += 1;
                 if (table_field->container == schema_container_type_vector) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_scalar(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_float(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
+                } else if (schema_type_is_bool(table_field->type)) {
+                        table_field_s += schema_table_field_size(schema, offset_type, table_field);
                 } else if (schema_type_is_string(table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_bytes(table_field->type)) {
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_enum(schema, table_field->type)) {
                         table_field_s += schema_inttype_size(schema_type_get_enum(schema, table_field->type)->type);
                 } else if (schema_type_is_table(schema, table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_struct(schema, table_field->type)) {
+                        table_field_s += schema_struct_size(schema, schema_type_get_table(schema, table_field->type));
                 }
                 namespace_destroy(attribute_string);
         }
@@ -1184,6 +1971,25 @@ int schema_generate_c_encoder (struct schema *schema, FILE *fp, int encoder_incl
                 }
         }
 
+        if (schema_has_encoding(schema, schema_table_field_half)) {
+                rc = schema_generate_half(schema, fp);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not generate half");
+                        goto bail;
+                }
+        }
+
+        TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type != schema_container_type_struct) {
+                        continue;
+                }
+                rc = schema_generate_struct(schema, table, fp);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not generate struct");
+                        goto bail;
+                }
+        }
+
         if (schema_has_string(schema)) {
                 fprintf(fp, "\n");
                 fprintf(fp, "#if !defined(%s_STRING_ENCODER_API)\n", schema->NAMESPACE);
@@ -1222,6 +2028,57 @@ int schema_generate_c_encoder (struct schema *schema, FILE *fp, int encoder_incl
                 fprintf(fp, "    }\n");
                 fprintf(fp, "    return (const struct %s_string *) (ptrdiff_t) offset;\n", schema->namespace);
                 fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline int %s_string_reserve (struct linearbuffers_encoder *encoder, uint64_t n, char **value)\n", schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return linearbuffers_encoder_string_reserve(encoder, n, value);\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_string * %s_string_commit (struct linearbuffers_encoder *encoder, uint64_t n)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_string_commit(encoder, &offset, n);\n");
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_string *) (ptrdiff_t) offset;\n", schema->namespace);
+                fprintf(fp, "}\n");
+
+                fprintf(fp, "\n");
+                fprintf(fp, "#endif\n");
+        }
+
+        if (schema_has_bytes(schema)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_BYTES_ENCODER_API)\n", schema->NAMESPACE);
+                fprintf(fp, "#define %s_BYTES_ENCODER_API\n", schema->NAMESPACE);
+
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_bytes;\n", schema->namespace);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_bytes * %s_bytes_create (struct linearbuffers_encoder *encoder, uint64_t alignment, const void *value, uint64_t length)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_bytes_create(encoder, linearbuffers_encoder_count_type_%s, alignment, &offset, value, length);\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_bytes *) (ptrdiff_t) offset;\n", schema->namespace);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline int %s_bytes_reserve (struct linearbuffers_encoder *encoder, uint64_t alignment, uint64_t length, void **value)\n", schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return linearbuffers_encoder_bytes_reserve(encoder, linearbuffers_encoder_count_type_%s, alignment, length, value);\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const struct %s_bytes * %s_bytes_commit (struct linearbuffers_encoder *encoder, uint64_t length)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t offset;\n");
+                fprintf(fp, "    rc = linearbuffers_encoder_bytes_commit(encoder, &offset, length);\n");
+                fprintf(fp, "    if (rc != 0) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return (const struct %s_bytes *) (ptrdiff_t) offset;\n", schema->namespace);
+                fprintf(fp, "}\n");
 
                 fprintf(fp, "\n");
                 fprintf(fp, "#endif\n");
@@ -1229,47 +2086,56 @@ int schema_generate_c_encoder (struct schema *schema, FILE *fp, int encoder_incl
 
         rc = 0;
         if (schema_has_vector(schema, "int8")) {
-                rc |= schema_generate_vector_encoder(schema, "int8", fp);
+                rc |= schema_generate_vector_encoder(schema, "int8", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "int16")) {
-                rc |= schema_generate_vector_encoder(schema, "int16", fp);
+                rc |= schema_generate_vector_encoder(schema, "int16", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "int32")) {
-                rc |= schema_generate_vector_encoder(schema, "int32", fp);
+                rc |= schema_generate_vector_encoder(schema, "int32", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "int64")) {
-                rc |= schema_generate_vector_encoder(schema, "int64", fp);
+                rc |= schema_generate_vector_encoder(schema, "int64", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "uint8")) {
-                rc |= schema_generate_vector_encoder(schema, "uint8", fp);
+                rc |= schema_generate_vector_encoder(schema, "uint8", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "uint16")) {
-                rc |= schema_generate_vector_encoder(schema, "uint16", fp);
+                rc |= schema_generate_vector_encoder(schema, "uint16", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "uint32")) {
-                rc |= schema_generate_vector_encoder(schema, "uint32", fp);
+                rc |= schema_generate_vector_encoder(schema, "uint32", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "uint64")) {
-                rc |= schema_generate_vector_encoder(schema, "uint64", fp);
+                rc |= schema_generate_vector_encoder(schema, "uint64", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "float")) {
-                rc |= schema_generate_vector_encoder(schema, "float", fp);
+                rc |= schema_generate_vector_encoder(schema, "float", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "double")) {
-                rc |= schema_generate_vector_encoder(schema, "double", fp);
+                rc |= schema_generate_vector_encoder(schema, "double", encoder_include_library, fp);
+        }
+        if (schema_has_vector(schema, "float16")) {
+                rc |= schema_generate_vector_encoder(schema, "float16", encoder_include_library, fp);
+        }
+        if (schema_has_vector(schema, "bfloat16")) {
+                rc |= schema_generate_vector_encoder(schema, "bfloat16", encoder_include_library, fp);
+        }
+        if (schema_has_vector(schema, "bool")) {
+                rc |= schema_generate_vector_encoder(schema, "bool", encoder_include_library, fp);
         }
         if (schema_has_vector(schema, "string")) {
-                rc |= schema_generate_vector_encoder(schema, "string", fp);
+                rc |= schema_generate_vector_encoder(schema, "string", encoder_include_library, fp);
         }
 
         TAILQ_FOREACH(anum, &schema->enums, list) {
                 if (schema_has_vector(schema, anum->name)) {
-                        rc |= schema_generate_vector_encoder(schema, anum->name, fp);
+                        rc |= schema_generate_vector_encoder(schema, anum->name, encoder_include_library, fp);
                 }
         }
         TAILQ_FOREACH(table, &schema->tables, list) {
                 if (schema_has_vector(schema, table->name)) {
-                        rc |= schema_generate_vector_encoder(schema, table->name, fp);
+                        rc |= schema_generate_vector_encoder(schema, table->name, encoder_include_library, fp);
                 }
         }
         if (rc != 0) {
@@ -1278,7 +2144,10 @@ int schema_generate_c_encoder (struct schema *schema, FILE *fp, int encoder_incl
         }
 
         TAILQ_FOREACH(table, &schema->tables, list) {
-                rc = schema_generate_encoder_table(schema, table, fp);
+                if (table->type == schema_container_type_struct) {
+                        continue;
+                }
+                rc = schema_generate_encoder_table(schema, table, encoder_include_library, fp);
                 if (rc != 0) {
                         linearbuffers_errorf("can not generate decoder for table: %s", table->name);
                         goto bail;
@@ -1291,6 +2160,12 @@ bail:   return -1;
 
 static int schema_generate_decoder_table (struct schema *schema, struct schema_table *table, int decoder_use_memcpy, FILE *fp)
 {
+        uint32_t count_type;
+        uint32_t offset_type;
+        char header[128];
+        char fields[256];
+        char promoted[256];
+        uint64_t field_offset;
         uint64_t table_field_i;
         uint64_t table_field_s;
         struct schema_table_field *table_field;
@@ -1308,6 +2183,15 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                 goto bail;
         }
 
+        count_type = schema_table_count_type(schema, table);
+        offset_type = schema_table_offset_type(schema, table);
+        if (schema->align != 0) {
+                snprintf(header, sizeof(header), "((UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(7)) & ~UINT64_C(7))", schema_count_type_size(count_type));
+        } else {
+                snprintf(header, sizeof(header), "UINT64_C(%" PRIu64 ") + ((count + 7) / 8)", schema_count_type_size(count_type));
+        }
+        snprintf(fields, sizeof(fields), "%s", header);
+
         fprintf(fp, "\n");
         fprintf(fp, "#if !defined(%s_%s_DECODER_API)\n", schema->NAMESPACE, table->name);
         fprintf(fp, "#define %s_%s_DECODER_API\n", schema->NAMESPACE, table->name);
@@ -1322,11 +2206,58 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
         fprintf(fp, "    return (const struct %s_%s *) buffer;\n", schema->namespace, table->name);
         fprintf(fp, "}\n");
 
+        if (schema_table_sparse(table)) {
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_sparse_offset (const struct %s_%s *decoder, uint64_t count, uint64_t element)\n", schema->namespace, table->name, schema->namespace, table->name);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint64_t w;\n");
+                fprintf(fp, "    uint64_t word;\n");
+                fprintf(fp, "    uint64_t rank;\n");
+                fprintf(fp, "    %s_t block;\n", schema_offset_type_name(offset_type));
+                if (!schema_table_promoted(table)) {
+                        fprintf(fp, "    %s_t slot;\n", schema_offset_type_name(offset_type));
+                }
+                fprintf(fp, "    const uint8_t *present;\n");
+                fprintf(fp, "    present = ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ");\n", schema_count_type_size(count_type));
+                fprintf(fp, "    rank = 0;\n");
+                fprintf(fp, "    for (w = 0; w < element / 64; w++) {\n");
+                fprintf(fp, "        memcpy(&word, present + (w * 8), sizeof(word));\n");
+                fprintf(fp, "        rank += __builtin_popcountll(word);\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    word = 0;\n");
+                fprintf(fp, "    memcpy(&word, present + (w * 8), ((element %% 64) + 7) / 8);\n");
+                fprintf(fp, "    rank += __builtin_popcountll(word & ((UINT64_C(1) << (element %% 64)) - 1));\n");
+                fprintf(fp, "    memcpy(&block, ((const uint8_t *) decoder) + %s, sizeof(block));\n", header);
+                if (schema_table_promoted(table)) {
+                        fprintf(fp, "    return (block & ~UINT64_C(3)) + %s_promoted_load(((const uint8_t *) decoder) + (block & ~UINT64_C(3)) + (rank << (block & 3)), UINT64_C(1) << (block & 3));\n", schema->namespace);
+                } else {
+                        fprintf(fp, "    memcpy(&slot, ((const uint8_t *) decoder) + block + (rank * sizeof(slot)), sizeof(slot));\n");
+                        fprintf(fp, "    return block + slot;\n");
+                }
+                fprintf(fp, "}\n");
+        }
+        if (schema_table_promoted(table)) {
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_%s_promoted_get (const struct %s_%s *decoder, uint64_t count, uint64_t element)\n", schema->namespace, table->name, schema->namespace, table->name);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    %s_t block;\n", schema_offset_type_name(offset_type));
+                fprintf(fp, "    memcpy(&block, ((const uint8_t *) decoder) + %s, sizeof(block));\n", header);
+                fprintf(fp, "    return %s_promoted_load(((const uint8_t *) decoder) + %s_%s_sparse_offset(decoder, count, element), UINT64_C(1) << (block & 3));\n", schema->namespace, schema->namespace, table->name);
+                fprintf(fp, "}\n");
+        }
+
         table_field_i = 0;
         table_field_s = 0;
         TAILQ_FOREACH(table_field, &table->fields, list) {
                 struct schema_attribute *attribute;
                 struct namespace *attribute_string;
+                table_field_s = schema_align_offset(schema, table_field_s, schema_table_field_alignment(schema, offset_type, table_field));
+                field_offset = table_field_s;
+                if (schema_table_sparse(table)) {
+                        snprintf(fields, sizeof(fields), "%s_%s_sparse_offset(decoder, count, UINT64_C(%" PRIu64 "))", schema->namespace, table->name, table_field_i);
+                        field_offset = 0;
+                }
+                if (schema_table_promoted(table)) {
+                        snprintf(promoted, sizeof(promoted), "%s_%s_promoted_get(decoder, count, UINT64_C(%" PRIu64 "))", schema->namespace, table->name, table_field_i);
+                }
                 attribute_string = namespace_create();
                 namespace_push(attribute_string, "__attribute__ ((unused");
                 TAILQ_FOREACH(attribute, &table_field->attributes, list) {
@@ -1342,20 +2273,20 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
 
                 fprintf(fp, "%s int %s_%s_%s_present (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    %s_t count;\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "    %s_t count;\n", schema_count_type_name(count_type));
                 fprintf(fp, "    uint8_t present;\n");
                 if (decoder_use_memcpy) {
                         fprintf(fp, "    memcpy(&count, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(count));\n", UINT64_C(0));
                 } else {
-                        fprintf(fp, "    count = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_name(schema->count_type), UINT64_C(0));
+                        fprintf(fp, "    count = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_name(count_type), UINT64_C(0));
                 }
                 fprintf(fp, "    if (UINT64_C(%" PRIu64 ") >= count) {\n", table_field_i);
                 fprintf(fp, "        return 0;\n");
                 fprintf(fp, "    }\n");
                 if (decoder_use_memcpy) {
-                        fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(schema->count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                        fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
                 } else {
-                        fprintf(fp, "    present = *(uint8_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_size(schema->count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                        fprintf(fp, "    present = *(uint8_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
                 }
                 fprintf(fp, "    if (!(present & 0x%02x)) {\n", (1 << (table_field_i % 8)));
                 fprintf(fp, "        return 0;\n");
@@ -1363,9 +2294,168 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                 fprintf(fp, "    return 1;\n");
                 fprintf(fp, "}\n");
 
-                if (table_field->container == schema_container_type_vector) {
+                if (schema_table_field_packed(table_field)) {
+                        const char *delta;
+                        const char *varint;
+                        delta = (schema_table_field_encoding(table_field) == schema_encoding_type_delta_bitpack || schema_table_field_encoding(table_field) == schema_encoding_type_delta_varint) ? "1" : "0";
+                        varint = (schema_table_field_encoding(table_field) == schema_encoding_type_varint || schema_table_field_encoding(table_field) == schema_encoding_type_delta_varint) ? "1" : "0";
+
+                        fprintf(fp, "%s const struct %s_packed_vector * %s_%s_%s_get (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    %s_t offset;\n", (schema_table_promoted(table)) ? "uint64" : schema_offset_type_name(offset_type));
+                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(count_type));
+                        fprintf(fp, "    uint8_t present;\n");
+                        fprintf(fp, "    memcpy(&count, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(count));\n", UINT64_C(0));
+                        fprintf(fp, "    if (UINT64_C(%" PRIu64 ") >= count) {\n", table_field_i);
+                        fprintf(fp, "        return NULL;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                        fprintf(fp, "    if (!(present & 0x%02x)) {\n", (1 << (table_field_i % 8)));
+                        fprintf(fp, "        return NULL;\n");
+                        fprintf(fp, "    }\n");
+                        if (schema_table_promoted(table)) {
+                                fprintf(fp, "    offset = %s;\n", promoted);
+                        } else {
+                                fprintf(fp, "    memcpy(&offset, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(offset));\n", fields, field_offset);
+                        }
+                        fprintf(fp, "    return (const struct %s_packed_vector *) (((const uint8_t *) decoder) + offset);\n", schema->namespace);
+                        fprintf(fp, "}\n");
+
+                        fprintf(fp, "%s uint64_t %s_%s_%s_get_count (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_packed_vector_get_count(%s_%s_%s_get(decoder));\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+
+                        fprintf(fp, "%s %s_t %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", namespace_linearized(attribute_string), table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return (%s_t) %s_packed_vector_get_at(%s_%s_%s_get(decoder), at, %s, %s);\n", table_field->type, schema->namespace, schema->namespace, table->name, table_field->name, delta, varint);
+                        fprintf(fp, "}\n");
+
+                        fprintf(fp, "%s uint64_t %s_%s_%s_get_block (const struct %s_%s *decoder, uint64_t block, %s_t *values)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->type);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    uint64_t i;\n");
+                        fprintf(fp, "    uint64_t n;\n");
+                        fprintf(fp, "    uint64_t packed[%s_PACKED_VECTOR_BLOCK_SIZE];\n", schema->NAMESPACE);
+                        fprintf(fp, "    n = %s_packed_vector_get_block(%s_%s_%s_get(decoder), block, %s, %s, packed);\n", schema->namespace, schema->namespace, table->name, table_field->name, delta, varint);
+                        fprintf(fp, "    for (i = 0; i < n; i++) {\n");
+                        fprintf(fp, "        values[i] = (%s_t) packed[i];\n", table_field->type);
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return n;\n");
+                        fprintf(fp, "}\n");
+
+                        fprintf(fp, "%s uint64_t %s_%s_%s_decode (const struct %s_%s *decoder, %s_t *values, uint64_t count)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->type);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    uint64_t i;\n");
+                        fprintf(fp, "    uint64_t n;\n");
+                        fprintf(fp, "    uint64_t block;\n");
+                        fprintf(fp, "    uint64_t decoded;\n");
+                        fprintf(fp, "    uint64_t packed[%s_PACKED_VECTOR_BLOCK_SIZE];\n", schema->NAMESPACE);
+                        fprintf(fp, "    const struct %s_packed_vector *vector;\n", schema->namespace);
+                        fprintf(fp, "    vector = %s_%s_%s_get(decoder);\n", schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "    decoded = 0;\n");
+                        fprintf(fp, "    for (block = 0; decoded < count; block++) {\n");
+                        fprintf(fp, "        n = %s_packed_vector_get_block(vector, block, %s, %s, packed);\n", schema->namespace, delta, varint);
+                        fprintf(fp, "        if (n == 0) {\n");
+                        fprintf(fp, "            break;\n");
+                        fprintf(fp, "        }\n");
+                        fprintf(fp, "        for (i = 0; i < n && decoded < count; i++) {\n");
+                        fprintf(fp, "            values[decoded++] = (%s_t) packed[i];\n", table_field->type);
+                        fprintf(fp, "        }\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    return decoded;\n");
+                        fprintf(fp, "}\n");
+                } else if (schema_table_field_front_coded(table_field)) {
+                        fprintf(fp, "%s const struct %s_front_coded_vector * %s_%s_%s_get (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    %s_t offset;\n", (schema_table_promoted(table)) ? "uint64" : schema_offset_type_name(offset_type));
+                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(count_type));
+                        fprintf(fp, "    uint8_t present;\n");
+                        fprintf(fp, "    memcpy(&count, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(count));\n", UINT64_C(0));
+                        fprintf(fp, "    if (UINT64_C(%" PRIu64 ") >= count) {\n", table_field_i);
+                        fprintf(fp, "        return NULL;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                        fprintf(fp, "    if (!(present & 0x%02x)) {\n", (1 << (table_field_i % 8)));
+                        fprintf(fp, "        return NULL;\n");
+                        fprintf(fp, "    }\n");
+                        if (schema_table_promoted(table)) {
+                                fprintf(fp, "    offset = %s;\n", promoted);
+                        } else {
+                                fprintf(fp, "    memcpy(&offset, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(offset));\n", fields, field_offset);
+                        }
+                        fprintf(fp, "    return (const struct %s_front_coded_vector *) (((const uint8_t *) decoder) + offset);\n", schema->namespace);
+                        fprintf(fp, "}\n");
+
+                        fprintf(fp, "%s uint64_t %s_%s_%s_get_count (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_front_coded_vector_get_count(%s_%s_%s_get(decoder));\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s uint64_t %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at, char *buffer, uint64_t size)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_front_coded_vector_get_at(%s_%s_%s_get(decoder), at, buffer, size);\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s int64_t %s_%s_%s_find (const struct %s_%s *decoder, const char *key)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_front_coded_vector_find(%s_%s_%s_get(decoder), key);\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s int64_t %s_%s_%s_nfind (const struct %s_%s *decoder, const char *key, uint64_t length)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_front_coded_vector_nfind(%s_%s_%s_get(decoder), key, length);\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                } else if (schema_table_field_dictionary(table_field)) {
+                        fprintf(fp, "%s const struct %s_dictionary_vector * %s_%s_%s_get (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    %s_t offset;\n", (schema_table_promoted(table)) ? "uint64" : schema_offset_type_name(offset_type));
+                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(count_type));
+                        fprintf(fp, "    uint8_t present;\n");
+                        fprintf(fp, "    memcpy(&count, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(count));\n", UINT64_C(0));
+                        fprintf(fp, "    if (UINT64_C(%" PRIu64 ") >= count) {\n", table_field_i);
+                        fprintf(fp, "        return NULL;\n");
+                        fprintf(fp, "    }\n");
+                        fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                        fprintf(fp, "    if (!(present & 0x%02x)) {\n", (1 << (table_field_i % 8)));
+                        fprintf(fp, "        return NULL;\n");
+                        fprintf(fp, "    }\n");
+                        if (schema_table_promoted(table)) {
+                                fprintf(fp, "    offset = %s;\n", promoted);
+                        } else {
+                                fprintf(fp, "    memcpy(&offset, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(offset));\n", fields, field_offset);
+                        }
+                        fprintf(fp, "    return (const struct %s_dictionary_vector *) (((const uint8_t *) decoder) + offset);\n", schema->namespace);
+                        fprintf(fp, "}\n");
+
+                        fprintf(fp, "%s uint64_t %s_%s_%s_get_count (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_dictionary_vector_get_count(%s_%s_%s_get(decoder));\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s const char * %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_dictionary_vector_get_at(%s_%s_%s_get(decoder), at);\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s uint64_t %s_%s_%s_get_length_at (const struct %s_%s *decoder, uint64_t at)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_dictionary_vector_get_length_at(%s_%s_%s_get(decoder), at);\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s const struct %s_string_vector * %s_%s_%s_get_dictionary (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_dictionary_vector_get_dictionary(%s_%s_%s_get(decoder));\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s uint64_t %s_%s_%s_get_index_size (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_dictionary_vector_get_index_size(%s_%s_%s_get(decoder));\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s const void * %s_%s_%s_get_indices (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_dictionary_vector_get_indices(%s_%s_%s_get(decoder));\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                        fprintf(fp, "%s uint64_t %s_%s_%s_get_index_at (const struct %s_%s *decoder, uint64_t at)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        fprintf(fp, "    return %s_dictionary_vector_get_index_at(%s_%s_%s_get(decoder), at);\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                        fprintf(fp, "}\n");
+                } else if (table_field->container == schema_container_type_vector) {
                         fprintf(fp, "%s ", namespace_linearized(attribute_string));
-                        if (schema_type_is_scalar(table_field->type)) {
+                        if (schema_type_is_scalar(table_field->type) ||
+                            schema_type_is_bool(table_field->type)) {
                                 fprintf(fp, "const struct %s_%s_vector * %s_%s_%s_get (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         } else if (schema_type_is_float(table_field->type)) {
                                 fprintf(fp, "const struct %s_%s_vector * %s_%s_%s_get (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
@@ -1373,36 +2463,44 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "const struct %s_%s_vector * %s_%s_%s_get (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         } else if (schema_type_is_enum(schema, table_field->type)) {
                                 fprintf(fp, "const struct %s_%s_vector * %s_%s_%s_get (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
-                        } else if (schema_type_is_table(schema, table_field->type)) {
+                        } else if (schema_type_is_table(schema, table_field->type) ||
+                                   schema_type_is_struct(schema, table_field->type)) {
                                 fprintf(fp, "const struct %s_%s_vector * %s_%s_%s_get (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         }
                         fprintf(fp, "{\n");
-                        fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(schema->offset_type));
-                        if (decoder_use_memcpy) {
-                                fprintf(fp, "    %s_t toffset;\n", schema_offset_type_name(schema->offset_type));
+                        if (schema_table_promoted(table)) {
+                                fprintf(fp, "    uint64_t offset;\n");
+                        } else {
+                                fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(offset_type));
                         }
-                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(schema->count_type));
+                        if (decoder_use_memcpy &&
+                            !schema_table_promoted(table)) {
+                                fprintf(fp, "    %s_t toffset;\n", schema_offset_type_name(offset_type));
+                        }
+                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(count_type));
                         fprintf(fp, "    uint8_t present;\n");
                         if (decoder_use_memcpy) {
                                 fprintf(fp, "    memcpy(&count, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(count));\n", UINT64_C(0));
                         } else {
-                                fprintf(fp, "    count = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_name(schema->count_type), UINT64_C(0));
+                                fprintf(fp, "    count = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_name(count_type), UINT64_C(0));
                         }
                         fprintf(fp, "    if (UINT64_C(%" PRIu64 ") >= count) {\n", table_field_i);
                         fprintf(fp, "        return NULL;\n");
                         fprintf(fp, "    }\n");
                         if (decoder_use_memcpy) {
-                                fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(schema->count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                                fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
                         } else {
-                                fprintf(fp, "    present = *(uint8_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_size(schema->count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                                fprintf(fp, "    present = *(uint8_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
                         }
                         fprintf(fp, "    if (!(present & 0x%02x)) {\n", (1 << (table_field_i % 8)));
                         fprintf(fp, "        return NULL;\n");
                         fprintf(fp, "    }\n");
-                        if (decoder_use_memcpy) {
-                                fprintf(fp, "    offset = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type), table_field_s);
+                        if (schema_table_promoted(table)) {
+                                fprintf(fp, "    offset = %s;\n", promoted);
+                        } else if (decoder_use_memcpy) {
+                                fprintf(fp, "    offset = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(offset_type), fields, field_offset);
                         } else {
-                                fprintf(fp, "    offset = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type), table_field_s);
+                                fprintf(fp, "    offset = *(%s_t *) (((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(offset_type), fields, field_offset);
                         }
                         fprintf(fp, "    return (const struct %s_%s_vector *) (((const uint8_t *) decoder) + offset);\n", schema->namespace, table_field->type);
                         fprintf(fp, "}\n");
@@ -1415,7 +2513,8 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
 
                         if (schema_type_is_scalar(table_field->type) ||
                             schema_type_is_float(table_field->type) ||
-                            schema_type_is_enum(schema, table_field->type)) {
+                            schema_type_is_enum(schema, table_field->type) ||
+                            schema_type_is_struct(schema, table_field->type)) {
                                 fprintf(fp, "%s ", namespace_linearized(attribute_string));
                                 fprintf(fp, "uint64_t %s_%s_%s_get_length (const struct %s_%s *decoder)\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                                 fprintf(fp, "{\n");
@@ -1426,9 +2525,11 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                                 if (schema_type_is_scalar(table_field->type)) {
                                         fprintf(fp, "const %s_t * %s_%s_%s_get_values (const struct %s_%s *decoder)\n", table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                                 } else if (schema_type_is_float(table_field->type)) {
-                                        fprintf(fp, "const %s * %s_%s_%s_get_values (const struct %s_%s *decoder)\n", table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                        fprintf(fp, "const %s * %s_%s_%s_get_values (const struct %s_%s *decoder)\n", schema_float_storage_type(table_field->type), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                                 } else if (schema_type_is_enum(schema, table_field->type)) {
                                         fprintf(fp, "const %s_%s_t * %s_%s_%s_get_values (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                } else if (schema_type_is_struct(schema, table_field->type)) {
+                                        fprintf(fp, "const struct %s_%s * %s_%s_%s_get_values (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                                 }
                                 fprintf(fp, "{\n");
                                 fprintf(fp, "    return %s_%s_vector_get_values(%s_%s_%s_get(decoder));\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
@@ -1439,37 +2540,78 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                         if (schema_type_is_scalar(table_field->type)) {
                                 fprintf(fp, "%s_t %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         } else if (schema_type_is_float(table_field->type)) {
-                                fprintf(fp, "%s %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "%s %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", schema_float_value_type(table_field->type), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        } else if (schema_type_is_bool(table_field->type)) {
+                                fprintf(fp, "int %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         } else if (schema_type_is_enum(schema, table_field->type)) {
                                 fprintf(fp, "%s_%s_t %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         } else if (schema_type_is_string(table_field->type)) {
                                 fprintf(fp, "const char * %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name);
-                        } else if (schema_type_is_table(schema, table_field->type)) {
+                        } else if (schema_type_is_table(schema, table_field->type) ||
+                                   schema_type_is_struct(schema, table_field->type)) {
                                 fprintf(fp, "const struct %s_%s * %s_%s_%s_get_at (const struct %s_%s *decoder, uint64_t at)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         }
                         fprintf(fp, "{\n");
                         fprintf(fp, "    return %s_%s_vector_get_at(%s_%s_%s_get(decoder), at);\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
                         fprintf(fp, "}\n");
+
+                        if (schema_type_is_string(table_field->type)) {
+                                fprintf(fp, "%s uint64_t %s_%s_%s_get_length_at (const struct %s_%s *decoder, uint64_t at)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return %s_%s_vector_get_length_at(%s_%s_%s_get(decoder), at);\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                        }
+                        if (schema_type_is_bool(table_field->type)) {
+                                fprintf(fp, "%s const uint8_t * %s_%s_%s_get_bits (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return %s_%s_vector_get_bits(%s_%s_%s_get(decoder));\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "%s uint64_t %s_%s_%s_get_popcount (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return %s_%s_vector_get_popcount(%s_%s_%s_get(decoder));\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "%s uint64_t %s_%s_%s_get_next (const struct %s_%s *decoder, uint64_t at)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return %s_%s_vector_get_next(%s_%s_%s_get(decoder), at);\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                        }
+                        if (schema_type_is_half(table_field->type)) {
+                                fprintf(fp, "%s uint64_t %s_%s_%s_get_floats (const struct %s_%s *decoder, float *values, uint64_t count)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return %s_%s_vector_get_floats(%s_%s_%s_get(decoder), values, count);\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                        }
+                } else if (schema_type_is_bool(table_field->type)) {
+                        fprintf(fp, "%s int %s_%s_%s_get (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        fprintf(fp, "{\n");
+                        if (schema_table_field_bool_default(table_field)) {
+                                fprintf(fp, "    return !%s_%s_%s_present(decoder);\n", schema->namespace, table->name, table_field->name);
+                        } else {
+                                fprintf(fp, "    return %s_%s_%s_present(decoder);\n", schema->namespace, table->name, table_field->name);
+                        }
+                        fprintf(fp, "}\n");
                 } else {
                         fprintf(fp, "%s ", namespace_linearized(attribute_string));
                         if (schema_type_is_scalar(table_field->type)) {
                                 fprintf(fp, "%s_t %s_%s_%s_get (const struct %s_%s *decoder)\n", table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         } else if (schema_type_is_float(table_field->type)) {
-                                fprintf(fp, "%s %s_%s_%s_get (const struct %s_%s *decoder)\n", table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
-                        } else if (schema_type_is_string(table_field->type)) {
+                                fprintf(fp, "%s %s_%s_%s_get (const struct %s_%s *decoder)\n", schema_float_value_type(table_field->type), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                        } else if (schema_type_is_string(table_field->type) ||
+                                   schema_type_is_bytes(table_field->type)) {
                                 fprintf(fp, "const struct %s_%s * %s_%s_%s_get (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         } else if (schema_type_is_enum(schema, table_field->type)) {
                                 fprintf(fp, "%s_%s_t %s_%s_%s_get (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
-                        } else         if (schema_type_is_table(schema, table_field->type)) {
+                        } else         if (schema_type_is_table(schema, table_field->type) ||
+                                           schema_type_is_struct(schema, table_field->type)) {
                                 fprintf(fp, "const struct %s_%s * %s_%s_%s_get (const struct %s_%s *decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name, schema->namespace, table->name);
                         }
                         fprintf(fp, "{\n");
-                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(schema->count_type));
+                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(count_type));
                         fprintf(fp, "    uint8_t present;\n");
                         if (decoder_use_memcpy) {
                                 fprintf(fp, "    memcpy(&count, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(count));\n", UINT64_C(0));
                         } else {
-                                fprintf(fp, "    count = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_name(schema->count_type), UINT64_C(0));
+                                fprintf(fp, "    count = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_name(count_type), UINT64_C(0));
                         }
                         fprintf(fp, "    if (UINT64_C(%" PRIu64 ") >= count) {\n", table_field_i);
                         if (schema_type_is_scalar(table_field->type) ||
@@ -1492,9 +2634,9 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                         }
                         fprintf(fp, "    }\n");
                         if (decoder_use_memcpy) {
-                                fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(schema->count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                                fprintf(fp, "    memcpy(&present, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(present));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
                         } else {
-                                fprintf(fp, "    present = *(uint8_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_size(schema->count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                                fprintf(fp, "    present = *(uint8_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
                         }
                         fprintf(fp, "    if (!(present & 0x%02x)) {\n", (1 << (table_field_i % 8)));
                         if (schema_type_is_scalar(table_field->type) ||
@@ -1513,42 +2655,60 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                         if (schema_type_is_scalar(table_field->type)) {
                                 if (decoder_use_memcpy) {
                                         fprintf(fp, "    %s_t value;\n", table_field->type);
-                                        fprintf(fp, "    return *(%s_t *) memcpy(&value, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "), sizeof(value));\n", table_field->type, schema_count_type_size(schema->count_type), table_field_s);
+                                        fprintf(fp, "    return *(%s_t *) memcpy(&value, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(value));\n", table_field->type, fields, field_offset);
+                                } else {
+                                        fprintf(fp, "    return *(%s_t *) (((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "));\n", table_field->type, fields, field_offset);
+                                }
+                        } else if (schema_type_is_half(table_field->type)) {
+                                if (decoder_use_memcpy) {
+                                        fprintf(fp, "    uint16_t value;\n");
+                                        fprintf(fp, "    return %s_%s_to_float(*(uint16_t *) memcpy(&value, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(value)));\n", schema->namespace, table_field->type, fields, field_offset);
                                 } else {
-                                        fprintf(fp, "    return *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "));\n", table_field->type, schema_count_type_size(schema->count_type), table_field_s);
+                                        fprintf(fp, "    return %s_%s_to_float(*(uint16_t *) (((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 ")));\n", schema->namespace, table_field->type, fields, field_offset);
                                 }
                         } else if (schema_type_is_float(table_field->type)) {
                                 if (decoder_use_memcpy) {
                                         fprintf(fp, "    %s value;\n", table_field->type);
-                                        fprintf(fp, "    return *(%s *) memcpy(&value, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "), sizeof(value));\n", table_field->type, schema_count_type_size(schema->count_type), table_field_s);
+                                        fprintf(fp, "    return *(%s *) memcpy(&value, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(value));\n", table_field->type, fields, field_offset);
                                 } else {
-                                        fprintf(fp, "    return *(%s *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "));\n", table_field->type, schema_count_type_size(schema->count_type), table_field_s);
+                                        fprintf(fp, "    return *(%s *) (((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "));\n", table_field->type, fields, field_offset);
                                 }
                         } else if (schema_type_is_enum(schema, table_field->type)) {
                                 if (decoder_use_memcpy) {
                                         fprintf(fp, "    %s_%s_t value;\n", schema->namespace, table_field->type);
-                                        fprintf(fp, "    return *(%s_%s_t *) memcpy(&value, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "), sizeof(value));\n", schema->namespace, table_field->type, schema_count_type_size(schema->count_type), table_field_s);
+                                        fprintf(fp, "    return *(%s_%s_t *) memcpy(&value, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(value));\n", schema->namespace, table_field->type, fields, field_offset);
                                 } else {
-                                        fprintf(fp, "    return *(%s_%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "));\n", schema->namespace, table_field->type, schema_count_type_size(schema->count_type), table_field_s);
+                                        fprintf(fp, "    return *(%s_%s_t *) (((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "));\n", schema->namespace, table_field->type, fields, field_offset);
                                 }
-                        } else if (schema_type_is_string(table_field->type)) {
-                                fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(schema->offset_type));
-                                if (decoder_use_memcpy) {
-                                        fprintf(fp, "    %s_t toffset;\n", schema_offset_type_name(schema->offset_type));
-                                        fprintf(fp, "    offset = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type), table_field_s);
+                        } else if (schema_type_is_string(table_field->type) ||
+                                   schema_type_is_bytes(table_field->type)) {
+                                if (schema_table_promoted(table)) {
+                                        fprintf(fp, "    uint64_t offset;\n");
+                                        fprintf(fp, "    offset = %s;\n", promoted);
+                                } else if (decoder_use_memcpy) {
+                                        fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(offset_type));
+                                        fprintf(fp, "    %s_t toffset;\n", schema_offset_type_name(offset_type));
+                                        fprintf(fp, "    offset = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(offset_type), fields, field_offset);
                                 } else {
-                                        fprintf(fp, "    offset = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type), table_field_s);
+                                        fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(offset_type));
+                                        fprintf(fp, "    offset = *(%s_t *) (((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(offset_type), fields, field_offset);
                                 }
                                 fprintf(fp, "    return (const struct %s_%s *) (((const uint8_t *) decoder) + offset);\n", schema->namespace, table_field->type);
                         } else if (schema_type_is_table(schema, table_field->type)) {
-                                fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(schema->offset_type));
-                                if (decoder_use_memcpy) {
-                                        fprintf(fp, "    %s_t toffset;\n", schema_offset_type_name(schema->offset_type));
-                                        fprintf(fp, "    offset = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type), table_field_s);
+                                if (schema_table_promoted(table)) {
+                                        fprintf(fp, "    uint64_t offset;\n");
+                                        fprintf(fp, "    offset = %s;\n", promoted);
+                                } else if (decoder_use_memcpy) {
+                                        fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(offset_type));
+                                        fprintf(fp, "    %s_t toffset;\n", schema_offset_type_name(offset_type));
+                                        fprintf(fp, "    offset = *(%s_t *) memcpy(&toffset, ((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "), sizeof(offset));\n", schema_offset_type_name(offset_type), fields, field_offset);
                                 } else {
-                                        fprintf(fp, "    offset = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + ((count + 7) / 8) + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type), table_field_s);
+                                        fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(offset_type));
+                                        fprintf(fp, "    offset = *(%s_t *) (((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "));\n", schema_offset_type_name(offset_type), fields, field_offset);
                                 }
                                 fprintf(fp, "    return (const struct %s_%s *) (((const uint8_t *) decoder) + offset);\n", schema->namespace, table_field->type);
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "    return (const struct %s_%s *) (((const uint8_t *) decoder) + %s + UINT64_C(%" PRIu64 "));\n", schema->namespace, table_field->type, fields, field_offset);
                         }
                         fprintf(fp, "}\n");
 
@@ -1562,21 +2722,59 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "    }\n");
                                 fprintf(fp, "    return %s_%s_value(string);\n", schema->namespace, table_field->type);
                                 fprintf(fp, "}\n");
+
+                                fprintf(fp, "%s uint64_t %s_%s_%s_get_length (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                if (table_field->value != NULL) {
+                                        fprintf(fp, "    %s_t count;\n", schema_count_type_name(count_type));
+                                        if (decoder_use_memcpy) {
+                                                fprintf(fp, "    memcpy(&count, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(count));\n", UINT64_C(0));
+                                        } else {
+                                                fprintf(fp, "    count = *(%s_t *) (((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "));\n", schema_count_type_name(count_type), UINT64_C(0));
+                                        }
+                                        fprintf(fp, "    if (UINT64_C(%" PRIu64 ") >= count) {\n", table_field_i);
+                                        fprintf(fp, "        return sizeof(\"%s\") - 1;\n", table_field->value);
+                                        fprintf(fp, "    }\n");
+                                }
+                                fprintf(fp, "    return %s_%s_length(%s_%s_%s_get(decoder));\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+
+                                fprintf(fp, "%s const char * %s_%s_%s_get_nvalue (const struct %s_%s *decoder, uint64_t *length)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    *length = %s_%s_%s_get_length(decoder);\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "    return %s_%s_%s_get_value(decoder);\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                        }
+                        if (schema_type_is_bytes(table_field->type)) {
+                                fprintf(fp, "%s const void * %s_%s_%s_get_value (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return %s_bytes_value(%s_%s_%s_get(decoder));\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
+                                fprintf(fp, "%s uint64_t %s_%s_%s_get_length (const struct %s_%s *decoder)\n", namespace_linearized(attribute_string), schema->namespace, table->name, table_field->name, schema->namespace, table->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    return %s_bytes_length(%s_%s_%s_get(decoder));\n", schema->namespace, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "}\n");
                         }
                 }
                 table_field_i += 1;
                 if (table_field->container == schema_container_type_vector) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_scalar(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_float(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
+                } else if (schema_type_is_bool(table_field->type)) {
+                        table_field_s += schema_table_field_size(schema, offset_type, table_field);
                 } else if (schema_type_is_string(table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_bytes(table_field->type)) {
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_enum(schema, table_field->type)) {
                         table_field_s += schema_inttype_size(schema_type_get_enum(schema, table_field->type)->type);
                 } else if (schema_type_is_table(schema, table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_struct(schema, table_field->type)) {
+                        table_field_s += schema_struct_size(schema, schema_type_get_table(schema, table_field->type));
                 }
                 namespace_destroy(attribute_string);
         }
@@ -1619,17 +2817,269 @@ int schema_generate_c_decoder (struct schema *schema, FILE *fp, int decoder_use_
                 }
         }
 
-        if (schema_has_string(schema)) {
+        if (schema_has_encoding(schema, schema_table_field_half)) {
+                rc = schema_generate_half(schema, fp);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not generate half");
+                        goto bail;
+                }
+        }
+
+        TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type != schema_container_type_struct) {
+                        continue;
+                }
+                rc = schema_generate_struct(schema, table, fp);
+                if (rc != 0) {
+                        linearbuffers_errorf("can not generate struct");
+                        goto bail;
+                }
+        }
+
+        if (schema_has_string(schema)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_STRING_DECODER_API)\n", schema->NAMESPACE);
+                fprintf(fp, "#define %s_STRING_DECODER_API\n", schema->NAMESPACE);
+
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_string;\n", schema->namespace);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const char * %s_string_value (const struct %s_string *string)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return (const char *) string;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline uint64_t %s_string_length (const struct %s_string *string)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (string == NULL) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                if (schema->string_type == schema_string_type_prefixed) {
+                        if (decoder_use_memcpy) {
+                                fprintf(fp, "    %s_t length;\n", schema_count_type_name(schema->count_type));
+                                fprintf(fp, "    return *(%s_t *) memcpy(&length, ((const uint8_t *) string) - sizeof(length), sizeof(length));\n", schema_count_type_name(schema->count_type));
+                        } else {
+                                fprintf(fp, "    return *(%s_t *) (((const uint8_t *) string) - sizeof(%s_t));\n", schema_count_type_name(schema->count_type), schema_count_type_name(schema->count_type));
+                        }
+                } else {
+                        fprintf(fp, "    return strlen((const char *) string);\n");
+                }
+                fprintf(fp, "}\n");
+
+                fprintf(fp, "\n");
+                fprintf(fp, "#endif\n");
+        }
+
+        if (schema_has_bytes(schema)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_BYTES_DECODER_API)\n", schema->NAMESPACE);
+                fprintf(fp, "#define %s_BYTES_DECODER_API\n", schema->NAMESPACE);
+
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_bytes;\n", schema->namespace);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline uint64_t %s_bytes_length (const struct %s_bytes *bytes)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (bytes == NULL) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                if (decoder_use_memcpy) {
+                        fprintf(fp, "    %s_t length;\n", schema_count_type_name(schema->count_type));
+                        fprintf(fp, "    return *(%s_t *) memcpy(&length, ((const uint8_t *) bytes), sizeof(length));\n", schema_count_type_name(schema->count_type));
+                } else {
+                        fprintf(fp, "    return *(%s_t *) (((const uint8_t *) bytes));\n", schema_count_type_name(schema->count_type));
+                }
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const void * %s_bytes_value (const struct %s_bytes *bytes)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (bytes == NULL) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return ((const uint8_t *) bytes) + UINT64_C(%" PRIu64 ");\n", schema_count_type_size(schema->count_type));
+                fprintf(fp, "}\n");
+
+                fprintf(fp, "\n");
+                fprintf(fp, "#endif\n");
+        }
+
+        if (schema_has_encoding(schema, schema_table_field_packed)) {
                 fprintf(fp, "\n");
-                fprintf(fp, "#if !defined(%s_STRING_DECODER_API)\n", schema->NAMESPACE);
-                fprintf(fp, "#define %s_STRING_DECODER_API\n", schema->NAMESPACE);
+                fprintf(fp, "#if !defined(%s_PACKED_VECTOR_DECODER_API)\n", schema->NAMESPACE);
+                fprintf(fp, "#define %s_PACKED_VECTOR_DECODER_API\n", schema->NAMESPACE);
 
                 fprintf(fp, "\n");
-                fprintf(fp, "struct %s_string;\n", schema->namespace);
+                fprintf(fp, "#if defined(__AVX2__)\n");
+                fprintf(fp, "#include <immintrin.h>\n");
+                fprintf(fp, "#elif defined(__SSE2__)\n");
+                fprintf(fp, "#include <emmintrin.h>\n");
+                fprintf(fp, "#endif\n");
                 fprintf(fp, "\n");
-                fprintf(fp, "__attribute__((unused, warn_unused_result)) static inline const char * %s_string_value (const struct %s_string *string)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "#define %s_PACKED_VECTOR_BLOCK_SIZE 128\n", schema->NAMESPACE);
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_packed_vector;\n", schema->namespace);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_packed_vector_get_count (const struct %s_packed_vector *decoder)\n", schema->namespace, schema->namespace);
                 fprintf(fp, "{\n");
-                fprintf(fp, "    return (const char *) string;\n");
+                fprintf(fp, "    %s_t count;\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return *(%s_t *) memcpy(&count, ((const uint8_t *) decoder), sizeof(count));\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline const uint8_t * %s_packed_vector_get_block_buffer (const struct %s_packed_vector *decoder, uint64_t block)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "    memcpy(&offset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + (block * sizeof(offset)), sizeof(offset));\n", schema_align_offset(schema, schema_count_type_size(schema->count_type), schema_offset_type_size(schema->offset_type)));
+                fprintf(fp, "    return ((const uint8_t *) decoder) + offset;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_packed_vector_bits (const uint8_t *payload, uint64_t width, uint64_t at)\n", schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint64_t bit;\n");
+                fprintf(fp, "    uint64_t word;\n");
+                fprintf(fp, "    if (width == 0) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    bit = at * width;\n");
+                fprintf(fp, "    memcpy(&word, payload + (bit / 8), sizeof(word));\n");
+                fprintf(fp, "    word >>= bit %% 8;\n");
+                fprintf(fp, "    if ((bit %% 8) + width > 64) {\n");
+                fprintf(fp, "        word |= ((uint64_t) payload[(bit / 8) + 8]) << (64 - (bit %% 8));\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    if (width < 64) {\n");
+                fprintf(fp, "        word &= (UINT64_C(1) << width) - 1;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return word;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline void %s_packed_vector_unpack (const uint8_t *payload, uint64_t width, uint64_t reference, uint64_t *values, uint64_t n)\n", schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint64_t i;\n");
+                fprintf(fp, "    i = 0;\n");
+                fprintf(fp, "#if defined(__AVX2__)\n");
+                fprintf(fp, "    if (width > 0 && width <= 56) {\n");
+                fprintf(fp, "        __m256i bit;\n");
+                fprintf(fp, "        __m256i step;\n");
+                fprintf(fp, "        __m256i mask;\n");
+                fprintf(fp, "        __m256i base;\n");
+                fprintf(fp, "        __m256i word;\n");
+                fprintf(fp, "        bit  = _mm256_set_epi64x((long long) (3 * width), (long long) (2 * width), (long long) width, 0);\n");
+                fprintf(fp, "        step = _mm256_set1_epi64x((long long) (4 * width));\n");
+                fprintf(fp, "        mask = _mm256_set1_epi64x((long long) ((UINT64_C(1) << width) - 1));\n");
+                fprintf(fp, "        base = _mm256_set1_epi64x((long long) reference);\n");
+                fprintf(fp, "        for (; i + 4 <= n; i += 4) {\n");
+                fprintf(fp, "            word = _mm256_i64gather_epi64((const long long *) payload, _mm256_srli_epi64(bit, 3), 1);\n");
+                fprintf(fp, "            word = _mm256_srlv_epi64(word, _mm256_and_si256(bit, _mm256_set1_epi64x(7)));\n");
+                fprintf(fp, "            word = _mm256_add_epi64(_mm256_and_si256(word, mask), base);\n");
+                fprintf(fp, "            _mm256_storeu_si256((__m256i *) (values + i), word);\n");
+                fprintf(fp, "            bit  = _mm256_add_epi64(bit, step);\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "#elif defined(__SSE2__)\n");
+                fprintf(fp, "    if (width > 0 && width <= 25) {\n");
+                fprintf(fp, "        uint32_t lo;\n");
+                fprintf(fp, "        uint32_t hi;\n");
+                fprintf(fp, "        uint64_t bit;\n");
+                fprintf(fp, "        __m128i mask;\n");
+                fprintf(fp, "        __m128i base;\n");
+                fprintf(fp, "        __m128i word;\n");
+                fprintf(fp, "        __m128i shift;\n");
+                fprintf(fp, "        mask = _mm_set1_epi64x((long long) ((UINT64_C(1) << width) - 1));\n");
+                fprintf(fp, "        base = _mm_set1_epi64x((long long) reference);\n");
+                fprintf(fp, "        for (; i + 2 <= n; i += 2) {\n");
+                fprintf(fp, "            /* no variable shifts in sse2, multiply by 2^(7 - shift) and\n");
+                fprintf(fp, "             * shift both lanes right by 7 instead. */\n");
+                fprintf(fp, "            bit = i * width;\n");
+                fprintf(fp, "            memcpy(&lo, payload + (bit / 8), sizeof(lo));\n");
+                fprintf(fp, "            memcpy(&hi, payload + ((bit + width) / 8), sizeof(hi));\n");
+                fprintf(fp, "            word  = _mm_set_epi32(0, (int) hi, 0, (int) lo);\n");
+                fprintf(fp, "            shift = _mm_set_epi32(0, 1 << (7 - ((bit + width) %% 8)), 0, 1 << (7 - (bit %% 8)));\n");
+                fprintf(fp, "            word  = _mm_srli_epi64(_mm_mul_epu32(word, shift), 7);\n");
+                fprintf(fp, "            word  = _mm_add_epi64(_mm_and_si128(word, mask), base);\n");
+                fprintf(fp, "            _mm_storeu_si128((__m128i *) (values + i), word);\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "#endif\n");
+                fprintf(fp, "    for (; i < n; i++) {\n");
+                fprintf(fp, "        values[i] = reference + %s_packed_vector_bits(payload, width, i);\n", schema->namespace);
+                fprintf(fp, "    }\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_packed_vector_varint (const uint8_t **payload)\n", schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint8_t byte;\n");
+                fprintf(fp, "    uint64_t shift;\n");
+                fprintf(fp, "    uint64_t value;\n");
+                fprintf(fp, "    value = 0;\n");
+                fprintf(fp, "    for (shift = 0; shift < 64; shift += 7) {\n");
+                fprintf(fp, "        byte = *(*payload)++;\n");
+                fprintf(fp, "        value |= ((uint64_t) (byte & 0x7f)) << shift;\n");
+                fprintf(fp, "        if (!(byte & 0x80)) {\n");
+                fprintf(fp, "            break;\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return value;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_packed_vector_get_block (const struct %s_packed_vector *decoder, uint64_t block, int delta, int varint, uint64_t *values)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint64_t i;\n");
+                fprintf(fp, "    uint64_t n;\n");
+                fprintf(fp, "    uint64_t count;\n");
+                fprintf(fp, "    uint64_t width;\n");
+                fprintf(fp, "    uint64_t residual;\n");
+                fprintf(fp, "    uint64_t reference;\n");
+                fprintf(fp, "    const uint8_t *payload;\n");
+                fprintf(fp, "    count = %s_packed_vector_get_count(decoder);\n", schema->namespace);
+                fprintf(fp, "    if (block >= (count + %s_PACKED_VECTOR_BLOCK_SIZE - 1) / %s_PACKED_VECTOR_BLOCK_SIZE) {\n", schema->NAMESPACE, schema->NAMESPACE);
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    n = count - (block * %s_PACKED_VECTOR_BLOCK_SIZE);\n", schema->NAMESPACE);
+                fprintf(fp, "    if (n > %s_PACKED_VECTOR_BLOCK_SIZE) {\n", schema->NAMESPACE);
+                fprintf(fp, "        n = %s_PACKED_VECTOR_BLOCK_SIZE;\n", schema->NAMESPACE);
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    payload = %s_packed_vector_get_block_buffer(decoder, block);\n", schema->namespace);
+                fprintf(fp, "    memcpy(&reference, payload, sizeof(reference));\n");
+                fprintf(fp, "    width = payload[sizeof(reference)];\n");
+                fprintf(fp, "    payload += sizeof(reference) + sizeof(uint8_t);\n");
+                fprintf(fp, "    if (delta) {\n");
+                fprintf(fp, "        if (!varint) {\n");
+                fprintf(fp, "            %s_packed_vector_unpack(payload, width, 0, values + 1, n - 1);\n", schema->namespace);
+                fprintf(fp, "        }\n");
+                fprintf(fp, "        values[0] = reference;\n");
+                fprintf(fp, "        for (i = 1; i < n; i++) {\n");
+                fprintf(fp, "            residual = (varint) ? %s_packed_vector_varint(&payload) : values[i];\n", schema->namespace);
+                fprintf(fp, "            values[i] = values[i - 1] + ((residual >> 1) ^ (0 - (residual & 1)));\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    } else if (varint) {\n");
+                fprintf(fp, "        for (i = 0; i < n; i++) {\n");
+                fprintf(fp, "            values[i] = reference + %s_packed_vector_varint(&payload);\n", schema->namespace);
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    } else {\n");
+                fprintf(fp, "        %s_packed_vector_unpack(payload, width, reference, values, n);\n", schema->namespace);
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return n;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_packed_vector_get_at (const struct %s_packed_vector *decoder, uint64_t at, int delta, int varint)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint64_t i;\n");
+                fprintf(fp, "    uint64_t width;\n");
+                fprintf(fp, "    uint64_t value;\n");
+                fprintf(fp, "    uint64_t residual;\n");
+                fprintf(fp, "    const uint8_t *payload;\n");
+                fprintf(fp, "    payload = %s_packed_vector_get_block_buffer(decoder, at / %s_PACKED_VECTOR_BLOCK_SIZE);\n", schema->namespace, schema->NAMESPACE);
+                fprintf(fp, "    memcpy(&value, payload, sizeof(value));\n");
+                fprintf(fp, "    width = payload[sizeof(value)];\n");
+                fprintf(fp, "    payload += sizeof(value) + sizeof(uint8_t);\n");
+                fprintf(fp, "    at %%= %s_PACKED_VECTOR_BLOCK_SIZE;\n", schema->NAMESPACE);
+                fprintf(fp, "    if (!delta && !varint) {\n");
+                fprintf(fp, "        return value + %s_packed_vector_bits(payload, width, at);\n", schema->namespace);
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    for (i = 0; i < at; i++) {\n");
+                fprintf(fp, "        residual = (varint) ? %s_packed_vector_varint(&payload) : %s_packed_vector_bits(payload, width, i);\n", schema->namespace, schema->namespace);
+                fprintf(fp, "        if (delta) {\n");
+                fprintf(fp, "            value += (residual >> 1) ^ (0 - (residual & 1));\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    if (!delta) {\n");
+                fprintf(fp, "        value += %s_packed_vector_varint(&payload);\n", schema->namespace);
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return value;\n");
                 fprintf(fp, "}\n");
 
                 fprintf(fp, "\n");
@@ -1667,6 +3117,15 @@ int schema_generate_c_decoder (struct schema *schema, FILE *fp, int decoder_use_
         if (schema_has_vector(schema, "double")) {
                 rc |= schema_generate_vector_decoder(schema, "double", decoder_use_memcpy, fp);
         }
+        if (schema_has_vector(schema, "float16")) {
+                rc |= schema_generate_vector_decoder(schema, "float16", decoder_use_memcpy, fp);
+        }
+        if (schema_has_vector(schema, "bfloat16")) {
+                rc |= schema_generate_vector_decoder(schema, "bfloat16", decoder_use_memcpy, fp);
+        }
+        if (schema_has_vector(schema, "bool")) {
+                rc |= schema_generate_vector_decoder(schema, "bool", decoder_use_memcpy, fp);
+        }
         if (schema_has_vector(schema, "string")) {
                 rc |= schema_generate_vector_decoder(schema, "string", decoder_use_memcpy, fp);
         }
@@ -1686,7 +3145,236 @@ int schema_generate_c_decoder (struct schema *schema, FILE *fp, int decoder_use_
                 goto bail;
         }
 
+        if (schema_has_encoding(schema, schema_table_field_front_coded)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_FRONT_CODED_VECTOR_DECODER_API)\n", schema->NAMESPACE);
+                fprintf(fp, "#define %s_FRONT_CODED_VECTOR_DECODER_API\n", schema->NAMESPACE);
+
+                fprintf(fp, "\n");
+                fprintf(fp, "#define %s_FRONT_CODED_VECTOR_RESTART_INTERVAL 16\n", schema->NAMESPACE);
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_front_coded_vector;\n", schema->namespace);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_front_coded_vector_get_count (const struct %s_front_coded_vector *decoder)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    %s_t count;\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return *(%s_t *) memcpy(&count, ((const uint8_t *) decoder), sizeof(count));\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline const uint8_t * %s_front_coded_vector_get_restart (const struct %s_front_coded_vector *decoder, uint64_t restart)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "    memcpy(&offset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ") + (restart * sizeof(offset)), sizeof(offset));\n", schema_align_offset(schema, schema_count_type_size(schema->count_type), schema_offset_type_size(schema->offset_type)));
+                fprintf(fp, "    return ((const uint8_t *) decoder) + offset;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_front_coded_vector_varint (const uint8_t **payload)\n", schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint8_t byte;\n");
+                fprintf(fp, "    uint64_t shift;\n");
+                fprintf(fp, "    uint64_t value;\n");
+                fprintf(fp, "    value = 0;\n");
+                fprintf(fp, "    for (shift = 0; shift < 64; shift += 7) {\n");
+                fprintf(fp, "        byte = *(*payload)++;\n");
+                fprintf(fp, "        value |= ((uint64_t) (byte & 0x7f)) << shift;\n");
+                fprintf(fp, "        if (!(byte & 0x80)) {\n");
+                fprintf(fp, "            break;\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return value;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_front_coded_vector_get_at (const struct %s_front_coded_vector *decoder, uint64_t at, char *buffer, uint64_t size)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint64_t i;\n");
+                fprintf(fp, "    uint64_t shared;\n");
+                fprintf(fp, "    uint64_t suffix;\n");
+                fprintf(fp, "    uint64_t length;\n");
+                fprintf(fp, "    const uint8_t *payload;\n");
+                fprintf(fp, "    length = 0;\n");
+                fprintf(fp, "    payload = %s_front_coded_vector_get_restart(decoder, at / %s_FRONT_CODED_VECTOR_RESTART_INTERVAL);\n", schema->namespace, schema->NAMESPACE);
+                fprintf(fp, "    for (i = 0; i <= at %% %s_FRONT_CODED_VECTOR_RESTART_INTERVAL; i++) {\n", schema->NAMESPACE);
+                fprintf(fp, "        shared = %s_front_coded_vector_varint(&payload);\n", schema->namespace);
+                fprintf(fp, "        suffix = %s_front_coded_vector_varint(&payload);\n", schema->namespace);
+                fprintf(fp, "        if (shared + 1 < size) {\n");
+                fprintf(fp, "            memcpy(buffer + shared, payload, (shared + suffix + 1 < size) ? suffix : size - 1 - shared);\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "        payload += suffix;\n");
+                fprintf(fp, "        length = shared + suffix;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    if (size > 0) {\n");
+                fprintf(fp, "        buffer[(length < size) ? length : size - 1] = '\\0';\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return length;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline int64_t %s_front_coded_vector_nfind (const struct %s_front_coded_vector *decoder, const char *key, uint64_t length)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t i;\n");
+                fprintf(fp, "    uint64_t j;\n");
+                fprintf(fp, "    uint64_t l;\n");
+                fprintf(fp, "    uint64_t r;\n");
+                fprintf(fp, "    uint64_t m;\n");
+                fprintf(fp, "    uint64_t end;\n");
+                fprintf(fp, "    uint64_t count;\n");
+                fprintf(fp, "    uint64_t shared;\n");
+                fprintf(fp, "    uint64_t suffix;\n");
+                fprintf(fp, "    uint64_t matched;\n");
+                fprintf(fp, "    const uint8_t *payload;\n");
+                fprintf(fp, "    count = %s_front_coded_vector_get_count(decoder);\n", schema->namespace);
+                fprintf(fp, "    l = 0;\n");
+                fprintf(fp, "    r = (count + %s_FRONT_CODED_VECTOR_RESTART_INTERVAL - 1) / %s_FRONT_CODED_VECTOR_RESTART_INTERVAL;\n", schema->NAMESPACE, schema->NAMESPACE);
+                fprintf(fp, "    while (l < r) {\n");
+                fprintf(fp, "        m = l + ((r - l) / 2);\n");
+                fprintf(fp, "        payload = %s_front_coded_vector_get_restart(decoder, m);\n", schema->namespace);
+                fprintf(fp, "        %s_front_coded_vector_varint(&payload);\n", schema->namespace);
+                fprintf(fp, "        suffix = %s_front_coded_vector_varint(&payload);\n", schema->namespace);
+                fprintf(fp, "        rc = memcmp(payload, key, (suffix < length) ? suffix : length);\n");
+                fprintf(fp, "        if (rc < 0 || (rc == 0 && suffix <= length)) {\n");
+                fprintf(fp, "            l = m + 1;\n");
+                fprintf(fp, "        } else {\n");
+                fprintf(fp, "            r = m;\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    if (l == 0) {\n");
+                fprintf(fp, "        return -1;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    matched = 0;\n");
+                fprintf(fp, "    payload = %s_front_coded_vector_get_restart(decoder, l - 1);\n", schema->namespace);
+                fprintf(fp, "    end = l * %s_FRONT_CODED_VECTOR_RESTART_INTERVAL;\n", schema->NAMESPACE);
+                fprintf(fp, "    for (i = (l - 1) * %s_FRONT_CODED_VECTOR_RESTART_INTERVAL; i < end && i < count; i++) {\n", schema->NAMESPACE);
+                fprintf(fp, "        shared = %s_front_coded_vector_varint(&payload);\n", schema->namespace);
+                fprintf(fp, "        suffix = %s_front_coded_vector_varint(&payload);\n", schema->namespace);
+                fprintf(fp, "        if (shared < matched) {\n");
+                fprintf(fp, "            return -1;\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "        if (shared == matched) {\n");
+                fprintf(fp, "            for (j = 0; j < suffix && matched + j < length && payload[j] == (uint8_t) key[matched + j]; j++) {\n");
+                fprintf(fp, "            }\n");
+                fprintf(fp, "            if (j == suffix && matched + j == length) {\n");
+                fprintf(fp, "                return i;\n");
+                fprintf(fp, "            }\n");
+                fprintf(fp, "            if (j < suffix && (matched + j == length || payload[j] > (uint8_t) key[matched + j])) {\n");
+                fprintf(fp, "                return -1;\n");
+                fprintf(fp, "            }\n");
+                fprintf(fp, "            matched += j;\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "        payload += suffix;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return -1;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline int64_t %s_front_coded_vector_find (const struct %s_front_coded_vector *decoder, const char *key)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return %s_front_coded_vector_nfind(decoder, key, strlen(key));\n", schema->namespace);
+                fprintf(fp, "}\n");
+
+                fprintf(fp, "\n");
+                fprintf(fp, "#endif\n");
+        }
+
+        if (schema_has_encoding(schema, schema_table_field_dictionary)) {
+                uint64_t header;
+                header = schema_align_offset(schema, schema_count_type_size(schema->count_type), schema_offset_type_size(schema->offset_type));
+
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_DICTIONARY_VECTOR_DECODER_API)\n", schema->NAMESPACE);
+                fprintf(fp, "#define %s_DICTIONARY_VECTOR_DECODER_API\n", schema->NAMESPACE);
+
+                fprintf(fp, "\n");
+                fprintf(fp, "struct %s_dictionary_vector;\n", schema->namespace);
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_dictionary_vector_get_count (const struct %s_dictionary_vector *decoder)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    %s_t count;\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return *(%s_t *) memcpy(&count, ((const uint8_t *) decoder), sizeof(count));\n", schema_count_type_name(schema->count_type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline const struct %s_string_vector * %s_dictionary_vector_get_dictionary (const struct %s_dictionary_vector *decoder)\n", schema->namespace, schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(schema->offset_type));
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    memcpy(&offset, ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 "), sizeof(offset));\n", header);
+                fprintf(fp, "    return (const struct %s_string_vector *) (((const uint8_t *) decoder) + offset);\n", schema->namespace);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_dictionary_vector_get_index_size (const struct %s_dictionary_vector *decoder)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return 0;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return ((const uint8_t *) decoder)[UINT64_C(%" PRIu64 ")];\n", header + schema_offset_type_size(schema->offset_type));
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline const void * %s_dictionary_vector_get_indices (const struct %s_dictionary_vector *decoder)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    if (decoder == NULL) {\n");
+                fprintf(fp, "        return NULL;\n");
+                fprintf(fp, "    }\n");
+                if (schema->align != 0) {
+                        fprintf(fp, "    return ((const uint8_t *) decoder) + ((UINT64_C(%" PRIu64 ") + %s_dictionary_vector_get_index_size(decoder) - 1) & ~(%s_dictionary_vector_get_index_size(decoder) - 1));\n", header + schema_offset_type_size(schema->offset_type) + sizeof(uint8_t), schema->namespace, schema->namespace);
+                } else {
+                        fprintf(fp, "    return ((const uint8_t *) decoder) + UINT64_C(%" PRIu64 ");\n", header + schema_offset_type_size(schema->offset_type) + sizeof(uint8_t));
+                }
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_dictionary_vector_get_index_at (const struct %s_dictionary_vector *decoder, uint64_t at)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint16_t index16;\n");
+                fprintf(fp, "    uint32_t index32;\n");
+                fprintf(fp, "    const uint8_t *indices;\n");
+                fprintf(fp, "    indices = (const uint8_t *) %s_dictionary_vector_get_indices(decoder);\n", schema->namespace);
+                fprintf(fp, "    switch (%s_dictionary_vector_get_index_size(decoder)) {\n", schema->namespace);
+                fprintf(fp, "        case sizeof(uint8_t):\n");
+                fprintf(fp, "            return indices[at];\n");
+                fprintf(fp, "        case sizeof(uint16_t):\n");
+                fprintf(fp, "            return *(uint16_t *) memcpy(&index16, indices + (at * sizeof(index16)), sizeof(index16));\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return *(uint32_t *) memcpy(&index32, indices + (at * sizeof(index32)), sizeof(index32));\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline const char * %s_dictionary_vector_get_at (const struct %s_dictionary_vector *decoder, uint64_t at)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return %s_string_vector_get_at(%s_dictionary_vector_get_dictionary(decoder), %s_dictionary_vector_get_index_at(decoder, at));\n", schema->namespace, schema->namespace, schema->namespace);
+                fprintf(fp, "}\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_dictionary_vector_get_length_at (const struct %s_dictionary_vector *decoder, uint64_t at)\n", schema->namespace, schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    return %s_string_length((const struct %s_string *) %s_dictionary_vector_get_at(decoder, at));\n", schema->namespace, schema->namespace, schema->namespace);
+                fprintf(fp, "}\n");
+
+                fprintf(fp, "\n");
+                fprintf(fp, "#endif\n");
+        }
+
+        if (schema_has_promoted(schema)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_PROMOTED_DECODER_API)\n", schema->NAMESPACE);
+                fprintf(fp, "#define %s_PROMOTED_DECODER_API\n", schema->NAMESPACE);
+
+                fprintf(fp, "\n");
+                fprintf(fp, "__attribute__((unused)) static inline uint64_t %s_promoted_load (const uint8_t *buffer, uint64_t width)\n", schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    uint16_t value16;\n");
+                fprintf(fp, "    uint32_t value32;\n");
+                fprintf(fp, "    uint64_t value64;\n");
+                fprintf(fp, "    switch (width) {\n");
+                fprintf(fp, "        case sizeof(uint8_t):\n");
+                fprintf(fp, "            return buffer[0];\n");
+                fprintf(fp, "        case sizeof(uint16_t):\n");
+                fprintf(fp, "            return *(uint16_t *) memcpy(&value16, buffer, sizeof(value16));\n");
+                fprintf(fp, "        case sizeof(uint32_t):\n");
+                fprintf(fp, "            return *(uint32_t *) memcpy(&value32, buffer, sizeof(value32));\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return *(uint64_t *) memcpy(&value64, buffer, sizeof(value64));\n");
+                fprintf(fp, "}\n");
+
+                fprintf(fp, "\n");
+                fprintf(fp, "#endif\n");
+        }
+
         TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type == schema_container_type_struct) {
+                        continue;
+                }
                 rc = schema_generate_decoder_table(schema, table, decoder_use_memcpy, fp);
                 if (rc != 0) {
                         linearbuffers_errorf("can not generate decoder for table: %s", table->name);
@@ -1762,7 +3450,15 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                 if (table_field->container == schema_container_type_vector) {
                         fprintf(fp, "%s    uint64_t at_%" PRIu64 ";\n", prefix, element->nentries);
                         fprintf(fp, "%s    uint64_t count;\n", prefix);
-                        if (schema_type_is_scalar(table_field->type)) {
+                        if (schema_table_field_packed(table_field)) {
+                                fprintf(fp, "%s    %s_t values[%s_PACKED_VECTOR_BLOCK_SIZE];\n", prefix, table_field->type, schema->NAMESPACE);
+                                fprintf(fp, "%s    const struct %s_packed_vector *%s_%s;\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name);
+                        } else if (schema_table_field_front_coded(table_field)) {
+                                fprintf(fp, "%s    const struct %s_front_coded_vector *%s_%s;\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name);
+                        } else if (schema_table_field_dictionary(table_field)) {
+                                fprintf(fp, "%s    const struct %s_dictionary_vector *%s_%s;\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name);
+                        } else if (schema_type_is_scalar(table_field->type) ||
+                                   schema_type_is_bool(table_field->type)) {
                                 fprintf(fp, "%s    const struct %s_%s_vector *%s_%s;\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name);
                         } else if (schema_type_is_float(table_field->type)) {
                                 fprintf(fp, "%s    const struct %s_%s_vector *%s_%s;\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name);
@@ -1770,11 +3466,20 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "%s    const struct %s_%s_vector *%s_%s;\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name);
                         } else if (schema_type_is_string(table_field->type)) {
                                 fprintf(fp, "%s    const struct %s_%s_vector *%s_%s;\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name);
-                        } else if (schema_type_is_table(schema, table_field->type)) {
+                        } else if (schema_type_is_table(schema, table_field->type) ||
+                                   schema_type_is_struct(schema, table_field->type)) {
                                 fprintf(fp, "%s    const struct %s_%s_vector *%s_%s;\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name);
                         }
                         fprintf(fp, "%s    %s_%s = %s_%s_%s_get(%s);\n", prefix, namespace_linearized(namespace), table_field->name, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
-                        fprintf(fp, "%s    count = %s_%s_vector_get_count(%s_%s);\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name);
+                        if (schema_table_field_packed(table_field)) {
+                                fprintf(fp, "%s    count = %s_packed_vector_get_count(%s_%s);\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name);
+                        } else if (schema_table_field_front_coded(table_field)) {
+                                fprintf(fp, "%s    count = %s_front_coded_vector_get_count(%s_%s);\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name);
+                        } else if (schema_table_field_dictionary(table_field)) {
+                                fprintf(fp, "%s    count = %s_dictionary_vector_get_count(%s_%s);\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name);
+                        } else {
+                                fprintf(fp, "%s    count = %s_%s_vector_get_count(%s_%s);\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name);
+                        }
                         fprintf(fp, "%s    if (flags & LINEARBUFFERS_JSONIFY_FLAG_PRETTY_SPACE) {\n", prefix);
                         fprintf(fp, "%s        rc = emitter(context, \"%s\");\n", prefix, prefix);
                         fprintf(fp, "%s        if (rc < 0) {\n", prefix);
@@ -1803,7 +3508,14 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
 
                         if (schema_type_is_scalar(table_field->type)) {
                                 fprintf(fp, "%s        %s_t value;\n", prefix, table_field->type);
-                                fprintf(fp, "%s        value = %s_%s_vector_get_at(%s_%s, at_%" PRIu64 ");\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name, element->nentries);
+                                if (schema_table_field_packed(table_field)) {
+                                        fprintf(fp, "%s        if ((at_%" PRIu64 " %% %s_PACKED_VECTOR_BLOCK_SIZE) == 0) {\n", prefix, element->nentries, schema->NAMESPACE);
+                                        fprintf(fp, "%s            %s_%s_%s_get_block(%s, at_%" PRIu64 " / %s_PACKED_VECTOR_BLOCK_SIZE, values);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace), element->nentries, schema->NAMESPACE);
+                                        fprintf(fp, "%s        }\n", prefix);
+                                        fprintf(fp, "%s        value = values[at_%" PRIu64 " %% %s_PACKED_VECTOR_BLOCK_SIZE];\n", prefix, element->nentries, schema->NAMESPACE);
+                                } else {
+                                        fprintf(fp, "%s        value = %s_%s_vector_get_at(%s_%s, at_%" PRIu64 ");\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name, element->nentries);
+                                }
                                 if (strncmp(table_field->type, "int", 3) == 0) {
                                         fprintf(fp, "%s        rc = emitter(context, \"%%\" PRIi64 \"%%s\", (int64_t) value, ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, element->nentries);
                                 } else {
@@ -1819,14 +3531,22 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "%s            }\n", prefix);
                                 fprintf(fp, "%s        }\n", prefix);
                                 fprintf(fp, "%s    }\n", prefix);
+                        } else if (schema_type_is_bool(table_field->type)) {
+                                fprintf(fp, "%s        rc = emitter(context, \"%%s%%s\", %s_%s_vector_get_at(%s_%s, at_%" PRIu64 ") ? \"true\" : \"false\", ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name, element->nentries, element->nentries);
+                                fprintf(fp, "%s        if (rc < 0) {\n", prefix);
+                                fprintf(fp, "%s            goto bail;\n", prefix);
+                                fprintf(fp, "%s        }\n", prefix);
+                                fprintf(fp, "%s        if (flags & LINEARBUFFERS_JSONIFY_FLAG_PRETTY_LINE) {\n", prefix);
+                                fprintf(fp, "%s            rc = emitter(context, \"\\n\");\n", prefix);
+                                fprintf(fp, "%s            if (rc < 0) {\n", prefix);
+                                fprintf(fp, "%s                goto bail;\n", prefix);
+                                fprintf(fp, "%s            }\n", prefix);
+                                fprintf(fp, "%s        }\n", prefix);
+                                fprintf(fp, "%s    }\n", prefix);
                         } else if (schema_type_is_float(table_field->type)) {
-                                fprintf(fp, "%s        %s value;\n", prefix, table_field->type);
+                                fprintf(fp, "%s        %s value;\n", prefix, schema_float_value_type(table_field->type));
                                 fprintf(fp, "%s        value = %s_%s_vector_get_at(%s_%s, at_%" PRIu64 ");\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name, element->nentries);
-                                if (strncmp(table_field->type, "int", 3) == 0) {
-                                        fprintf(fp, "%s        rc = emitter(context, \"%%\" PRIi64 \"%%s\", (int64_t) value, ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, element->nentries);
-                                } else {
-                                        fprintf(fp, "%s        rc = emitter(context, \"%%\" PRIu64 \"%%s\", (uint64_t) value, ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, element->nentries);
-                                }
+                                fprintf(fp, "%s        rc = emitter(context, \"%%f%%s\", value, ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, element->nentries);
                                 fprintf(fp, "%s        if (rc < 0) {\n", prefix);
                                 fprintf(fp, "%s            goto bail;\n", prefix);
                                 fprintf(fp, "%s        }\n", prefix);
@@ -1856,9 +3576,42 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "%s        }\n", prefix);
                                 fprintf(fp, "%s    }\n", prefix);
                         } else if (schema_type_is_string(table_field->type)) {
-                                fprintf(fp, "%s        const char *value;\n", prefix);
-                                fprintf(fp, "%s        value = %s_%s_vector_get_at(%s_%s, at_%" PRIu64 ");\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name, element->nentries);
-                                fprintf(fp, "%s        rc = emitter(context, \"\\\"%%s\\\"%%s\", value, ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, element->nentries);
+                                if (schema_table_field_front_coded(table_field)) {
+                                        fprintf(fp, "%s        char *value;\n", prefix);
+                                        fprintf(fp, "%s        uint64_t length;\n", prefix);
+                                        fprintf(fp, "%s        length = %s_front_coded_vector_get_at(%s_%s, at_%" PRIu64 ", NULL, 0);\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name, element->nentries);
+                                        fprintf(fp, "%s        value = malloc(length + 1);\n", prefix);
+                                        fprintf(fp, "%s        if (value == NULL) {\n", prefix);
+                                        fprintf(fp, "%s            goto bail;\n", prefix);
+                                        fprintf(fp, "%s        }\n", prefix);
+                                        fprintf(fp, "%s        %s_front_coded_vector_get_at(%s_%s, at_%" PRIu64 ", value, length + 1);\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name, element->nentries);
+                                        fprintf(fp, "%s        rc = emitter(context, \"\\\"%%s\\\"%%s\", value, ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, element->nentries);
+                                        fprintf(fp, "%s        free(value);\n", prefix);
+                                } else {
+                                        fprintf(fp, "%s        const char *value;\n", prefix);
+                                        if (schema_table_field_dictionary(table_field)) {
+                                                fprintf(fp, "%s        value = %s_dictionary_vector_get_at(%s_%s, at_%" PRIu64 ");\n", prefix, schema->namespace, namespace_linearized(namespace), table_field->name, element->nentries);
+                                        } else {
+                                                fprintf(fp, "%s        value = %s_%s_vector_get_at(%s_%s, at_%" PRIu64 ");\n", prefix, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name, element->nentries);
+                                        }
+                                        fprintf(fp, "%s        rc = emitter(context, \"\\\"%%s\\\"%%s\", value, ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, element->nentries);
+                                }
+                                fprintf(fp, "%s        if (rc < 0) {\n", prefix);
+                                fprintf(fp, "%s            goto bail;\n", prefix);
+                                fprintf(fp, "%s        }\n", prefix);
+                                fprintf(fp, "%s        if (flags & LINEARBUFFERS_JSONIFY_FLAG_PRETTY_LINE) {\n", prefix);
+                                fprintf(fp, "%s            rc = emitter(context, \"\\n\");\n", prefix);
+                                fprintf(fp, "%s            if (rc < 0) {\n", prefix);
+                                fprintf(fp, "%s                goto bail;\n", prefix);
+                                fprintf(fp, "%s            }\n", prefix);
+                                fprintf(fp, "%s        }\n", prefix);
+                                fprintf(fp, "%s    }\n", prefix);
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "%s        rc = %s_jsonify_%s_emitter(%s_%s_vector_get_at(%s_%s, at_%" PRIu64 "), emitter, context);\n", prefix, schema->namespace, table_field->type, schema->namespace, table_field->type, namespace_linearized(namespace), table_field->name, element->nentries);
+                                fprintf(fp, "%s        if (rc < 0) {\n", prefix);
+                                fprintf(fp, "%s            goto bail;\n", prefix);
+                                fprintf(fp, "%s        }\n", prefix);
+                                fprintf(fp, "%s        rc = emitter(context, \"%%s\", ((at_%" PRIu64 " + 1) == count) ? \"\" : \",\");\n", prefix, element->nentries);
                                 fprintf(fp, "%s        if (rc < 0) {\n", prefix);
                                 fprintf(fp, "%s            goto bail;\n", prefix);
                                 fprintf(fp, "%s        }\n", prefix);
@@ -1925,13 +3678,19 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                 } else {
                         if (schema_type_is_scalar(table_field->type) ||
                             schema_type_is_float(table_field->type) ||
+                            schema_type_is_bool(table_field->type) ||
                             schema_type_is_string(table_field->type) ||
-                            schema_type_is_enum(schema, table_field->type)) {
+                            schema_type_is_bytes(table_field->type) ||
+                            schema_type_is_enum(schema, table_field->type) ||
+                            schema_type_is_struct(schema, table_field->type)) {
                                 if (schema_type_is_scalar(table_field->type)) {
                                         fprintf(fp, "%s    %s_t value;\n", prefix, table_field->type);
                                         fprintf(fp, "%s    value = %s_%s_%s_get(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
                                 } else if (schema_type_is_float(table_field->type)) {
-                                        fprintf(fp, "%s    %s value;\n", prefix, table_field->type);
+                                        fprintf(fp, "%s    %s value;\n", prefix, schema_float_value_type(table_field->type));
+                                        fprintf(fp, "%s    value = %s_%s_%s_get(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
+                                } else if (schema_type_is_bool(table_field->type)) {
+                                        fprintf(fp, "%s    int value;\n", prefix);
                                         fprintf(fp, "%s    value = %s_%s_%s_get(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
                                 } else if (schema_type_is_enum(schema, table_field->type)) {
                                         fprintf(fp, "%s    %s_%s_t value;\n", prefix, schema->namespace, table_field->type);
@@ -1939,6 +3698,12 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                                 } else if (schema_type_is_string(table_field->type)) {
                                         fprintf(fp, "%s    const char *value;\n", prefix);
                                         fprintf(fp, "%s    value = %s_%s_%s_get_value(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
+                                } else if (schema_type_is_bytes(table_field->type)) {
+                                        fprintf(fp, "%s    const struct %s_bytes *value;\n", prefix, schema->namespace);
+                                        fprintf(fp, "%s    value = %s_%s_%s_get(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
+                                } else if (schema_type_is_struct(schema, table_field->type)) {
+                                        fprintf(fp, "%s    const struct %s_%s *value;\n", prefix, schema->namespace, table_field->type);
+                                        fprintf(fp, "%s    value = %s_%s_%s_get(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
                                 }
                                 fprintf(fp, "%s    if (flags & LINEARBUFFERS_JSONIFY_FLAG_PRETTY_SPACE) {\n", prefix);
                                 fprintf(fp, "%s        rc = emitter(context, \"%s\");\n", prefix, prefix);
@@ -1954,6 +3719,8 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                                         }
                                 } else if (schema_type_is_float(table_field->type)) {
                                         fprintf(fp, "%s    rc = emitter(context, \"\\\"%s\\\":%%f\", value);\n", prefix, table_field->name);
+                                } else if (schema_type_is_bool(table_field->type)) {
+                                        fprintf(fp, "%s    rc = emitter(context, \"\\\"%s\\\":%%s\", (value) ? \"true\" : \"false\");\n", prefix, table_field->name);
                                 } else if (schema_type_is_enum(schema, table_field->type)) {
                                         if (strncmp(schema_type_get_enum(schema, table_field->type)->type, "int", 3) == 0) {
                                                 fprintf(fp, "%s    rc = emitter(context, \"\\\"%s\\\":%%\" PRIi64 \"\", (int64_t) value);\n", prefix, table_field->name);
@@ -1963,6 +3730,12 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                                 } else if (schema_type_is_string(table_field->type)) {
                                         fprintf(fp, "%s    rc  = emitter(context, \"\\\"%s\\\":\");\n", prefix, table_field->name);
                                         fprintf(fp, "%s    rc |= %s_jsonify_string_emitter(value, emitter, context);\n", prefix, schema->namespace);
+                                } else if (schema_type_is_bytes(table_field->type)) {
+                                        fprintf(fp, "%s    rc  = emitter(context, \"\\\"%s\\\":\");\n", prefix, table_field->name);
+                                        fprintf(fp, "%s    rc |= %s_jsonify_bytes_emitter(%s_bytes_value(value), %s_bytes_length(value), emitter, context);\n", prefix, schema->namespace, schema->namespace, schema->namespace);
+                                } else if (schema_type_is_struct(schema, table_field->type)) {
+                                        fprintf(fp, "%s    rc  = emitter(context, \"\\\"%s\\\":\");\n", prefix, table_field->name);
+                                        fprintf(fp, "%s    rc |= %s_jsonify_%s_emitter(value, emitter, context);\n", prefix, schema->namespace, table_field->type);
                                 }
                                 fprintf(fp, "%s    if (rc < 0) {\n", prefix);
                                 fprintf(fp, "%s        goto bail;\n", prefix);
@@ -2125,10 +3898,12 @@ int schema_generate_c_jsonify (struct schema *schema, FILE *fp, int decoder_use_
 {
         int rc;
 
+        const char *comma;
         struct element *element;
         struct namespace *namespace;
 
         struct schema_table *table;
+        struct schema_table_field *table_field;
 
         element = NULL;
         namespace = NULL;
@@ -2233,7 +4008,92 @@ int schema_generate_c_jsonify (struct schema *schema, FILE *fp, int decoder_use_
         fprintf(fp, "}\n");
         fprintf(fp, "#endif\n");
 
+        if (schema_has_bytes(schema)) {
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_JSONIFY_BYTES_EMITTER)\n", schema->NAMESPACE);
+                fprintf(fp, "#define %s_JSONIFY_BYTES_EMITTER\n", schema->NAMESPACE);
+                fprintf(fp, "static inline int %s_jsonify_bytes_emitter (const void *bytes, uint64_t length, int (*emitter) (void *context, const char *format, ...), void *context)\n", schema->namespace);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    uint64_t i;\n");
+                fprintf(fp, "    rc = emitter(context, \"\\\"\");\n");
+                fprintf(fp, "    if (rc < 0) {\n");
+                fprintf(fp, "        return rc;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    for (i = 0; i < length; i++) {\n");
+                fprintf(fp, "        rc = emitter(context, \"%%02x\", ((const uint8_t *) bytes)[i]);\n");
+                fprintf(fp, "        if (rc < 0) {\n");
+                fprintf(fp, "           return rc;\n");
+                fprintf(fp, "        }\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    rc = emitter(context, \"\\\"\");\n");
+                fprintf(fp, "    if (rc < 0) {\n");
+                fprintf(fp, "       return rc;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return 0;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "#endif\n");
+        }
+
         TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type != schema_container_type_struct) {
+                        continue;
+                }
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_JSONIFY_%s_EMITTER)\n", schema->NAMESPACE, table->name);
+                fprintf(fp, "#define %s_JSONIFY_%s_EMITTER\n", schema->NAMESPACE, table->name);
+                fprintf(fp, "static inline int %s_jsonify_%s_emitter (const struct %s_%s *value, int (*emitter) (void *context, const char *format, ...), void *context)\n", schema->namespace, table->name, schema->namespace, table->name);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    if (value == NULL) {\n");
+                fprintf(fp, "        return emitter(context, \"null\");\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    rc = emitter(context, \"{\");\n");
+                fprintf(fp, "    if (rc < 0) {\n");
+                fprintf(fp, "        return rc;\n");
+                fprintf(fp, "    }\n");
+                TAILQ_FOREACH(table_field, &table->fields, list) {
+                        comma = (table_field == TAILQ_FIRST(&table->fields)) ? "" : ",";
+                        if (schema_type_is_scalar(table_field->type)) {
+                                if (strncmp(table_field->type, "int", 3) == 0) {
+                                        fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%\" PRIi64 \"\", (int64_t) value->%s);\n", comma, table_field->name, table_field->name);
+                                } else {
+                                        fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%\" PRIu64 \"\", (uint64_t) value->%s);\n", comma, table_field->name, table_field->name);
+                                }
+                        } else if (schema_type_is_half(table_field->type)) {
+                                fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%f\", %s_%s_to_float(value->%s));\n", comma, table_field->name, schema->namespace, table_field->type, table_field->name);
+                        } else if (schema_type_is_float(table_field->type)) {
+                                fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%f\", value->%s);\n", comma, table_field->name, table_field->name);
+                        } else if (schema_type_is_enum(schema, table_field->type)) {
+                                if (strncmp(schema_type_get_enum(schema, table_field->type)->type, "int", 3) == 0) {
+                                        fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%\" PRIi64 \"\", (int64_t) value->%s);\n", comma, table_field->name, table_field->name);
+                                } else {
+                                        fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%\" PRIu64 \"\", (uint64_t) value->%s);\n", comma, table_field->name, table_field->name);
+                                }
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":\");\n", comma, table_field->name);
+                                fprintf(fp, "    if (rc < 0) {\n");
+                                fprintf(fp, "        return rc;\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "    rc = %s_jsonify_%s_emitter(&value->%s, emitter, context);\n", schema->namespace, table_field->type, table_field->name);
+                        }
+                        fprintf(fp, "    if (rc < 0) {\n");
+                        fprintf(fp, "        return rc;\n");
+                        fprintf(fp, "    }\n");
+                }
+                fprintf(fp, "    rc = emitter(context, \"}\");\n");
+                fprintf(fp, "    if (rc < 0) {\n");
+                fprintf(fp, "       return rc;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return 0;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "#endif\n");
+        }
+
+        TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type == schema_container_type_struct) {
+                        continue;
+                }
                 fprintf(fp, "\n");
                 fprintf(fp, "#if !defined(%s_%s_JSONIFY_API)\n", schema->NAMESPACE, table->name);
                 fprintf(fp, "#define %s_%s_JSONIFY_API\n", schema->NAMESPACE, table->name);
@@ -22,6 +22,83 @@ static int schema_table_has_vector (struct schema_table *schema_table, const cha
         return 0;
 }
 
+static int schema_table_has_bytes (struct schema_table *schema_table)
+{
+        struct schema_table_field *schema_table_field;
+        TAILQ_FOREACH(schema_table_field, &schema_table->fields, list) {
+                if (strcmp(schema_table_field->type, "bytes") == 0) {
+                        return 1;
+                }
+        }
+        return 0;
+}
+
+static int schema_has_bytes (struct schema *schema)
+{
+        int rc;
+        struct schema_table *schema_table;
+        TAILQ_FOREACH(schema_table, &schema->tables, list) {
+                rc = schema_table_has_bytes(schema_table);
+                if (rc != 0) {
+                        return rc;
+                }
+        }
+        return 0;
+}
+
+static int schema_has_sparse (struct schema *schema)
+{
+        struct schema_table *schema_table;
+        TAILQ_FOREACH(schema_table, &schema->tables, list) {
+                if (schema_table_sparse(schema_table)) {
+                        return 1;
+                }
+        }
+        return 0;
+}
+
+static int schema_has_encoding (struct schema *schema)
+{
+        struct schema_table *schema_table;
+        struct schema_table_field *schema_table_field;
+        TAILQ_FOREACH(schema_table, &schema->tables, list) {
+                TAILQ_FOREACH(schema_table_field, &schema_table->fields, list) {
+                        if (schema_table_field_encoding(schema_table_field) != schema_encoding_type_none) {
+                                return 1;
+                        }
+                }
+        }
+        return 0;
+}
+
+static int schema_has_bool (struct schema *schema)
+{
+        struct schema_table *schema_table;
+        struct schema_table_field *schema_table_field;
+        TAILQ_FOREACH(schema_table, &schema->tables, list) {
+                TAILQ_FOREACH(schema_table_field, &schema_table->fields, list) {
+                        if (schema_type_is_bool(schema_table_field->type)) {
+                                return 1;
+                        }
+                }
+        }
+        return 0;
+}
+
+static int schema_has_half (struct schema *schema)
+{
+        struct schema_table *schema_table;
+        struct schema_table_field *schema_table_field;
+        TAILQ_FOREACH(schema_table, &schema->tables, list) {
+                TAILQ_FOREACH(schema_table_field, &schema_table->fields, list) {
+                        if (schema_type_is_half(schema_table_field->type)) {
+                                return 1;
+                        }
+                }
+        }
+        return 0;
+}
+
 static int schema_has_vector (struct schema *schema, const char *type)
 {
         int rc;
@@ -59,6 +136,25 @@ static int schema_has_string (struct schema *schema)
         return 0;
 }
 
+static const char * schema_struct_field_view (struct schema *schema, const char *type)
+{
+        if (schema_type_is_enum(schema, type)) {
+                type = schema_type_get_enum(schema, type)->type;
+        }
+        if (strcmp(type, "int8") == 0) {                return "Int8";
+        } else if (strcmp(type, "int16") == 0) {        return "Int16";
+        } else if (strcmp(type, "int32") == 0) {        return "Int32";
+        } else if (strcmp(type, "int64") == 0) {        return "BigInt64";
+        } else if (strcmp(type, "uint8") == 0) {        return "Uint8";
+        } else if (strcmp(type, "uint16") == 0) {       return "Uint16";
+        } else if (strcmp(type, "uint32") == 0) {       return "Uint32";
+        } else if (strcmp(type, "uint64") == 0) {       return "BigUint64";
+        } else if (strcmp(type, "float") == 0) {        return "Float32";
+        } else if (strcmp(type, "double") == 0) {       return "Float64";
+        }
+        return NULL;
+}
+
 static int schema_generate_enum_exports (struct schema *schema, struct schema_enum *anum, FILE *fp)
 {
         struct schema_enum_field *anum_field;
@@ -523,6 +619,13 @@ static int schema_generate_encoder_table_exports (struct schema *schema, struct
                                 fprintf(fp, "    %s_%s_%s_end : %s_%s_%s_end,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
                                 fprintf(fp, "    %s_%s_%s_cancel : %s_%s_%s_cancel,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
                                 fprintf(fp, "    %s_%s_%s_push : %s_%s_%s_push,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "    %s_%s_%s_set : %s_%s_%s_set,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "    %s_%s_%s_create : %s_%s_%s_create,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "    %s_%s_%s_start : %s_%s_%s_start,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "    %s_%s_%s_end : %s_%s_%s_end,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "    %s_%s_%s_cancel : %s_%s_%s_cancel,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "    %s_%s_%s_push : %s_%s_%s_push,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
                         } else {
                                 linearbuffers_errorf("type is invalid: %s", table_field->type);
                                 goto bail;
@@ -539,6 +642,8 @@ static int schema_generate_encoder_table_exports (struct schema *schema, struct
                                 fprintf(fp, "    %s_%s_%s_set : %s_%s_%s_set,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
                         } else if (schema_type_is_table(schema, table_field->type)) {
                                 fprintf(fp, "    %s_%s_%s_set : %s_%s_%s_set.\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "    %s_%s_%s_set : %s_%s_%s_set,\n", schema->namespace, table->name, table_field->name, schema->namespace, table->name, table_field->name);
                         } else {
                                 linearbuffers_errorf("type is invalid: %s", table_field->type);
                                 goto bail;
@@ -554,8 +659,59 @@ static int schema_generate_encoder_table_exports (struct schema *schema, struct
 bail:   return -1;
 }
 
+static int schema_generate_encoder_struct (struct schema *schema, struct schema_table *table, FILE *fp)
+{
+        const char *view;
+        uint64_t table_field_s;
+        struct schema_table_field *table_field;
+
+        if (schema == NULL) {
+                linearbuffers_errorf("schema is invalid");
+                goto bail;
+        }
+        if (table == NULL) {
+                linearbuffers_errorf("table is invalid");
+                goto bail;
+        }
+        if (fp == NULL) {
+                linearbuffers_errorf("fp is invalid");
+                goto bail;
+        }
+
+        fprintf(fp, "\n");
+        fprintf(fp, "function %s_%s_encode (value, view, offset)\n", schema->namespace, table->name);
+        fprintf(fp, "{\n");
+
+        table_field_s = 0;
+        TAILQ_FOREACH(table_field, &table->fields, list) {
+                table_field_s = schema_align_offset(schema, table_field_s, schema_table_field_alignment(schema, schema->offset_type, table_field));
+                if (schema_type_is_struct(schema, table_field->type)) {
+                        fprintf(fp, "    %s_%s_encode(value.%s, view, offset + %" PRIu64 ");\n", schema->namespace, table_field->type, table_field->name, table_field_s);
+                } else {
+                        view = schema_struct_field_view(schema, table_field->type);
+                        if (view == NULL) {
+                                linearbuffers_errorf("type is invalid: %s", table_field->type);
+                                goto bail;
+                        }
+                        if (strncmp(view, "Big", 3) == 0) {
+                                fprintf(fp, "    view.set%s(offset + %" PRIu64 ", BigInt(value.%s), true);\n", view, table_field_s, table_field->name);
+                        } else {
+                                fprintf(fp, "    view.set%s(offset + %" PRIu64 ", value.%s, true);\n", view, table_field_s, table_field->name);
+                        }
+                }
+                table_field_s += schema_table_field_size(schema, schema->offset_type, table_field);
+        }
+
+        fprintf(fp, "}\n");
+
+        return 0;
+bail:   return -1;
+}
+
 static int schema_generate_encoder_table (struct schema *schema, struct schema_table *table, FILE *fp)
 {
+        uint32_t count_type;
+        uint32_t offset_type;
         uint64_t table_field_i;
         uint64_t table_field_s;
         struct schema_table_field *table_field;
@@ -573,20 +729,25 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                 goto bail;
         }
 
+        count_type = schema_table_count_type(schema, table);
+        offset_type = schema_table_offset_type(schema, table);
+
         table_field_s = 0;
         TAILQ_FOREACH(table_field, &table->fields, list) {
                 if (table_field->container == schema_container_type_vector) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_scalar(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_float(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_string(table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_enum(schema, table_field->type)) {
                         table_field_s += schema_inttype_size(schema_type_get_enum(schema, table_field->type)->type);
                 } else if (schema_type_is_table(schema, table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_struct(schema, table_field->type)) {
+                        table_field_s += schema_struct_size(schema, schema_type_get_table(schema, table_field->type));
                 } else {
                         linearbuffers_errorf("type is invalid: %s", table_field->type);
                         goto bail;
@@ -597,7 +758,7 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
         fprintf(fp, "\n");
         fprintf(fp, "function %s_%s_start (encoder)\n", schema->namespace, table->name);
         fprintf(fp, "{\n");
-        fprintf(fp, "    return encoder.tableStart(encoder.LinearBufferEncoderCountType.%s, encoder.LinearBufferEncoderOffsetType.%s, %" PRIu64 ", %" PRIu64 ");\n", schema_count_type_name(schema->count_type), schema_offset_type_name(schema->offset_type), table->nfields, table_field_s);
+        fprintf(fp, "    return encoder.tableStart(encoder.LinearBufferEncoderCountType.%s, encoder.LinearBufferEncoderOffsetType.%s, %" PRIu64 ", %" PRIu64 ");\n", schema_count_type_name(count_type), schema_offset_type_name(offset_type), table->nfields, table_field_s);
         fprintf(fp, "}\n");
 
         table_field_i = 0;
@@ -652,6 +813,14 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "{\n");
                                 fprintf(fp, "    return encoder.tableSetTable(%" PRIu64 ", %" PRIu64 ", (uint64_t) (ptrdiff_t) value);\n", table_field_i, table_field_s);
                                 fprintf(fp, "}\n");
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "function %s_%s_%s_set (encoder, value)\n", schema->namespace, table->name, table_field->name);
+                                fprintf(fp, "{\n");
+                                fprintf(fp, "    var buffer;\n");
+                                fprintf(fp, "    buffer = new Uint8Array(%" PRIu64 ");\n", schema_struct_size(schema, schema_type_get_table(schema, table_field->type)));
+                                fprintf(fp, "    %s_%s_encode(value, new DataView(buffer.buffer), 0);\n", schema->namespace, table_field->type);
+                                fprintf(fp, "    return encoder.tableSetStruct(%" PRIu64 ", %" PRIu64 ", buffer);\n", table_field_i, table_field_s);
+                                fprintf(fp, "}\n");
                         } else {
                                 linearbuffers_errorf("type is invalid: %s", table_field->type);
                                 goto bail;
@@ -659,17 +828,19 @@ static int schema_generate_encoder_table (struct schema *schema, struct schema_t
                 }
                 table_field_i += 1;
                 if (table_field->container == schema_container_type_vector) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_scalar(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_float(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_string(table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_enum(schema, table_field->type)) {
                         table_field_s += schema_inttype_size(schema_type_get_enum(schema, table_field->type)->type);
                 } else if (schema_type_is_table(schema, table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_struct(schema, table_field->type)) {
+                        table_field_s += schema_struct_size(schema, schema_type_get_table(schema, table_field->type));
                 }
         }
 
@@ -717,6 +888,34 @@ int schema_generate_js_encoder (struct schema *schema, FILE *fp, int encoder_inc
                 linearbuffers_errorf("fp is invalid");
                 goto bail;
         }
+        if (schema->align != 0) {
+                linearbuffers_errorf("align is not supported");
+                goto bail;
+        }
+        if (schema->string_type != schema_string_type_terminated) {
+                linearbuffers_errorf("string_type is not supported");
+                goto bail;
+        }
+        if (schema_has_bytes(schema)) {
+                linearbuffers_errorf("bytes is not supported");
+                goto bail;
+        }
+        if (schema_has_sparse(schema)) {
+                linearbuffers_errorf("sparse is not supported");
+                goto bail;
+        }
+        if (schema_has_encoding(schema)) {
+                linearbuffers_errorf("encoding is not supported");
+                goto bail;
+        }
+        if (schema_has_bool(schema)) {
+                linearbuffers_errorf("bool is not supported");
+                goto bail;
+        }
+        if (schema_has_half(schema)) {
+                linearbuffers_errorf("float16 and bfloat16 are not supported");
+                goto bail;
+        }
 
         if (encoder_include_library == 0) {
         }
@@ -793,6 +992,14 @@ int schema_generate_js_encoder (struct schema *schema, FILE *fp, int encoder_inc
         }
 
         TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type == schema_container_type_struct) {
+                        rc = schema_generate_encoder_struct(schema, table, fp);
+                        if (rc != 0) {
+                                linearbuffers_errorf("can not generate encoder for struct: %s", table->name);
+                                goto bail;
+                        }
+                        continue;
+                }
                 rc = schema_generate_encoder_table(schema, table, fp);
                 if (rc != 0) {
                         linearbuffers_errorf("can not generate decoder for table: %s", table->name);
@@ -810,6 +1017,10 @@ int schema_generate_js_encoder (struct schema *schema, FILE *fp, int encoder_inc
                 }
         }
         TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type == schema_container_type_struct) {
+                        fprintf(fp, "    %s_%s_encode : %s_%s_encode,\n", schema->namespace, table->name, schema->namespace, table->name);
+                        continue;
+                }
                 rc = schema_generate_encoder_table_exports(schema, table, fp);
                 if (rc != 0) {
                         linearbuffers_errorf("can not generate decoder for table: %s", table->name);
@@ -868,8 +1079,58 @@ static int schema_generate_decoder_table_exports (struct schema *schema, struct
 bail:   return -1;
 }
 
+static int schema_generate_decoder_struct (struct schema *schema, struct schema_table *table, FILE *fp)
+{
+        const char *view;
+        uint64_t table_field_s;
+        struct schema_table_field *table_field;
+
+        if (schema == NULL) {
+                linearbuffers_errorf("schema is invalid");
+                goto bail;
+        }
+        if (table == NULL) {
+                linearbuffers_errorf("table is invalid");
+                goto bail;
+        }
+        if (fp == NULL) {
+                linearbuffers_errorf("fp is invalid");
+                goto bail;
+        }
+
+        fprintf(fp, "\n");
+        fprintf(fp, "function %s_%s_decode (view, offset)\n", schema->namespace, table->name);
+        fprintf(fp, "{\n");
+        fprintf(fp, "    var value;\n");
+        fprintf(fp, "    value = new Object();\n");
+
+        table_field_s = 0;
+        TAILQ_FOREACH(table_field, &table->fields, list) {
+                table_field_s = schema_align_offset(schema, table_field_s, schema_table_field_alignment(schema, schema->offset_type, table_field));
+                if (schema_type_is_struct(schema, table_field->type)) {
+                        fprintf(fp, "    value.%s = %s_%s_decode(view, offset + %" PRIu64 ");\n", table_field->name, schema->namespace, table_field->type, table_field_s);
+                } else {
+                        view = schema_struct_field_view(schema, table_field->type);
+                        if (view == NULL) {
+                                linearbuffers_errorf("type is invalid: %s", table_field->type);
+                                goto bail;
+                        }
+                        fprintf(fp, "    value.%s = view.get%s(offset + %" PRIu64 ", true);\n", table_field->name, view, table_field_s);
+                }
+                table_field_s += schema_table_field_size(schema, schema->offset_type, table_field);
+        }
+
+        fprintf(fp, "    return value;\n");
+        fprintf(fp, "}\n");
+
+        return 0;
+bail:   return -1;
+}
+
 static int schema_generate_decoder_table (struct schema *schema, struct schema_table *table, FILE *fp)
 {
+        uint32_t count_type;
+        uint32_t offset_type;
         uint64_t table_field_i;
         uint64_t table_field_s;
         struct schema_table_field *table_field;
@@ -887,6 +1148,9 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                 goto bail;
         }
 
+        count_type = schema_table_count_type(schema, table);
+        offset_type = schema_table_offset_type(schema, table);
+
         fprintf(fp, "\n");
 
         fprintf(fp, "function %s_%s_decode (buffer)\n", schema->namespace, table->name);
@@ -913,11 +1177,11 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                 fprintf(fp, "{\n");
                 fprintf(fp, "    var count;\n");
                 fprintf(fp, "    var present;\n");
-                fprintf(fp, "    count = new Uint%" PRIu64 "Array(decoder.buffer.slice(%" PRIu64 ", %" PRIu64 "))[0];\n", schema_count_type_size(schema->count_type) * 8, UINT64_C(0), schema_count_type_size(schema->count_type));
+                fprintf(fp, "    count = new Uint%" PRIu64 "Array(decoder.buffer.slice(%" PRIu64 ", %" PRIu64 "))[0];\n", schema_count_type_size(count_type) * 8, UINT64_C(0), schema_count_type_size(count_type));
                 fprintf(fp, "    if (%" PRIu64 " >= count) {\n", table_field_i);
                 fprintf(fp, "        return 0;\n");
                 fprintf(fp, "    }\n");
-                fprintf(fp, "    present = decoder[%" PRIu64 "];\n", schema_count_type_size(schema->count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                fprintf(fp, "    present = decoder[%" PRIu64 "];\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
                 fprintf(fp, "    if (!(present & 0x%02x)) {\n", (1 << (table_field_i % 8)));
                 fprintf(fp, "        return 0;\n");
                 fprintf(fp, "    }\n");
@@ -936,11 +1200,13 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "function %s_%s_%s_get (decoder)\n", schema->namespace, table->name, table_field->name);
                         } else if (schema_type_is_table(schema, table_field->type)) {
                                 fprintf(fp, "const struct %s_%s * %s_%s_%s_get (decoder)\n", schema->namespace, table_field->type, schema->namespace, table->name, table_field->name);
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "function %s_%s_%s_get (decoder)\n", schema->namespace, table->name, table_field->name);
                         }
                         fprintf(fp, "{\n");
                         fprintf(fp, "    var count;\n");
                         fprintf(fp, "    var present;\n");
-                        fprintf(fp, "    count = new Uint%" PRIu64 "Array(decoder.buffer.slice(%" PRIu64 ", %" PRIu64 "))[0];\n", schema_count_type_size(schema->count_type) * 8, UINT64_C(0), schema_count_type_size(schema->count_type));
+                        fprintf(fp, "    count = new Uint%" PRIu64 "Array(decoder.buffer.slice(%" PRIu64 ", %" PRIu64 "))[0];\n", schema_count_type_size(count_type) * 8, UINT64_C(0), schema_count_type_size(count_type));
                         fprintf(fp, "    if (%" PRIu64 " >= count) {\n", table_field_i);
                         if (schema_type_is_scalar(table_field->type) ||
                             schema_type_is_float(table_field->type)) {
@@ -961,7 +1227,7 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                                 fprintf(fp, "        return null;\n");
                         }
                         fprintf(fp, "    }\n");
-                        fprintf(fp, "    present = decoder[%" PRIu64 "];\n", schema_count_type_size(schema->count_type) + sizeof(uint8_t) * (table_field_i / 8));
+                        fprintf(fp, "    present = decoder[%" PRIu64 "];\n", schema_count_type_size(count_type) + sizeof(uint8_t) * (table_field_i / 8));
                         fprintf(fp, "    if (!(present & 0x%02x)) {\n", (1 << (table_field_i % 8)));
                         if (schema_type_is_scalar(table_field->type) ||
                             schema_type_is_float(table_field->type)) {
@@ -991,7 +1257,7 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                                         linearbuffers_errorf("type: %s is invalid", table_field->type);
                                         goto bail;
                                 }
-                                fprintf(fp, "    return new %s(decoder.buffer.slice(%" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ", %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 " + %" PRIu64 "))[0];\n", type, schema_count_type_size(schema->count_type), table_field_s, schema_count_type_size(schema->count_type), table_field_s, size);
+                                fprintf(fp, "    return new %s(decoder.buffer.slice(%" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ", %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 " + %" PRIu64 "))[0];\n", type, schema_count_type_size(count_type), table_field_s, schema_count_type_size(count_type), table_field_s, size);
                         } else if (schema_type_is_float(table_field->type)) {
                                 uint64_t size;
                                 const char *type;
@@ -1001,7 +1267,7 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                                         linearbuffers_errorf("type: %s is invalid", table_field->type);
                                         goto bail;
                                 }
-                                fprintf(fp, "    return new %s(decoder.buffer.slice(%" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ", %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 " + %" PRIu64 "))[0];\n", type, schema_count_type_size(schema->count_type), table_field_s, schema_count_type_size(schema->count_type), table_field_s, size);
+                                fprintf(fp, "    return new %s(decoder.buffer.slice(%" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ", %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 " + %" PRIu64 "))[0];\n", type, schema_count_type_size(count_type), table_field_s, schema_count_type_size(count_type), table_field_s, size);
                         } else if (schema_type_is_enum(schema, table_field->type)) {
                                 uint64_t size;
                                 const char *type;
@@ -1017,13 +1283,15 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                                         linearbuffers_errorf("type: %s is invalid", schema_type_get_enum(schema, table_field->type)->type);
                                         goto bail;
                                 }
-                                fprintf(fp, "    return new %s(decoder.buffer.slice(%" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ", %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 " + %" PRIu64 "))[0];\n", type, schema_count_type_size(schema->count_type), table_field_s, schema_count_type_size(schema->count_type), table_field_s, size);
+                                fprintf(fp, "    return new %s(decoder.buffer.slice(%" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ", %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 " + %" PRIu64 "))[0];\n", type, schema_count_type_size(count_type), table_field_s, schema_count_type_size(count_type), table_field_s, size);
                         } else if (schema_type_is_string(table_field->type)) {
-                                fprintf(fp, "    return new Uint%" PRIu64 "Array(decoder.buffer.slice(%" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ", %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 " + %" PRIu64 "))[0];\n", schema_offset_type_size(schema->count_type) * 8, schema_count_type_size(schema->count_type), table_field_s, schema_count_type_size(schema->count_type), table_field_s, schema_count_type_size(schema->offset_type));
+                                fprintf(fp, "    return new Uint%" PRIu64 "Array(decoder.buffer.slice(%" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ", %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 " + %" PRIu64 "))[0];\n", schema_offset_type_size(count_type) * 8, schema_count_type_size(count_type), table_field_s, schema_count_type_size(count_type), table_field_s, schema_count_type_size(offset_type));
                         } else if (schema_type_is_table(schema, table_field->type)) {
-                                fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(schema->offset_type));
-                                fprintf(fp, "    offset = *(%s_t *) (((const uint8_t *) decoder) + %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ");\n", schema_offset_type_name(schema->offset_type), schema_count_type_size(schema->count_type), table_field_s);
+                                fprintf(fp, "    %s_t offset;\n", schema_offset_type_name(offset_type));
+                                fprintf(fp, "    offset = *(%s_t *) (((const uint8_t *) decoder) + %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ");\n", schema_offset_type_name(offset_type), schema_count_type_size(count_type), table_field_s);
                                 fprintf(fp, "    return (const struct %s_%s *) (((const uint8_t *) decoder) + offset);\n", schema->namespace, table_field->type);
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "    return %s_%s_decode(new DataView(decoder.buffer, decoder.byteOffset), %" PRIu64 " + Math.floor((count + 7) / 8) + %" PRIu64 ");\n", schema->namespace, table_field->type, schema_count_type_size(count_type), table_field_s);
                         }
                         fprintf(fp, "}\n");
 
@@ -1041,17 +1309,19 @@ static int schema_generate_decoder_table (struct schema *schema, struct schema_t
                 }
                 table_field_i += 1;
                 if (table_field->container == schema_container_type_vector) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_scalar(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_float(table_field->type)) {
                         table_field_s += schema_inttype_size(table_field->type);
                 } else if (schema_type_is_string(table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
                 } else if (schema_type_is_enum(schema, table_field->type)) {
                         table_field_s += schema_inttype_size(schema_type_get_enum(schema, table_field->type)->type);
                 } else if (schema_type_is_table(schema, table_field->type)) {
-                        table_field_s += schema_offset_type_size(schema->offset_type);
+                        table_field_s += schema_offset_type_size(offset_type);
+                } else if (schema_type_is_struct(schema, table_field->type)) {
+                        table_field_s += schema_struct_size(schema, schema_type_get_table(schema, table_field->type));
                 }
         }
 
@@ -1076,6 +1346,34 @@ int schema_generate_js_decoder (struct schema *schema, FILE *fp, int decoder_use
                 linearbuffers_errorf("fp is invalid");
                 goto bail;
         }
+        if (schema->align != 0) {
+                linearbuffers_errorf("align is not supported");
+                goto bail;
+        }
+        if (schema->string_type != schema_string_type_terminated) {
+                linearbuffers_errorf("string_type is not supported");
+                goto bail;
+        }
+        if (schema_has_bytes(schema)) {
+                linearbuffers_errorf("bytes is not supported");
+                goto bail;
+        }
+        if (schema_has_sparse(schema)) {
+                linearbuffers_errorf("sparse is not supported");
+                goto bail;
+        }
+        if (schema_has_encoding(schema)) {
+                linearbuffers_errorf("encoding is not supported");
+                goto bail;
+        }
+        if (schema_has_bool(schema)) {
+                linearbuffers_errorf("bool is not supported");
+                goto bail;
+        }
+        if (schema_has_half(schema)) {
+                linearbuffers_errorf("float16 and bfloat16 are not supported");
+                goto bail;
+        }
 
         if (!TAILQ_EMPTY(&schema->enums)) {
                 TAILQ_FOREACH(anum, &schema->enums, list) {
@@ -1172,6 +1470,14 @@ int schema_generate_js_decoder (struct schema *schema, FILE *fp, int decoder_use
         }
 
         TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type == schema_container_type_struct) {
+                        rc = schema_generate_decoder_struct(schema, table, fp);
+                        if (rc != 0) {
+                                linearbuffers_errorf("can not generate decoder for struct: %s", table->name);
+                                goto bail;
+                        }
+                        continue;
+                }
                 rc = schema_generate_decoder_table(schema, table, fp);
                 if (rc != 0) {
                         linearbuffers_errorf("can not generate decoder for table: %s", table->name);
@@ -1189,6 +1495,10 @@ int schema_generate_js_decoder (struct schema *schema, FILE *fp, int decoder_use
                 }
         }
         TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type == schema_container_type_struct) {
+                        fprintf(fp, "    %s_%s_decode : %s_%s_decode,\n", schema->namespace, table->name, schema->namespace, table->name);
+                        continue;
+                }
                 rc = schema_generate_decoder_table_exports(schema, table, fp);
                 if (rc != 0) {
                         linearbuffers_errorf("can not generate decoder exports for table: %s", table->name);
@@ -1430,7 +1740,8 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                         if (schema_type_is_scalar(table_field->type) ||
                             schema_type_is_float(table_field->type) ||
                             schema_type_is_string(table_field->type) ||
-                            schema_type_is_enum(schema, table_field->type)) {
+                            schema_type_is_enum(schema, table_field->type) ||
+                            schema_type_is_struct(schema, table_field->type)) {
                                 if (schema_type_is_scalar(table_field->type)) {
                                         fprintf(fp, "%s    %s_t value;\n", prefix, table_field->type);
                                         fprintf(fp, "%s    value = %s_%s_%s_get(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
@@ -1443,6 +1754,9 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                                 } else if (schema_type_is_string(table_field->type)) {
                                         fprintf(fp, "%s    const char *value;\n", prefix);
                                         fprintf(fp, "%s    value = %s_%s_%s_get_value(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
+                                } else if (schema_type_is_struct(schema, table_field->type)) {
+                                        fprintf(fp, "%s    const struct %s_%s *value;\n", prefix, schema->namespace, table_field->type);
+                                        fprintf(fp, "%s    value = %s_%s_%s_get(%s);\n", prefix, schema->namespace, table->name, table_field->name, namespace_linearized(namespace));
                                 }
                                 fprintf(fp, "%s    if (flags & LINEARBUFFERS_JSONIFY_FLAG_PRETTY_SPACE) {\n", prefix);
                                 fprintf(fp, "%s        rc = emitter(context, \"%s\");\n", prefix, prefix);
@@ -1467,6 +1781,9 @@ static int schema_generate_jsonify_table (struct schema *schema, struct schema_t
                                 } else if (schema_type_is_string(table_field->type)) {
                                         fprintf(fp, "%s    rc  = emitter(context, \"\\\"%s\\\":\");\n", prefix, table_field->name);
                                         fprintf(fp, "%s    rc |= %s_jsonify_string_emitter(value, emitter, context);\n", prefix, schema->namespace);
+                                } else if (schema_type_is_struct(schema, table_field->type)) {
+                                        fprintf(fp, "%s    rc  = emitter(context, \"\\\"%s\\\":\");\n", prefix, table_field->name);
+                                        fprintf(fp, "%s    rc |= %s_jsonify_%s_emitter(value, emitter, context);\n", prefix, schema->namespace, table_field->type);
                                 }
                                 fprintf(fp, "%s    if (rc < 0) {\n", prefix);
                                 fprintf(fp, "%s        goto bail;\n", prefix);
@@ -1629,10 +1946,12 @@ int schema_generate_js_jsonify (struct schema *schema, FILE *fp, int decoder_use
 {
         int rc;
 
+        const char *comma;
         struct element *element;
         struct namespace *namespace;
 
         struct schema_table *table;
+        struct schema_table_field *table_field;
 
         element = NULL;
         namespace = NULL;
@@ -1645,6 +1964,34 @@ int schema_generate_js_jsonify (struct schema *schema, FILE *fp, int decoder_use
                 linearbuffers_errorf("fp is invalid");
                 goto bail;
         }
+        if (schema->align != 0) {
+                linearbuffers_errorf("align is not supported");
+                goto bail;
+        }
+        if (schema->string_type != schema_string_type_terminated) {
+                linearbuffers_errorf("string_type is not supported");
+                goto bail;
+        }
+        if (schema_has_bytes(schema)) {
+                linearbuffers_errorf("bytes is not supported");
+                goto bail;
+        }
+        if (schema_has_sparse(schema)) {
+                linearbuffers_errorf("sparse is not supported");
+                goto bail;
+        }
+        if (schema_has_encoding(schema)) {
+                linearbuffers_errorf("encoding is not supported");
+                goto bail;
+        }
+        if (schema_has_bool(schema)) {
+                linearbuffers_errorf("bool is not supported");
+                goto bail;
+        }
+        if (schema_has_half(schema)) {
+                linearbuffers_errorf("float16 and bfloat16 are not supported");
+                goto bail;
+        }
 
         rc = schema_generate_js_decoder(schema, fp, decoder_use_memcpy);
         if (rc != 0) {
@@ -1738,6 +2085,62 @@ int schema_generate_js_jsonify (struct schema *schema, FILE *fp, int decoder_use
         fprintf(fp, "#endif\n");
 
         TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type != schema_container_type_struct) {
+                        continue;
+                }
+                fprintf(fp, "\n");
+                fprintf(fp, "#if !defined(%s_JSONIFY_%s_EMITTER)\n", schema->NAMESPACE, table->name);
+                fprintf(fp, "#define %s_JSONIFY_%s_EMITTER\n", schema->NAMESPACE, table->name);
+                fprintf(fp, "static inline int %s_jsonify_%s_emitter (const struct %s_%s *value, int (*emitter) (void *context, const char *format, ...), void *context)\n", schema->namespace, table->name, schema->namespace, table->name);
+                fprintf(fp, "{\n");
+                fprintf(fp, "    int rc;\n");
+                fprintf(fp, "    if (value == NULL) {\n");
+                fprintf(fp, "        return emitter(context, \"null\");\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    rc = emitter(context, \"{\");\n");
+                fprintf(fp, "    if (rc < 0) {\n");
+                fprintf(fp, "        return rc;\n");
+                fprintf(fp, "    }\n");
+                TAILQ_FOREACH(table_field, &table->fields, list) {
+                        comma = (table_field == TAILQ_FIRST(&table->fields)) ? "" : ",";
+                        if (schema_type_is_scalar(table_field->type)) {
+                                if (strncmp(table_field->type, "int", 3) == 0) {
+                                        fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%\" PRIi64 \"\", (int64_t) value->%s);\n", comma, table_field->name, table_field->name);
+                                } else {
+                                        fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%\" PRIu64 \"\", (uint64_t) value->%s);\n", comma, table_field->name, table_field->name);
+                                }
+                        } else if (schema_type_is_float(table_field->type)) {
+                                fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%f\", value->%s);\n", comma, table_field->name, table_field->name);
+                        } else if (schema_type_is_enum(schema, table_field->type)) {
+                                if (strncmp(schema_type_get_enum(schema, table_field->type)->type, "int", 3) == 0) {
+                                        fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%\" PRIi64 \"\", (int64_t) value->%s);\n", comma, table_field->name, table_field->name);
+                                } else {
+                                        fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":%%\" PRIu64 \"\", (uint64_t) value->%s);\n", comma, table_field->name, table_field->name);
+                                }
+                        } else if (schema_type_is_struct(schema, table_field->type)) {
+                                fprintf(fp, "    rc = emitter(context, \"%s\\\"%s\\\":\");\n", comma, table_field->name);
+                                fprintf(fp, "    if (rc < 0) {\n");
+                                fprintf(fp, "        return rc;\n");
+                                fprintf(fp, "    }\n");
+                                fprintf(fp, "    rc = %s_jsonify_%s_emitter(&value->%s, emitter, context);\n", schema->namespace, table_field->type, table_field->name);
+                        }
+                        fprintf(fp, "    if (rc < 0) {\n");
+                        fprintf(fp, "        return rc;\n");
+                        fprintf(fp, "    }\n");
+                }
+                fprintf(fp, "    rc = emitter(context, \"}\");\n");
+                fprintf(fp, "    if (rc < 0) {\n");
+                fprintf(fp, "       return rc;\n");
+                fprintf(fp, "    }\n");
+                fprintf(fp, "    return 0;\n");
+                fprintf(fp, "}\n");
+                fprintf(fp, "#endif\n");
+        }
+
+        TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type == schema_container_type_struct) {
+                        continue;
+                }
                 fprintf(fp, "\n");
                 fprintf(fp, "#if !defined(%s_%s_JSONIFY_API)\n", schema->NAMESPACE, table->name);
                 fprintf(fp, "#define %s_%s_JSONIFY_API\n", schema->NAMESPACE, table->name);
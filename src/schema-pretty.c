@@ -59,7 +59,18 @@ int schema_generate_pretty (struct schema *schema, FILE *fp)
                 if (table->type == schema_container_type_struct) {
                         fprintf(fp, "struct %s {\n", table->name);
                 } else {
-                        fprintf(fp, "table %s {\n", table->name);
+                        fprintf(fp, "table %s", table->name);
+                        if (!TAILQ_EMPTY(&table->attributes)) {
+                                fprintf(fp, " (");
+                                TAILQ_FOREACH(attribute, &table->attributes, list) {
+                                        fprintf(fp, "%s%s", (TAILQ_FIRST(&table->attributes) == attribute) ? " " : ", ", attribute->name);
+                                        if (attribute->value != NULL) {
+                                                fprintf(fp, " = %s", attribute->value);
+                                        }
+                                }
+                                fprintf(fp, " )");
+                        }
+                        fprintf(fp, " {\n");
                 }
                 TAILQ_FOREACH(table_field, &table->fields, list) {
                         if (table_field->container == schema_container_type_none)  {
@@ -36,6 +36,8 @@ struct schema_table_field {
         char *Type;
         char *value;
         uint32_t container;
+        uint64_t align;
+        uint32_t encoding;
         struct schema_attributes attributes;
 };
 
@@ -44,6 +46,10 @@ struct schema_table {
         TAILQ_ENTRY(schema_table) list;
         char *name;
         uint32_t type;
+        uint32_t count_type;
+        uint32_t offset_type;
+        int sparse;
+        int promote;
         uint64_t nfields;
         struct schema_table_fields fields;
         struct schema_attributes attributes;
@@ -53,6 +59,8 @@ struct schema {
         char *namespace;
         uint32_t count_type;
         uint32_t offset_type;
+        uint64_t align;
+        uint32_t string_type;
         char *NAMESPACE;
         struct schema_enums enums;
         struct schema_tables tables;
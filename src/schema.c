@@ -110,6 +110,135 @@ uint64_t schema_offset_type_size (uint32_t type)
         return schema_offset_types[type].size;
 }
 
+static const struct {
+        const char *name;
+        uint32_t value;
+} schema_encoding_types[] = {
+        [schema_encoding_type_none]          = { "none"         , schema_encoding_type_none          },
+        [schema_encoding_type_bitpack]       = { "bitpack"      , schema_encoding_type_bitpack       },
+        [schema_encoding_type_delta_bitpack] = { "delta_bitpack", schema_encoding_type_delta_bitpack },
+        [schema_encoding_type_varint]        = { "varint"       , schema_encoding_type_varint        },
+        [schema_encoding_type_delta_varint]  = { "delta_varint" , schema_encoding_type_delta_varint  },
+        [schema_encoding_type_dictionary]    = { "dictionary"   , schema_encoding_type_dictionary    },
+        [schema_encoding_type_front_coded]   = { "front_coded"  , schema_encoding_type_front_coded   }
+};
+
+const char * schema_encoding_type_name (uint32_t type)
+{
+        if (type >= (sizeof(schema_encoding_types) / sizeof(schema_encoding_types[0]))) {
+                return "none";
+        }
+        return schema_encoding_types[type].name;
+}
+
+uint32_t schema_encoding_type_value (const char *type)
+{
+        uint64_t i;
+        for (i = 0; i < sizeof(schema_encoding_types) / sizeof(schema_encoding_types[0]); i++) {
+                if (strcmp(type, schema_encoding_types[i].name) == 0) {
+                        return schema_encoding_types[i].value;
+                }
+        }
+        return schema_encoding_type_none;
+}
+
+uint64_t schema_align_offset (struct schema *schema, uint64_t offset, uint64_t size)
+{
+        if (schema->align == 0 ||
+            size <= 1) {
+                return offset;
+        }
+        return (offset + size - 1) & ~(size - 1);
+}
+
+uint64_t schema_table_header_size (struct schema *schema, uint32_t count_type, uint64_t nfields)
+{
+        return schema_align_offset(schema, schema_count_type_size(count_type) + ((nfields + 7) / 8), sizeof(uint64_t));
+}
+
+uint64_t schema_table_field_size (struct schema *schema, uint32_t offset_type, struct schema_table_field *table_field)
+{
+        if (table_field->container == schema_container_type_vector) {
+                return schema_offset_type_size(offset_type);
+        } else if (schema_type_is_scalar(table_field->type)) {
+                return schema_inttype_size(table_field->type);
+        } else if (schema_type_is_float(table_field->type)) {
+                return schema_inttype_size(table_field->type);
+        } else if (schema_type_is_bool(table_field->type)) {
+                return 0;
+        } else if (schema_type_is_string(table_field->type)) {
+                return schema_offset_type_size(offset_type);
+        } else if (schema_type_is_bytes(table_field->type)) {
+                return schema_offset_type_size(offset_type);
+        } else if (schema_type_is_enum(schema, table_field->type)) {
+                return schema_inttype_size(schema_type_get_enum(schema, table_field->type)->type);
+        } else if (schema_type_is_table(schema, table_field->type)) {
+                return schema_offset_type_size(offset_type);
+        } else if (schema_type_is_struct(schema, table_field->type)) {
+                return schema_struct_size(schema, schema_type_get_table(schema, table_field->type));
+        }
+        return 0;
+}
+
+uint64_t schema_table_field_alignment (struct schema *schema, uint32_t offset_type, struct schema_table_field *table_field)
+{
+        if (table_field->container == schema_container_type_none &&
+            schema_type_is_struct(schema, table_field->type)) {
+                return schema_struct_alignment(schema, schema_type_get_table(schema, table_field->type));
+        }
+        if (table_field->container == schema_container_type_none &&
+            schema_type_is_bool(table_field->type)) {
+                return 1;
+        }
+        return schema_table_field_size(schema, offset_type, table_field);
+}
+
+uint64_t schema_struct_alignment (struct schema *schema, struct schema_table *table)
+{
+        uint64_t alignment;
+        uint64_t field_alignment;
+        struct schema_table_field *table_field;
+        alignment = 1;
+        TAILQ_FOREACH(table_field, &table->fields, list) {
+                field_alignment = schema_table_field_alignment(schema, schema->offset_type, table_field);
+                if (field_alignment > alignment) {
+                        alignment = field_alignment;
+                }
+        }
+        return alignment;
+}
+
+uint64_t schema_struct_size (struct schema *schema, struct schema_table *table)
+{
+        uint64_t size;
+        struct schema_table_field *table_field;
+        size = 0;
+        TAILQ_FOREACH(table_field, &table->fields, list) {
+                size = schema_align_offset(schema, size, schema_table_field_alignment(schema, schema->offset_type, table_field));
+                size += schema_table_field_size(schema, schema->offset_type, table_field);
+        }
+        return schema_align_offset(schema, size, schema_struct_alignment(schema, table));
+}
+
+uint64_t schema_vector_header_size (struct schema *schema, const char *type)
+{
+        uint64_t size;
+        if (schema_type_is_string(type) ||
+            schema_type_is_table(schema, type)) {
+                return schema_align_offset(schema, schema_count_type_size(schema->count_type), schema_offset_type_size(schema->offset_type));
+        }
+        if (schema_type_is_enum(schema, type)) {
+                size = schema_inttype_size(schema_type_get_enum(schema, type)->type);
+        } else if (schema_type_is_struct(schema, type)) {
+                size = schema_struct_alignment(schema, schema_type_get_table(schema, type));
+        } else if (schema_type_is_bool(type)) {
+                size = sizeof(uint64_t);
+        } else {
+                size = schema_inttype_size(type);
+        }
+        return schema_align_offset(schema, schema_count_type_size(schema->count_type), (size > schema->align) ? size : schema->align);
+}
+
 uint64_t schema_inttype_size (const char *type)
 {
         if (type == NULL) {
@@ -145,6 +274,12 @@ uint64_t schema_inttype_size (const char *type)
         if (strcmp(type, "double") == 0) {
                 return sizeof(double);
         }
+        if (strcmp(type, "float16") == 0) {
+                return sizeof(uint16_t);
+        }
+        if (strcmp(type, "bfloat16") == 0) {
+                return sizeof(uint16_t);
+        }
         return 0;
 }
 
@@ -191,6 +326,37 @@ int schema_type_is_float (const char *type)
         if (strcmp(type, "double") == 0) {
                 return 1;
         }
+        if (strcmp(type, "float16") == 0) {
+                return 1;
+        }
+        if (strcmp(type, "bfloat16") == 0) {
+                return 1;
+        }
+        return 0;
+}
+
+int schema_type_is_half (const char *type)
+{
+        if (type == NULL) {
+                return 0;
+        }
+        if (strcmp(type, "float16") == 0) {
+                return 1;
+        }
+        if (strcmp(type, "bfloat16") == 0) {
+                return 1;
+        }
+        return 0;
+}
+
+int schema_type_is_bool (const char *type)
+{
+        if (type == NULL) {
+                return 0;
+        }
+        if (strcmp(type, "bool") == 0) {
+                return 1;
+        }
         return 0;
 }
 
@@ -205,6 +371,17 @@ int schema_type_is_string (const char *type)
         return 0;
 }
 
+int schema_type_is_bytes (const char *type)
+{
+        if (type == NULL) {
+                return 0;
+        }
+        if (strcmp(type, "bytes") == 0) {
+                return 1;
+        }
+        return 0;
+}
+
 int schema_type_is_enum (struct schema *schema, const char *type)
 {
         struct schema_enum *anum;
@@ -267,7 +444,24 @@ int schema_type_is_table (struct schema *schema, const char *type)
         }
         TAILQ_FOREACH(table, &schema->tables, list) {
                 if (strcmp(table->name, type) == 0) {
-                        return 1;
+                        return (table->type != schema_container_type_struct);
+                }
+        }
+        return 0;
+}
+
+int schema_type_is_struct (struct schema *schema, const char *type)
+{
+        struct schema_table *table;
+        if (schema == NULL) {
+                return 0;
+        }
+        if (type == NULL) {
+                return 0;
+        }
+        TAILQ_FOREACH(table, &schema->tables, list) {
+                if (strcmp(table->name, type) == 0) {
+                        return (table->type == schema_container_type_struct);
                 }
         }
         return 0;
@@ -290,10 +484,18 @@ int schema_type_is_valid (struct schema *schema, const char *type)
         if (rc == 1) {
                 return 1;
         }
+        rc = schema_type_is_bool(type);
+        if (rc == 1) {
+                return 1;
+        }
         rc = schema_type_is_string(type);
         if (rc == 1) {
                 return 1;
         }
+        rc = schema_type_is_bytes(type);
+        if (rc == 1) {
+                return 1;
+        }
         rc = schema_type_is_enum(schema, type);
         if (rc == 1) {
                 return 1;
@@ -302,6 +504,10 @@ int schema_type_is_valid (struct schema *schema, const char *type)
         if (rc == 1) {
                 return 1;
         }
+        rc = schema_type_is_struct(schema, type);
+        if (rc == 1) {
+                return 1;
+        }
         return 0;
 }
 
@@ -632,6 +838,29 @@ int schema_table_field_add_attribute (struct schema_table_field *field, const ch
                 linearbuffers_errorf("field is invalid");
                 goto bail;
         }
+        if (name == NULL) {
+                linearbuffers_errorf("name is invalid");
+                goto bail;
+        }
+        if (strcmp(name, "align") == 0) {
+                field->align = (value != NULL) ? strtoull(value, NULL, 10) : 0;
+                if (field->align == 0 ||
+                    field->align > 4096 ||
+                    (field->align & (field->align - 1)) != 0) {
+                        linearbuffers_errorf("align is invalid: %s", value);
+                        goto bail;
+                }
+        } else if (strcmp(name, "encoding") == 0) {
+                field->encoding = (value != NULL) ? schema_encoding_type_value(value) : schema_encoding_type_none;
+                if (field->encoding == schema_encoding_type_none) {
+                        linearbuffers_errorf("encoding is invalid: %s", value);
+                        goto bail;
+                }
+        } else if (strcmp(name, "count_type") == 0 ||
+                   strcmp(name, "offset_type") == 0) {
+                linearbuffers_errorf("%s is not supported on fields, set it on the table", name);
+                goto bail;
+        }
         attribute = schema_attribute_create(name, value);
         if (attribute == NULL) {
                 linearbuffers_errorf("can not create attribute");
@@ -645,6 +874,19 @@ bail:   if (attribute != NULL) {
         return -1;
 }
 
+uint64_t schema_table_field_align (struct schema_table_field *field)
+{
+        if (field->align != 0) {
+                return field->align;
+        }
+        return sizeof(uint64_t);
+}
+
+uint32_t schema_table_field_encoding (struct schema_table_field *field)
+{
+        return field->encoding;
+}
+
 void schema_table_field_destroy (struct schema_table_field *field)
 {
         struct schema_attribute *attribute;
@@ -744,6 +986,88 @@ int schema_table_add_field (struct schema_table *table, struct schema_table_fiel
 bail:   return -1;
 }
 
+int schema_table_add_attribute (struct schema_table *table, const char *name, const char *value)
+{
+        struct schema_attribute *attribute;
+        attribute = NULL;
+        if (table == NULL) {
+                linearbuffers_errorf("table is invalid");
+                goto bail;
+        }
+        if (name == NULL) {
+                linearbuffers_errorf("name is invalid");
+                goto bail;
+        }
+        if (strcmp(name, "count_type") == 0) {
+                table->count_type = (value != NULL) ? schema_count_type_value(value) : schema_count_type_default;
+                if (table->count_type == schema_count_type_default) {
+                        linearbuffers_errorf("count_type is invalid: %s", value);
+                        goto bail;
+                }
+        } else if (strcmp(name, "offset_type") == 0 &&
+                   value != NULL &&
+                   strcmp(value, "auto") == 0) {
+                table->promote = 1;
+        } else if (strcmp(name, "offset_type") == 0) {
+                table->offset_type = (value != NULL) ? schema_offset_type_value(value) : schema_offset_type_default;
+                if (table->offset_type == schema_offset_type_default) {
+                        linearbuffers_errorf("offset_type is invalid: %s", value);
+                        goto bail;
+                }
+        } else if (strcmp(name, "sparse") == 0) {
+                if (value == NULL ||
+                    strcmp(value, "1") == 0 ||
+                    strcmp(value, "yes") == 0 ||
+                    strcmp(value, "true") == 0) {
+                        table->sparse = 1;
+                } else if (strcmp(value, "0") == 0 ||
+                           strcmp(value, "no") == 0 ||
+                           strcmp(value, "false") == 0) {
+                        table->sparse = 0;
+                } else {
+                        linearbuffers_errorf("sparse is invalid: %s", value);
+                        goto bail;
+                }
+        }
+        attribute = schema_attribute_create(name, value);
+        if (attribute == NULL) {
+                linearbuffers_errorf("can not create attribute");
+                goto bail;
+        }
+        TAILQ_INSERT_TAIL(&table->attributes, attribute, list);
+        return 0;
+bail:   if (attribute != NULL) {
+                schema_attribute_destroy(attribute);
+        }
+        return -1;
+}
+
+uint32_t schema_table_count_type (struct schema *schema, struct schema_table *table)
+{
+        if (table->count_type != schema_count_type_default) {
+                return table->count_type;
+        }
+        return schema->count_type;
+}
+
+uint32_t schema_table_offset_type (struct schema *schema, struct schema_table *table)
+{
+        if (table->offset_type != schema_offset_type_default) {
+                return table->offset_type;
+        }
+        return schema->offset_type;
+}
+
+int schema_table_sparse (struct schema_table *table)
+{
+        return ((table->sparse || table->promote) && table->nfields > 0);
+}
+
+int schema_table_promoted (struct schema_table *table)
+{
+        return (table->promote && table->nfields > 0);
+}
+
 void schema_table_destroy (struct schema_table *table)
 {
         struct schema_table_field *field;
@@ -859,6 +1183,49 @@ int schema_set_offset_type (struct schema *schema, const char *type)
 bail:   return -1;
 }
 
+int schema_set_align (struct schema *schema, const char *align)
+{
+        if (schema == NULL) {
+                linearbuffers_errorf("schema is invalid");
+                goto bail;
+        }
+        if (align == NULL ||
+            strcmp(align, "packed") == 0) {
+                schema->align = 0;
+        } else if (strcmp(align, "natural") == 0) {
+                schema->align = 1;
+        } else if (strcmp(align, "8") == 0 ||
+                   strcmp(align, "16") == 0 ||
+                   strcmp(align, "32") == 0 ||
+                   strcmp(align, "64") == 0) {
+                schema->align = strtoull(align, NULL, 10);
+        } else {
+                linearbuffers_errorf("align is invalid");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
+int schema_set_string_type (struct schema *schema, const char *type)
+{
+        if (schema == NULL) {
+                linearbuffers_errorf("schema is invalid");
+                goto bail;
+        }
+        if (type == NULL ||
+            strcmp(type, "terminated") == 0) {
+                schema->string_type = schema_string_type_terminated;
+        } else if (strcmp(type, "prefixed") == 0) {
+                schema->string_type = schema_string_type_prefixed;
+        } else {
+                linearbuffers_errorf("string_type is invalid");
+                goto bail;
+        }
+        return 0;
+bail:   return -1;
+}
+
 int schema_add_table (struct schema *schema, struct schema_table *table)
 {
         if (schema == NULL) {
@@ -1000,11 +1367,71 @@ static int schema_check (struct schema *schema)
         }
 
         TAILQ_FOREACH(table, &schema->tables, list) {
+                if (table->type == schema_container_type_struct &&
+                    (table->sparse || table->promote)) {
+                        linearbuffers_errorf("schema struct: %s is invalid, struct can not be sparse", table->name);
+                        goto bail;
+                }
                 TAILQ_FOREACH(table_field, &table->fields, list) {
                         if (!schema_type_is_valid(schema, table_field->type)) {
                                 linearbuffers_errorf("schema table field type: %s is invalid", table_field->type);
                                 goto bail;
                         }
+                        if (schema_type_is_bytes(table_field->type)) {
+                                if (table_field->container != schema_container_type_none ||
+                                    table_field->value != NULL) {
+                                        linearbuffers_errorf("schema table field: %s is invalid, bytes can not be a vector or have a value", table_field->name);
+                                        goto bail;
+                                }
+                        } else if (table_field->align != 0) {
+                                linearbuffers_errorf("schema table field: %s is invalid, align is only valid for bytes", table_field->name);
+                                goto bail;
+                        }
+                        if (schema_type_is_bool(table_field->type) &&
+                            table_field->value != NULL) {
+                                if (strcmp(table_field->value, "true") != 0 &&
+                                    strcmp(table_field->value, "false") != 0) {
+                                        linearbuffers_errorf("schema table field: %s is invalid, bool value must be true or false", table_field->name);
+                                        goto bail;
+                                }
+                        }
+                        if (table_field->encoding == schema_encoding_type_dictionary ||
+                            table_field->encoding == schema_encoding_type_front_coded) {
+                                if (table_field->container != schema_container_type_vector ||
+                                    !schema_type_is_string(table_field->type)) {
+                                        linearbuffers_errorf("schema table field: %s is invalid, %s is only valid for string vectors", table_field->name, schema_encoding_type_name(table_field->encoding));
+                                        goto bail;
+                                }
+                        } else if (table_field->encoding != schema_encoding_type_none) {
+                                if (table_field->container != schema_container_type_vector ||
+                                    !schema_type_is_scalar(table_field->type)) {
+                                        linearbuffers_errorf("schema table field: %s is invalid, encoding is only valid for integer vectors", table_field->name);
+                                        goto bail;
+                                }
+                        }
+                        if (table->type == schema_container_type_struct) {
+                                if (table_field->container != schema_container_type_none ||
+                                    table_field->value != NULL) {
+                                        linearbuffers_errorf("schema struct field: %s is invalid, struct field can not be a vector or have a value", table_field->name);
+                                        goto bail;
+                                }
+                                if (schema_type_is_struct(schema, table_field->type)) {
+                                        for (ntable = TAILQ_FIRST(&schema->tables); ntable != table; ntable = ntable->list.tqe_next) {
+                                                if (strcmp(ntable->name, table_field->type) == 0) {
+                                                        break;
+                                                }
+                                        }
+                                        if (ntable == table) {
+                                                linearbuffers_errorf("schema struct field: %s is invalid, struct must be declared before use", table_field->name);
+                                                goto bail;
+                                        }
+                                } else if (!schema_type_is_scalar(table_field->type) &&
+                                           !schema_type_is_float(table_field->type) &&
+                                           !schema_type_is_enum(schema, table_field->type)) {
+                                        linearbuffers_errorf("schema struct field: %s is invalid, type: %s is not fixed size", table_field->name, table_field->type);
+                                        goto bail;
+                                }
+                        }
                 }
                 TAILQ_FOREACH(table_field, &table->fields, list) {
                         for (ntable_field = table_field->list.tqe_next; ntable_field; ntable_field = ntable_field->list.tqe_next) {
@@ -24,6 +24,21 @@ enum {
         schema_offset_type_uint64
 };
 
+enum {
+        schema_string_type_terminated,
+        schema_string_type_prefixed
+};
+
+enum {
+        schema_encoding_type_none,
+        schema_encoding_type_bitpack,
+        schema_encoding_type_delta_bitpack,
+        schema_encoding_type_varint,
+        schema_encoding_type_delta_varint,
+        schema_encoding_type_dictionary,
+        schema_encoding_type_front_coded
+};
+
 enum {
         schema_container_type_none,
         schema_container_type_vector,
@@ -45,18 +60,27 @@ int schema_table_field_set_name (struct schema_table_field *field, const char *n
 int schema_table_field_set_type (struct schema_table_field *field, uint32_t container, const char *type);
 int schema_table_field_set_value (struct schema_table_field *field, const char *value);
 int schema_table_field_add_attribute (struct schema_table_field *field, const char *name, const char *value);
+uint64_t schema_table_field_align (struct schema_table_field *field);
+uint32_t schema_table_field_encoding (struct schema_table_field *field);
 void schema_table_field_destroy (struct schema_table_field *field);
 struct schema_table_field * schema_table_field_create (void);
 
 int schema_table_set_type (struct schema_table *table, uint32_t container);
 int schema_table_set_name (struct schema_table *table, const char *name);
 int schema_table_add_field (struct schema_table *table, struct schema_table_field *field);
+int schema_table_add_attribute (struct schema_table *table, const char *name, const char *value);
+uint32_t schema_table_count_type (struct schema *schema, struct schema_table *table);
+uint32_t schema_table_offset_type (struct schema *schema, struct schema_table *table);
+int schema_table_sparse (struct schema_table *table);
+int schema_table_promoted (struct schema_table *table);
 void schema_table_destroy (struct schema_table *table);
 struct schema_table * schema_table_create (void);
 
 int schema_set_namespace (struct schema *schema, const char *name);
 int schema_set_count_type (struct schema *schema, const char *type);
 int schema_set_offset_type (struct schema *schema, const char *type);
+int schema_set_align (struct schema *schema, const char *align);
+int schema_set_string_type (struct schema *schema, const char *type);
 int schema_add_enum (struct schema *schema, struct schema_enum *anum);
 int schema_add_table (struct schema *schema, struct schema_table *table);
 void schema_destroy (struct schema *schema);
@@ -70,9 +94,13 @@ struct schema_table * schema_type_get_table (struct schema *schema, const char *
 uint64_t schema_inttype_size (const char *type);
 int schema_type_is_scalar (const char *type);
 int schema_type_is_float (const char *type);
+int schema_type_is_half (const char *type);
+int schema_type_is_bool (const char *type);
 int schema_type_is_string (const char *type);
+int schema_type_is_bytes (const char *type);
 int schema_type_is_enum (struct schema *schema, const char *type);
 int schema_type_is_table (struct schema *schema, const char *type);
+int schema_type_is_struct (struct schema *schema, const char *type);
 int schema_type_is_valid (struct schema *schema, const char *type);
 int schema_value_is_scalar (const char *value);
 
@@ -83,3 +111,14 @@ uint64_t schema_count_type_size (uint32_t type);
 const char * schema_offset_type_name (uint32_t type);
 uint32_t schema_offset_type_value (const char *type);
 uint64_t schema_offset_type_size (uint32_t type);
+
+const char * schema_encoding_type_name (uint32_t type);
+uint32_t schema_encoding_type_value (const char *type);
+
+uint64_t schema_align_offset (struct schema *schema, uint64_t offset, uint64_t size);
+uint64_t schema_table_header_size (struct schema *schema, uint32_t count_type, uint64_t nfields);
+uint64_t schema_table_field_size (struct schema *schema, uint32_t offset_type, struct schema_table_field *table_field);
+uint64_t schema_table_field_alignment (struct schema *schema, uint32_t offset_type, struct schema_table_field *table_field);
+uint64_t schema_struct_size (struct schema *schema, struct schema_table *table);
+uint64_t schema_struct_alignment (struct schema *schema, struct schema_table *table);
+uint64_t schema_vector_header_size (struct schema *schema, const char *type);
@@ -9,6 +9,7 @@ int main (int argc, char *argv[])
 
         size_t i;
         uint8_t data[10];
+        struct linearbuffers_timeval timeval;
 
         uint64_t linearized_length;
         const char *linearized_buffer;
@@ -30,11 +31,11 @@ int main (int argc, char *argv[])
                 goto bail;
         }
 
+        timeval.seconds = 2;
+        timeval.useconds = 3;
+
         rc  = linearbuffers_output_start(encoder);
-        rc |= linearbuffers_timeval_start(encoder);
-        rc |= linearbuffers_timeval_seconds_set(encoder, 2);
-        rc |= linearbuffers_timeval_useconds_set(encoder, 3);
-        rc |= linearbuffers_output_timeval_set(encoder, linearbuffers_timeval_end(encoder));
+        rc |= linearbuffers_output_timeval_set(encoder, &timeval);
         rc |= linearbuffers_output_length_set(encoder, sizeof(data) / sizeof(data[0]));
         rc |= linearbuffers_output_data_set(encoder, (uintptr_t) data);
         rc |= linearbuffers_output_finish(encoder);
@@ -0,0 +1,54 @@
+
+var LinearBuffers = require('../src/encoder.js');
+var Encoder       = require('../test/15-encoder.js');
+var Decoder       = require('../test/15-decoder.js');
+
+var rc;
+var encoder;
+var linearized;
+var output;
+var timeval;
+
+encoder = new LinearBuffers.LinearBuffersEncoder();
+if (encoder == null) {
+        throw "can not create encoder";
+}
+
+rc  = Encoder.linearbuffers_output_start(encoder);
+rc |= Encoder.linearbuffers_output_timeval_set(encoder, { seconds: 1, useconds: 2 });
+rc |= Encoder.linearbuffers_output_length_set(encoder, 3);
+rc |= Encoder.linearbuffers_output_data_set(encoder, 4);
+rc |= Encoder.linearbuffers_output_finish(encoder);
+if (rc != 0) {
+        throw "can not encode output";
+}
+
+linearized = encoder.linearized();
+if (linearized == null) {
+        throw "can not get linearized buffer";
+}
+
+console.log(linearized);
+
+output = Decoder.linearbuffers_output_decode(linearized);
+if (output == null) {
+        throw "decoder failed: linearbuffers_output_decode";
+}
+timeval = Decoder.linearbuffers_output_timeval_get(output);
+if (timeval == null) {
+        throw "decoder failed: linearbuffers_output_timeval_get";
+}
+if (timeval.seconds != 1) {
+        throw "decoder failed: linearbuffers_output_timeval_get: seconds";
+}
+if (timeval.useconds != 2) {
+        throw "decoder failed: linearbuffers_output_timeval_get: useconds";
+}
+if (Decoder.linearbuffers_output_length_get(output) != 3) {
+        throw "decoder failed: linearbuffers_output_length_get";
+}
+if (Decoder.linearbuffers_output_data_get(output) != 4) {
+        throw "decoder failed: linearbuffers_output_data_get";
+}
+
+delete encoder;
@@ -0,0 +1,137 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define UINT8S_COUNT	(1024 * 1024)
+#define STRINGS_COUNT	(64 * 1024)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	size_t i;
+	uint8_t *uint8s;
+	char string[32];
+
+	int64_t niovec;
+	uint64_t iovec_length;
+	struct linearbuffers_encoder_iovec *iovec;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+	iovec = NULL;
+	uint8s = NULL;
+
+	srand(time(NULL));
+
+	uint8s = malloc(UINT8S_COUNT);
+	if (uint8s == NULL) {
+		fprintf(stderr, "can not allocate memory\n");
+		goto bail;
+	}
+	for (i = 0; i < UINT8S_COUNT; i++) {
+		uint8s[i] = rand();
+	}
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_uint8s_create(encoder, uint8s, UINT8S_COUNT);
+	rc |= linearbuffers_output_strings_start(encoder);
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%zd", i);
+		rc |= linearbuffers_output_strings_push_create(encoder, string);
+	}
+	rc |= linearbuffers_output_strings_set(encoder, linearbuffers_output_strings_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	niovec = linearbuffers_encoder_iovec(encoder, NULL, 0);
+	if (niovec <= 1) {
+		fprintf(stderr, "encoder failed: linearbuffers_encoder_iovec\n");
+		goto bail;
+	}
+	iovec = malloc(sizeof(struct linearbuffers_encoder_iovec) * niovec);
+	if (iovec == NULL) {
+		fprintf(stderr, "can not allocate memory\n");
+		goto bail;
+	}
+	if (linearbuffers_encoder_iovec(encoder, iovec, niovec) != niovec) {
+		fprintf(stderr, "encoder failed: linearbuffers_encoder_iovec\n");
+		goto bail;
+	}
+	for (iovec_length = 0, i = 0; i < (size_t) niovec; i++) {
+		iovec_length += iovec[i].length;
+	}
+	free(iovec);
+	iovec = NULL;
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 ", iovec: %" PRIi64 "\n", linearized_buffer, linearized_length, niovec);
+	if (linearized_length != iovec_length) {
+		fprintf(stderr, "encoder failed: linearbuffers_encoder_iovec length\n");
+		goto bail;
+	}
+	if (linearbuffers_encoder_iovec(encoder, NULL, 0) != 1) {
+		fprintf(stderr, "encoder failed: linearbuffers_encoder_linearized\n");
+		goto bail;
+	}
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	if (linearbuffers_output_uint8s_get_count(output) != UINT8S_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint8s_get_count\n");
+		goto bail;
+	}
+	if (memcmp(linearbuffers_output_uint8s_get_values(output), uint8s, UINT8S_COUNT)) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint8s_get_values\n");
+		goto bail;
+	}
+	if (linearbuffers_output_strings_get_count(output) != STRINGS_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_strings_get_count\n");
+		goto bail;
+	}
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%zd", i);
+		if (strcmp(linearbuffers_output_strings_get_at(output, i), string) != 0) {
+			fprintf(stderr, "decoder failed: linearbuffers_output_strings_get_at\n");
+			goto bail;
+		}
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+	free(uint8s);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	if (iovec != NULL) {
+		free(iovec);
+	}
+	if (uint8s != NULL) {
+		free(uint8s);
+	}
+	return -1;
+}
@@ -0,0 +1,244 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define WIDES_COUNT	4
+
+#define WIDE_FIELDS(F) \
+	F(0) \
+	F(1) \
+	F(2) \
+	F(3) \
+	F(4) \
+	F(5) \
+	F(6) \
+	F(7) \
+	F(8) \
+	F(9) \
+	F(10) \
+	F(11) \
+	F(12) \
+	F(13) \
+	F(14) \
+	F(15) \
+	F(16) \
+	F(17) \
+	F(18) \
+	F(19) \
+	F(20) \
+	F(21) \
+	F(22) \
+	F(23) \
+	F(24) \
+	F(25) \
+	F(26) \
+	F(27) \
+	F(28) \
+	F(29) \
+	F(30) \
+	F(31) \
+	F(32) \
+	F(33) \
+	F(34) \
+	F(35) \
+	F(36) \
+	F(37) \
+	F(38) \
+	F(39) \
+	F(40) \
+	F(41) \
+	F(42) \
+	F(43) \
+	F(44) \
+	F(45) \
+	F(46) \
+	F(47) \
+	F(48) \
+	F(49) \
+	F(50) \
+	F(51) \
+	F(52) \
+	F(53) \
+	F(54) \
+	F(55) \
+	F(56) \
+	F(57) \
+	F(58) \
+	F(59) \
+	F(60) \
+	F(61) \
+	F(62) \
+	F(63) \
+	F(64) \
+	F(65) \
+	F(66) \
+	F(67) \
+	F(68) \
+	F(69) \
+	F(70) \
+	F(71) \
+	F(72) \
+	F(73) \
+	F(74) \
+	F(75) \
+	F(76) \
+	F(77) \
+	F(78) \
+	F(79) \
+	F(80) \
+	F(81) \
+	F(82) \
+	F(83) \
+	F(84) \
+	F(85) \
+	F(86) \
+	F(87) \
+	F(88) \
+	F(89) \
+	F(90) \
+	F(91) \
+	F(92) \
+	F(93) \
+	F(94) \
+	F(95) \
+	F(96) \
+	F(97) \
+	F(98) \
+	F(99) \
+	F(100) \
+	F(101) \
+	F(102) \
+	F(103) \
+	F(104) \
+	F(105) \
+	F(106) \
+	F(107) \
+	F(108) \
+	F(109) \
+	F(110) \
+	F(111) \
+	F(112) \
+	F(113) \
+	F(114) \
+	F(115) \
+	F(116) \
+	F(117) \
+	F(118) \
+	F(119) \
+	F(120) \
+	F(121) \
+	F(122) \
+	F(123) \
+	F(124) \
+	F(125) \
+	F(126) \
+	F(127) \
+	F(128) \
+	F(129) \
+	F(130) \
+	F(131) \
+	F(132) \
+	F(133) \
+	F(134) \
+	F(135)
+
+#define WIDE_VALUE(n, s)	((uint16_t) ((n) * 31 + (s)))
+
+static int wide_encode (struct linearbuffers_encoder *encoder, uint16_t seed)
+{
+	int rc;
+	rc = linearbuffers_wide_start(encoder);
+#define F(n) \
+	if ((n) % 3) { \
+		rc |= linearbuffers_wide_f ## n ## _set(encoder, WIDE_VALUE(n, seed)); \
+	}
+	WIDE_FIELDS(F)
+#undef F
+	return rc;
+}
+
+static int wide_check (const struct linearbuffers_wide *wide, uint16_t seed)
+{
+#define F(n) \
+	if (linearbuffers_wide_f ## n ## _present(wide) != !!((n) % 3)) { \
+		fprintf(stderr, "decoder failed: linearbuffers_wide_f" #n "_present\n"); \
+		return -1; \
+	} \
+	if (((n) % 3) && linearbuffers_wide_f ## n ## _get(wide) != WIDE_VALUE(n, seed)) { \
+		fprintf(stderr, "decoder failed: linearbuffers_wide_f" #n "_get\n"); \
+		return -1; \
+	}
+	WIDE_FIELDS(F)
+#undef F
+	return 0;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	uint64_t i;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_wides_start(encoder);
+	for (i = 0; i < WIDES_COUNT; i++) {
+		rc |= wide_encode(encoder, i + 1);
+		rc |= linearbuffers_output_wides_push(encoder, linearbuffers_wide_end(encoder));
+	}
+	rc |= linearbuffers_output_wides_set(encoder, linearbuffers_output_wides_end(encoder));
+	rc |= wide_encode(encoder, 0);
+	rc |= linearbuffers_output_wide_set(encoder, linearbuffers_wide_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (wide_check(linearbuffers_output_wide_get(output), 0) != 0) {
+		goto bail;
+	}
+	if (linearbuffers_output_wides_get_count(output) != WIDES_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_wides_get_count\n");
+		goto bail;
+	}
+	for (i = 0; i < WIDES_COUNT; i++) {
+		if (wide_check(linearbuffers_output_wides_get_at(output, i), i + 1) != 0) {
+			goto bail;
+		}
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,120 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ARRAY_COUNT	64
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+	const struct linearbuffers_a_table *a_table;
+
+	uint64_t i;
+	char *strings[ARRAY_COUNT];
+	uint64_t lengths[ARRAY_COUNT];
+	uint64_t tables[ARRAY_COUNT];
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+	memset(strings, 0, sizeof(strings));
+
+	for (i = 0; i < ARRAY_COUNT; i++) {
+		rc = asprintf(&strings[i], "string-%" PRIu64 "-suffix", i);
+		if (rc < 0) {
+			fprintf(stderr, "can not allocate memory\n");
+			goto bail;
+		}
+		lengths[i] = strlen(strings[i]) - strlen("-suffix");
+	}
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_strings_create(encoder, (const char **) strings, ARRAY_COUNT);
+	rc |= linearbuffers_output_nstrings_ncreate(encoder, (const char **) strings, lengths, ARRAY_COUNT);
+	rc |= linearbuffers_output_tables_start(encoder);
+	for (i = 0; i < ARRAY_COUNT; i++) {
+		rc |= linearbuffers_a_table_start(encoder);
+		rc |= linearbuffers_a_table_uint32_set(encoder, i);
+		rc |= linearbuffers_a_table_string_create(encoder, strings[i]);
+		tables[i] = (uint64_t) (ptrdiff_t) linearbuffers_a_table_end(encoder);
+	}
+	rc |= linearbuffers_encoder_vector_push_tables(encoder, tables, ARRAY_COUNT);
+	rc |= linearbuffers_output_tables_set(encoder, linearbuffers_output_tables_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (linearbuffers_output_strings_get_count(output) != ARRAY_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_strings_get_count\n");
+		goto bail;
+	}
+	if (linearbuffers_output_nstrings_get_count(output) != ARRAY_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_nstrings_get_count\n");
+		goto bail;
+	}
+	if (linearbuffers_output_tables_get_count(output) != ARRAY_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_tables_get_count\n");
+		goto bail;
+	}
+	for (i = 0; i < ARRAY_COUNT; i++) {
+		if (strcmp(linearbuffers_output_strings_get_at(output, i), strings[i]) != 0) {
+			fprintf(stderr, "decoder failed: linearbuffers_output_strings_get_at\n");
+			goto bail;
+		}
+		if (strlen(linearbuffers_output_nstrings_get_at(output, i)) != lengths[i] ||
+		    strncmp(linearbuffers_output_nstrings_get_at(output, i), strings[i], lengths[i]) != 0) {
+			fprintf(stderr, "decoder failed: linearbuffers_output_nstrings_get_at\n");
+			goto bail;
+		}
+		a_table = linearbuffers_output_tables_get_at(output, i);
+		if (linearbuffers_a_table_uint32_get(a_table) != i) {
+			fprintf(stderr, "decoder failed: linearbuffers_a_table_uint32_get\n");
+			goto bail;
+		}
+		if (strcmp(linearbuffers_a_table_string_get_value(a_table), strings[i]) != 0) {
+			fprintf(stderr, "decoder failed: linearbuffers_a_table_string_get\n");
+			goto bail;
+		}
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+	for (i = 0; i < ARRAY_COUNT; i++) {
+		free(strings[i]);
+	}
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	for (i = 0; i < ARRAY_COUNT; i++) {
+		free(strings[i]);
+	}
+	return -1;
+}
@@ -0,0 +1,234 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#define UINT8S_COUNT	(3000)
+#define UINT8S_READ	(2500)
+#define UINT32S_COUNT	(1024)
+#define UINT32S_USED	(1000)
+
+struct emitter_param {
+	uint64_t length;
+	uint64_t size;
+	uint8_t *buffer;
+};
+
+static int emitter_function (void *context, uint64_t offset, const void *buffer, int64_t length)
+{
+	uint8_t *tmp;
+	struct emitter_param *emitter_param = context;
+	if (length < 0) {
+		emitter_param->length = offset + length;
+		return 0;
+	}
+	if (offset + length > emitter_param->size) {
+		tmp = realloc(emitter_param->buffer, offset + length);
+		if (tmp == NULL) {
+			return -1;
+		}
+		emitter_param->buffer = tmp;
+		emitter_param->size = offset + length;
+	}
+	if (buffer == NULL) {
+		memset(emitter_param->buffer + offset, 0, length);
+	} else {
+		memcpy(emitter_param->buffer + offset, buffer, length);
+	}
+	emitter_param->length = (emitter_param->length > offset + length) ? emitter_param->length : offset + length;
+	return 0;
+}
+
+static int encode (struct linearbuffers_encoder *encoder, const uint8_t *uint8s)
+{
+	int rc;
+	size_t i;
+	int fds[2];
+	ssize_t nread;
+	uint8_t *uint8s_reserved;
+	uint32_t *uint32s_reserved;
+	char *string_reserved;
+
+	fds[0] = -1;
+	fds[1] = -1;
+
+	rc = pipe(fds);
+	if (rc != 0) {
+		fprintf(stderr, "can not create pipe\n");
+		goto bail;
+	}
+	if (write(fds[1], uint8s, UINT8S_READ) != UINT8S_READ) {
+		fprintf(stderr, "can not write pipe\n");
+		goto bail;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_uint8_vector_reserve(encoder, UINT8S_COUNT, &uint8s_reserved);
+	if (rc != 0) {
+		fprintf(stderr, "can not reserve uint8s\n");
+		goto bail;
+	}
+	nread = read(fds[0], uint8s_reserved, UINT8S_COUNT);
+	if (nread != UINT8S_READ) {
+		fprintf(stderr, "can not read pipe\n");
+		goto bail;
+	}
+	rc |= linearbuffers_output_uint8s_set(encoder, linearbuffers_uint8_vector_commit(encoder, nread));
+
+	rc |= linearbuffers_uint32_vector_reserve(encoder, UINT32S_COUNT, &uint32s_reserved);
+	if (rc != 0) {
+		fprintf(stderr, "can not reserve uint32s\n");
+		goto bail;
+	}
+	if ((uintptr_t) uint32s_reserved % sizeof(uint32_t) != 0) {
+		fprintf(stderr, "reserved uint32s are not aligned\n");
+		goto bail;
+	}
+	for (i = 0; i < UINT32S_USED; i++) {
+		uint32s_reserved[i] = i * 3;
+	}
+	rc |= linearbuffers_output_uint32s_set(encoder, linearbuffers_uint32_vector_commit(encoder, UINT32S_USED));
+
+	rc |= linearbuffers_string_reserve(encoder, 64, &string_reserved);
+	if (rc != 0) {
+		fprintf(stderr, "can not reserve string\n");
+		goto bail;
+	}
+	rc |= linearbuffers_output_string_set(encoder, linearbuffers_string_commit(encoder, snprintf(string_reserved, 64, "reserved-%d", UINT32S_USED)));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	close(fds[0]);
+	close(fds[1]);
+	return 0;
+bail:	if (fds[0] >= 0) {
+		close(fds[0]);
+	}
+	if (fds[1] >= 0) {
+		close(fds[1]);
+	}
+	return -1;
+}
+
+static int decode (const void *buffer, uint64_t length, const uint8_t *uint8s)
+{
+	size_t i;
+	const struct linearbuffers_output *output;
+
+	output = linearbuffers_output_decode(buffer, length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	if (linearbuffers_output_uint8s_get_count(output) != UINT8S_READ) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint8s_get_count\n");
+		goto bail;
+	}
+	if (memcmp(linearbuffers_output_uint8s_get_values(output), uint8s, UINT8S_READ)) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint8s_get_values\n");
+		goto bail;
+	}
+	if (linearbuffers_output_uint32s_get_count(output) != UINT32S_USED) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint32s_get_count\n");
+		goto bail;
+	}
+	for (i = 0; i < UINT32S_USED; i++) {
+		if (linearbuffers_output_uint32s_get_at(output, i) != i * 3) {
+			fprintf(stderr, "decoder failed: linearbuffers_output_uint32s_get_at\n");
+			goto bail;
+		}
+	}
+	if (strcmp(linearbuffers_output_string_get_value(output), "reserved-1000") != 0) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_string_get\n");
+		goto bail;
+	}
+	return 0;
+bail:	return -1;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	size_t i;
+	uint8_t uint8s[UINT8S_READ];
+
+	struct emitter_param emitter_param;
+	struct linearbuffers_encoder *encoder;
+	struct linearbuffers_encoder_reset_options encoder_reset_options;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+	memset(&emitter_param, 0, sizeof(struct emitter_param));
+
+	srand(time(NULL));
+	for (i = 0; i < UINT8S_READ; i++) {
+		uint8s[i] = rand();
+	}
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	for (i = 0; i < 2; i++) {
+		rc = linearbuffers_encoder_reset(encoder, NULL);
+		if (rc != 0) {
+			fprintf(stderr, "can not reset encoder\n");
+			goto bail;
+		}
+		rc = encode(encoder, uint8s);
+		if (rc != 0) {
+			goto bail;
+		}
+		linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+		if (linearized_buffer == NULL) {
+			fprintf(stderr, "can not get linearized buffer\n");
+			goto bail;
+		}
+		fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+		rc = decode(linearized_buffer, linearized_length, uint8s);
+		if (rc != 0) {
+			goto bail;
+		}
+	}
+
+	memset(&encoder_reset_options, 0, sizeof(struct linearbuffers_encoder_reset_options));
+	encoder_reset_options.emitter.context = &emitter_param;
+	encoder_reset_options.emitter.function = emitter_function;
+	rc = linearbuffers_encoder_reset(encoder, &encoder_reset_options);
+	if (rc != 0) {
+		fprintf(stderr, "can not reset encoder\n");
+		goto bail;
+	}
+	rc = encode(encoder, uint8s);
+	if (rc != 0) {
+		goto bail;
+	}
+	fprintf(stderr, "emitted: %p, length: %" PRIu64 "\n", emitter_param.buffer, emitter_param.length);
+	rc = decode(emitter_param.buffer, emitter_param.length, uint8s);
+	if (rc != 0) {
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+	free(emitter_param.buffer);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	if (emitter_param.buffer != NULL) {
+		free(emitter_param.buffer);
+	}
+	return -1;
+}
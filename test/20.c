@@ -0,0 +1,183 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TABLES_COUNT	16
+#define UINT8S_COUNT	1024
+
+static uint64_t encoder_buffer[1024];
+static uint64_t output_buffer[1024];
+static uint64_t arena_buffer[256];
+
+static int encode (struct linearbuffers_encoder *encoder, const uint8_t *uint8s, uint64_t uint8s_count)
+{
+	int rc;
+	uint64_t i;
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_a_table_start(encoder);
+	rc |= linearbuffers_a_table_uint32_set(encoder, TABLES_COUNT);
+	rc |= linearbuffers_a_table_string_createf(encoder, "a_table-%d", TABLES_COUNT);
+	rc |= linearbuffers_output_a_table_set(encoder, linearbuffers_a_table_end(encoder));
+	rc |= linearbuffers_output_tables_start(encoder);
+	for (i = 0; i < TABLES_COUNT; i++) {
+		rc |= linearbuffers_a_table_start(encoder);
+		rc |= linearbuffers_a_table_uint32_set(encoder, i);
+		rc |= linearbuffers_a_table_string_createf(encoder, "a_table-%" PRIu64 "", i);
+		rc |= linearbuffers_output_tables_push(encoder, linearbuffers_a_table_end(encoder));
+	}
+	rc |= linearbuffers_output_tables_set(encoder, linearbuffers_output_tables_end(encoder));
+	rc |= linearbuffers_output_uint8s_create(encoder, uint8s, uint8s_count);
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	uint64_t arena_size;
+	char string[32];
+	uint8_t uint8s[UINT8S_COUNT * 8];
+
+	struct linearbuffers_encoder *encoder;
+	struct linearbuffers_encoder_create_options encoder_create_options;
+	const struct linearbuffers_output *output;
+	const struct linearbuffers_a_table *a_table;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+
+	for (i = 0; i < sizeof(uint8s); i++) {
+		uint8s[i] = i;
+	}
+
+	if (linearbuffers_encoder_sizeof() > sizeof(encoder_buffer)) {
+		fprintf(stderr, "encoder buffer is too small: %" PRIu64 "\n", linearbuffers_encoder_sizeof());
+		goto bail;
+	}
+
+	memset(&encoder_create_options, 0, sizeof(struct linearbuffers_encoder_create_options));
+	encoder_create_options.output.buffer = output_buffer;
+	encoder_create_options.output.size = sizeof(output_buffer);
+	encoder_create_options.arena.buffer = arena_buffer;
+	encoder_create_options.arena.size = sizeof(arena_buffer);
+
+	encoder = linearbuffers_encoder_init(encoder_buffer, sizeof(encoder_buffer), &encoder_create_options);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not init linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc = encode(encoder, uint8s, UINT8S_COUNT * 8);
+	if (rc == 0) {
+		fprintf(stderr, "encoder failed: output overflow is not detected\n");
+		goto bail;
+	}
+
+	rc  = linearbuffers_encoder_reset(encoder, NULL);
+	rc |= encode(encoder, uint8s, UINT8S_COUNT);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer != (const uint8_t *) output_buffer) {
+		fprintf(stderr, "encoder failed: linearbuffers_encoder_linearized\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	a_table = linearbuffers_output_a_table_get(output);
+	if (linearbuffers_a_table_uint32_get(a_table) != TABLES_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_a_table_uint32_get\n");
+		goto bail;
+	}
+	snprintf(string, sizeof(string), "a_table-%d", TABLES_COUNT);
+	if (strcmp(linearbuffers_a_table_string_get_value(a_table), string) != 0) {
+		fprintf(stderr, "decoder failed: linearbuffers_a_table_string_get_value\n");
+		goto bail;
+	}
+	if (linearbuffers_output_tables_get_count(output) != TABLES_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_tables_get_count\n");
+		goto bail;
+	}
+	for (i = 0; i < TABLES_COUNT; i++) {
+		a_table = linearbuffers_output_tables_get_at(output, i);
+		if (linearbuffers_a_table_uint32_get(a_table) != i) {
+			fprintf(stderr, "decoder failed: linearbuffers_a_table_uint32_get\n");
+			goto bail;
+		}
+		snprintf(string, sizeof(string), "a_table-%" PRIu64 "", i);
+		if (strcmp(linearbuffers_a_table_string_get_value(a_table), string) != 0) {
+			fprintf(stderr, "decoder failed: linearbuffers_a_table_string_get_value\n");
+			goto bail;
+		}
+	}
+	if (linearbuffers_output_uint8s_get_count(output) != UINT8S_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint8s_get_count\n");
+		goto bail;
+	}
+	if (memcmp(linearbuffers_output_uint8s_get_values(output), uint8s, UINT8S_COUNT)) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint8s_get_values\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_uninit(encoder);
+
+	encoder_create_options.arena.size = 64;
+	encoder = linearbuffers_encoder_init(encoder_buffer, sizeof(encoder_buffer), &encoder_create_options);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not init linearbuffers encoder\n");
+		goto bail;
+	}
+	rc = encode(encoder, uint8s, UINT8S_COUNT);
+	if (rc == 0) {
+		fprintf(stderr, "encoder failed: arena overflow is not detected\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_uninit(encoder);
+	encoder = NULL;
+
+	for (arena_size = 64; arena_size <= sizeof(arena_buffer); arena_size += 8) {
+		encoder_create_options.arena.size = arena_size;
+		encoder = linearbuffers_encoder_init(encoder_buffer, sizeof(encoder_buffer), &encoder_create_options);
+		if (encoder == NULL) {
+			fprintf(stderr, "can not init linearbuffers encoder\n");
+			goto bail;
+		}
+		rc = encode(encoder, uint8s, UINT8S_COUNT);
+		if (rc == 0) {
+			linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+			output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+			if (linearbuffers_output_tables_get_count(output) != TABLES_COUNT) {
+				fprintf(stderr, "decoder failed: linearbuffers_output_tables_get_count\n");
+				goto bail;
+			}
+		}
+		linearbuffers_encoder_uninit(encoder);
+		encoder = NULL;
+	}
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_uninit(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,166 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define UINT8S_COUNT	(4 * 1024 * 1024)
+#define STRINGS_COUNT	(1024)
+#define WATERMARK	(64 * 1024)
+
+struct allocator_param {
+	uint64_t length;
+	uint64_t mallocs;
+	uint64_t frees;
+};
+
+static void * allocator_malloc (void *context, uint64_t size)
+{
+	uint64_t *ptr;
+	struct allocator_param *allocator_param = context;
+	ptr = malloc(sizeof(uint64_t) * 2 + size);
+	if (ptr == NULL) {
+		return NULL;
+	}
+	ptr[0] = size;
+	allocator_param->length += size;
+	allocator_param->mallocs += 1;
+	return ptr + 2;
+}
+
+static void allocator_free (void *context, void *ptr)
+{
+	uint64_t *base;
+	struct allocator_param *allocator_param = context;
+	if (ptr == NULL) {
+		return;
+	}
+	base = ((uint64_t *) ptr) - 2;
+	allocator_param->length -= base[0];
+	allocator_param->frees += 1;
+	free(base);
+}
+
+static int encode (struct linearbuffers_encoder *encoder, const uint8_t *uint8s, uint64_t uint8s_count, uint64_t strings_count)
+{
+	int rc;
+	uint64_t i;
+	char string[32];
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_uint8s_create(encoder, uint8s, uint8s_count);
+	rc |= linearbuffers_output_strings_start(encoder);
+	for (i = 0; i < strings_count; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+		rc |= linearbuffers_output_strings_push_create(encoder, string);
+	}
+	rc |= linearbuffers_output_strings_set(encoder, linearbuffers_output_strings_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint8_t *uint8s;
+
+	struct allocator_param allocator_param;
+	struct linearbuffers_encoder *encoder;
+	struct linearbuffers_encoder_create_options encoder_create_options;
+	const struct linearbuffers_output *output;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+	uint8s = NULL;
+	memset(&allocator_param, 0, sizeof(struct allocator_param));
+
+	uint8s = malloc(UINT8S_COUNT);
+	if (uint8s == NULL) {
+		fprintf(stderr, "can not allocate memory\n");
+		goto bail;
+	}
+	memset(uint8s, 0xa5, UINT8S_COUNT);
+
+	memset(&encoder_create_options, 0, sizeof(struct linearbuffers_encoder_create_options));
+	encoder_create_options.allocator.malloc = allocator_malloc;
+	encoder_create_options.allocator.free = allocator_free;
+	encoder_create_options.allocator.context = &allocator_param;
+	encoder_create_options.memory.watermark = WATERMARK;
+
+	encoder = linearbuffers_encoder_create(&encoder_create_options);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc = encode(encoder, uint8s, UINT8S_COUNT, STRINGS_COUNT);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	fprintf(stderr, "allocated: %" PRIu64 ", mallocs: %" PRIu64 ", frees: %" PRIu64 "\n", allocator_param.length, allocator_param.mallocs, allocator_param.frees);
+	if (allocator_param.length < UINT8S_COUNT) {
+		fprintf(stderr, "encoder failed: allocator is not used\n");
+		goto bail;
+	}
+
+	rc = linearbuffers_encoder_reset(encoder, NULL);
+	if (rc != 0) {
+		fprintf(stderr, "can not reset encoder\n");
+		goto bail;
+	}
+	fprintf(stderr, "allocated: %" PRIu64 ", mallocs: %" PRIu64 ", frees: %" PRIu64 "\n", allocator_param.length, allocator_param.mallocs, allocator_param.frees);
+	if (allocator_param.length > WATERMARK + linearbuffers_encoder_sizeof()) {
+		fprintf(stderr, "encoder failed: memory is not trimmed\n");
+		goto bail;
+	}
+
+	rc = encode(encoder, uint8s, 1024, 16);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	if (linearbuffers_output_uint8s_get_count(output) != 1024) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint8s_get_count\n");
+		goto bail;
+	}
+	if (linearbuffers_output_strings_get_count(output) != 16) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_strings_get_count\n");
+		goto bail;
+	}
+	if (strcmp(linearbuffers_output_strings_get_at(output, 15), "string-15") != 0) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_strings_get_at\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+	encoder = NULL;
+	fprintf(stderr, "allocated: %" PRIu64 ", mallocs: %" PRIu64 ", frees: %" PRIu64 "\n", allocator_param.length, allocator_param.mallocs, allocator_param.frees);
+	if (allocator_param.length != 0 ||
+	    allocator_param.mallocs != allocator_param.frees) {
+		fprintf(stderr, "encoder failed: memory is leaked\n");
+		goto bail;
+	}
+
+	free(uint8s);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	if (uint8s != NULL) {
+		free(uint8s);
+	}
+	return -1;
+}
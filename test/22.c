@@ -0,0 +1,133 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define UINT8S_COUNT	(16 * 1024)
+
+static int encode (struct linearbuffers_encoder *encoder, uint32_t uint32, const uint8_t *uint8s)
+{
+	int rc;
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_uint32_set(encoder, uint32);
+	rc |= linearbuffers_output_uint8s_create(encoder, uint8s, UINT8S_COUNT);
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+static int decode (const void *buffer, uint64_t length, uint32_t uint32, const uint8_t *uint8s)
+{
+	const struct linearbuffers_output *output;
+	output = linearbuffers_output_decode(buffer, length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		return -1;
+	}
+	if (linearbuffers_output_uint32_get(output) != uint32) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint32_get\n");
+		return -1;
+	}
+	if (linearbuffers_output_uint8s_get_count(output) != UINT8S_COUNT ||
+	    memcmp(linearbuffers_output_uint8s_get_values(output), uint8s, UINT8S_COUNT)) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_uint8s_get_values\n");
+		return -1;
+	}
+	return 0;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	uint8_t uint8s[UINT8S_COUNT];
+	struct linearbuffers_encoder *encoder;
+
+	void *buffers[2];
+	uint64_t lengths[2];
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+	buffers[0] = NULL;
+	buffers[1] = NULL;
+
+	for (i = 0; i < UINT8S_COUNT; i++) {
+		uint8s[i] = i * 7;
+	}
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	for (i = 0; i < 2; i++) {
+		rc = encode(encoder, i, uint8s);
+		if (rc != 0) {
+			fprintf(stderr, "can not encode output\n");
+			goto bail;
+		}
+		rc = linearbuffers_encoder_detach(encoder, &buffers[i], &lengths[i]);
+		if (rc != 0) {
+			fprintf(stderr, "can not detach output\n");
+			goto bail;
+		}
+		fprintf(stderr, "detached: %p, length: %" PRIu64 "\n", buffers[i], lengths[i]);
+	}
+	if (buffers[0] == buffers[1]) {
+		fprintf(stderr, "encoder failed: detached buffers are shared\n");
+		goto bail;
+	}
+	if (linearbuffers_encoder_detach(encoder, &buffers[0], &lengths[0]) == 0) {
+		fprintf(stderr, "encoder failed: empty output is detached\n");
+		goto bail;
+	}
+	for (i = 0; i < 2; i++) {
+		rc = decode(buffers[i], lengths[i], i, uint8s);
+		if (rc != 0) {
+			goto bail;
+		}
+	}
+
+	rc = linearbuffers_encoder_attach(encoder, buffers[0], lengths[0]);
+	if (rc != 0) {
+		fprintf(stderr, "can not attach buffer\n");
+		goto bail;
+	}
+	rc = encode(encoder, 2, uint8s);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer != buffers[0]) {
+		fprintf(stderr, "encoder failed: attached buffer is not used\n");
+		goto bail;
+	}
+	buffers[0] = NULL;
+	rc = decode(linearized_buffer, linearized_length, 2, uint8s);
+	if (rc != 0) {
+		goto bail;
+	}
+	rc = decode(buffers[1], lengths[1], 1, uint8s);
+	if (rc != 0) {
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+	free(buffers[1]);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	if (buffers[0] != NULL) {
+		free(buffers[0]);
+	}
+	if (buffers[1] != NULL) {
+		free(buffers[1]);
+	}
+	return -1;
+}
@@ -0,0 +1,168 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define UINT32S_COUNT	(4096)
+#define ENUMS_COUNT	(16)
+#define STRINGS_COUNT	(32)
+#define TABLES_COUNT	(8)
+
+static int encode (struct linearbuffers_encoder *encoder, int reserve, uint64_t *estimate)
+{
+	int rc;
+	uint64_t i;
+	char string[32];
+	uint64_t strings_length;
+	uint64_t tables_size;
+	uint32_t uint32s[UINT32S_COUNT];
+	linearbuffers_an_enum_t enums[ENUMS_COUNT];
+
+	for (i = 0; i < UINT32S_COUNT; i++) {
+		uint32s[i] = i;
+	}
+	for (i = 0; i < ENUMS_COUNT; i++) {
+		enums[i] = (i % 2) ? linearbuffers_an_enum_b : linearbuffers_an_enum_a;
+	}
+
+	strings_length = 0;
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		strings_length += snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+	}
+	tables_size = 0;
+	for (i = 0; i < TABLES_COUNT; i++) {
+		tables_size += linearbuffers_a_table_estimate_size(snprintf(string, sizeof(string), "table-%" PRIu64 "", i));
+	}
+	*estimate = linearbuffers_output_estimate_size(strlen("string"), UINT32S_COUNT, ENUMS_COUNT, STRINGS_COUNT, strings_length, linearbuffers_a_table_estimate_size(strlen("a_table")), TABLES_COUNT, tables_size);
+
+	rc  = (reserve) ? linearbuffers_encoder_reserve(encoder, *estimate) : 0;
+	rc |= linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_uint16_set(encoder, 16);
+	rc |= linearbuffers_output_string_create(encoder, "string");
+	rc |= linearbuffers_output_uint32s_create(encoder, uint32s, UINT32S_COUNT);
+	rc |= linearbuffers_output_enums_create(encoder, enums, ENUMS_COUNT);
+	rc |= linearbuffers_output_strings_start(encoder);
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+		rc |= linearbuffers_output_strings_push_create(encoder, string);
+	}
+	rc |= linearbuffers_output_strings_set(encoder, linearbuffers_output_strings_end(encoder));
+	rc |= linearbuffers_a_table_start(encoder);
+	rc |= linearbuffers_a_table_uint32_set(encoder, 32);
+	rc |= linearbuffers_a_table_string_create(encoder, "a_table");
+	rc |= linearbuffers_output_a_table_set(encoder, linearbuffers_a_table_end(encoder));
+	rc |= linearbuffers_output_tables_start(encoder);
+	for (i = 0; i < TABLES_COUNT; i++) {
+		rc |= linearbuffers_a_table_start(encoder);
+		rc |= linearbuffers_a_table_uint32_set(encoder, i);
+		rc |= linearbuffers_a_table_string_createf(encoder, "table-%" PRIu64 "", i);
+		rc |= linearbuffers_output_tables_push(encoder, linearbuffers_a_table_end(encoder));
+	}
+	rc |= linearbuffers_output_tables_set(encoder, linearbuffers_output_tables_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t estimate;
+	struct linearbuffers_encoder *encoder;
+	struct linearbuffers_encoder_create_options encoder_create_options;
+
+	void *buffer;
+	uint64_t length;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+
+	if (linearbuffers_a_table_fixed_size() != 4 + 1 + 4 + 4) {
+		fprintf(stderr, "encoder failed: linearbuffers_a_table_fixed_size\n");
+		goto bail;
+	}
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+	rc = encode(encoder, 0, &estimate);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	if (linearbuffers_encoder_iovec(encoder, NULL, 0) <= 1) {
+		fprintf(stderr, "encoder failed: linearbuffers_encoder_iovec\n");
+		goto bail;
+	}
+	linearbuffers_encoder_destroy(encoder);
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+	rc = encode(encoder, 1, &estimate);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	if (linearbuffers_encoder_iovec(encoder, NULL, 0) != 1) {
+		fprintf(stderr, "encoder failed: linearbuffers_encoder_reserve\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 ", estimate: %" PRIu64 "\n", linearized_buffer, linearized_length, estimate);
+	if (linearized_length != estimate) {
+		fprintf(stderr, "encoder failed: linearbuffers_output_estimate_size\n");
+		goto bail;
+	}
+	if (linearbuffers_output_decode(linearized_buffer, linearized_length) == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_encoder_destroy(encoder);
+
+	memset(&encoder_create_options, 0, sizeof(struct linearbuffers_encoder_create_options));
+	encoder_create_options.memory.adaptive = 1;
+	encoder = linearbuffers_encoder_create(&encoder_create_options);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+	rc = encode(encoder, 0, &estimate);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	rc = linearbuffers_encoder_detach(encoder, &buffer, &length);
+	if (rc != 0) {
+		fprintf(stderr, "can not detach output\n");
+		goto bail;
+	}
+	free(buffer);
+	rc = encode(encoder, 0, &estimate);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	if (linearbuffers_encoder_iovec(encoder, NULL, 0) != 1) {
+		fprintf(stderr, "encoder failed: adaptive preallocation\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,188 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct emitter_param {
+	uint64_t length;
+	uint64_t size;
+	uint8_t *buffer;
+	uint8_t *writes;
+};
+
+static int emitter_function (void *context, uint64_t offset, const void *buffer, int64_t length)
+{
+	int64_t i;
+	uint8_t *tmp;
+	struct emitter_param *emitter_param = context;
+	if (length < 0) {
+		emitter_param->length = offset + length;
+		return 0;
+	}
+	if (offset + length > emitter_param->size) {
+		tmp = realloc(emitter_param->buffer, offset + length);
+		if (tmp == NULL) {
+			return -1;
+		}
+		emitter_param->buffer = tmp;
+		tmp = realloc(emitter_param->writes, offset + length);
+		if (tmp == NULL) {
+			return -1;
+		}
+		emitter_param->writes = tmp;
+		memset(emitter_param->writes + emitter_param->size, 0, offset + length - emitter_param->size);
+		emitter_param->size = offset + length;
+	}
+	if (buffer == NULL) {
+		memset(emitter_param->buffer + offset, 0, length);
+	} else {
+		memcpy(emitter_param->buffer + offset, buffer, length);
+	}
+	for (i = 0; i < length; i++) {
+		emitter_param->writes[offset + i] += 1;
+	}
+	emitter_param->length = (emitter_param->length > offset + length) ? emitter_param->length : offset + length;
+	return 0;
+}
+
+static int encode (struct linearbuffers_encoder *encoder)
+{
+	int rc;
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_small_start(encoder);
+	rc |= linearbuffers_small_uint8_set(encoder, 8);
+	rc |= linearbuffers_small_string_create(encoder, "small");
+	rc |= linearbuffers_output_small_set(encoder, linearbuffers_small_end(encoder));
+	rc |= linearbuffers_large_start(encoder);
+	rc |= linearbuffers_large_uint64_0_set(encoder, 0);
+	rc |= linearbuffers_large_uint64_1_set(encoder, 1);
+	rc |= linearbuffers_large_uint64_2_set(encoder, 2);
+	rc |= linearbuffers_large_uint64_3_set(encoder, 3);
+	rc |= linearbuffers_large_uint64_4_set(encoder, 4);
+	rc |= linearbuffers_small_start(encoder);
+	rc |= linearbuffers_small_uint8_set(encoder, 16);
+	rc |= linearbuffers_small_string_create(encoder, "large.small");
+	rc |= linearbuffers_large_small_set(encoder, linearbuffers_small_end(encoder));
+	rc |= linearbuffers_large_uint64_5_set(encoder, 5);
+	rc |= linearbuffers_large_uint64_6_set(encoder, 6);
+	rc |= linearbuffers_large_uint64_7_set(encoder, 7);
+	rc |= linearbuffers_large_uint64_8_set(encoder, 8);
+	rc |= linearbuffers_large_uint64_9_set(encoder, 9);
+	rc |= linearbuffers_large_string_create(encoder, "large");
+	rc |= linearbuffers_output_large_set(encoder, linearbuffers_large_end(encoder));
+	rc |= linearbuffers_output_string_create(encoder, "output");
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+static int decode (const uint8_t *buffer, uint64_t length)
+{
+	const struct linearbuffers_output *output;
+	const struct linearbuffers_large *large;
+
+	output = linearbuffers_output_decode(buffer, length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	if (linearbuffers_small_uint8_get(linearbuffers_output_small_get(output)) != 8 ||
+	    strcmp(linearbuffers_small_string_get_value(linearbuffers_output_small_get(output)), "small") != 0) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_small_get\n");
+		goto bail;
+	}
+	large = linearbuffers_output_large_get(output);
+	if (linearbuffers_large_uint64_0_get(large) != 0 ||
+	    linearbuffers_large_uint64_4_get(large) != 4 ||
+	    linearbuffers_large_uint64_9_get(large) != 9 ||
+	    linearbuffers_small_uint8_get(linearbuffers_large_small_get(large)) != 16 ||
+	    strcmp(linearbuffers_small_string_get_value(linearbuffers_large_small_get(large)), "large.small") != 0 ||
+	    strcmp(linearbuffers_large_string_get_value(large), "large") != 0) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_large_get\n");
+		goto bail;
+	}
+	if (strcmp(linearbuffers_output_string_get_value(output), "output") != 0) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_string_get_value\n");
+		goto bail;
+	}
+	return 0;
+bail:	return -1;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	struct emitter_param emitter_param;
+	struct linearbuffers_encoder *encoder;
+	struct linearbuffers_encoder_reset_options encoder_reset_options;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+	memset(&emitter_param, 0, sizeof(struct emitter_param));
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc = encode(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	rc = decode(linearized_buffer, linearized_length);
+	if (rc != 0) {
+		fprintf(stderr, "can not decode output\n");
+		goto bail;
+	}
+
+	memset(&encoder_reset_options, 0, sizeof(struct linearbuffers_encoder_reset_options));
+	encoder_reset_options.emitter.function = emitter_function;
+	encoder_reset_options.emitter.context = &emitter_param;
+	rc = linearbuffers_encoder_reset(encoder, &encoder_reset_options);
+	if (rc != 0) {
+		fprintf(stderr, "can not reset encoder\n");
+		goto bail;
+	}
+	rc = encode(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	if (emitter_param.length != linearized_length) {
+		fprintf(stderr, "emitter failed: length: %" PRIu64 ", expected: %" PRIu64 "\n", emitter_param.length, linearized_length);
+		goto bail;
+	}
+	for (i = 0; i < emitter_param.length; i++) {
+		if (emitter_param.writes[i] != 1) {
+			fprintf(stderr, "emitter failed: offset: %" PRIu64 " is written %d times\n", i, emitter_param.writes[i]);
+			goto bail;
+		}
+	}
+	rc = decode(emitter_param.buffer, emitter_param.length);
+	if (rc != 0) {
+		fprintf(stderr, "can not decode output\n");
+		goto bail;
+	}
+
+	free(emitter_param.buffer);
+	free(emitter_param.writes);
+	linearbuffers_encoder_destroy(encoder);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	free(emitter_param.buffer);
+	free(emitter_param.writes);
+	return -1;
+}
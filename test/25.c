@@ -0,0 +1,171 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ENTRIES_COUNT	(512)
+#define PADDING_LENGTH	(6000)
+
+struct emitter_param {
+	uint64_t length;
+	uint64_t size;
+	uint8_t *buffer;
+};
+
+static int emitter_function (void *context, uint64_t offset, const void *buffer, int64_t length)
+{
+	uint8_t *tmp;
+	struct emitter_param *emitter_param = context;
+	if (length < 0) {
+		emitter_param->length = offset + length;
+		return 0;
+	}
+	if (offset + length > emitter_param->size) {
+		tmp = realloc(emitter_param->buffer, offset + length);
+		if (tmp == NULL) {
+			return -1;
+		}
+		emitter_param->buffer = tmp;
+		emitter_param->size = offset + length;
+	}
+	if (buffer == NULL) {
+		memset(emitter_param->buffer + offset, 0, length);
+	} else {
+		memcpy(emitter_param->buffer + offset, buffer, length);
+	}
+	emitter_param->length = (emitter_param->length > offset + length) ? emitter_param->length : offset + length;
+	return 0;
+}
+
+static int encode (struct linearbuffers_encoder *encoder, const char *padding)
+{
+	int rc;
+	uint64_t i;
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_entries_start(encoder);
+	for (i = 0; i < ENTRIES_COUNT; i++) {
+		rc |= linearbuffers_entry_start(encoder);
+		rc |= linearbuffers_entry_uint32_set(encoder, i);
+		rc |= linearbuffers_entry_string_createf(encoder, "entry-%" PRIu64 "-%.*s", i, (int) ((i * 37) % PADDING_LENGTH), padding);
+		rc |= linearbuffers_output_entries_push(encoder, linearbuffers_entry_end(encoder));
+	}
+	rc |= linearbuffers_output_entries_set(encoder, linearbuffers_output_entries_end(encoder));
+	rc |= linearbuffers_output_string_createf(encoder, "output-%s", padding);
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+static int decode (const uint8_t *buffer, uint64_t length, const char *padding)
+{
+	uint64_t i;
+	char *string;
+	const struct linearbuffers_output *output;
+	const struct linearbuffers_entry *entry;
+
+	string = malloc(PADDING_LENGTH + 64);
+	if (string == NULL) {
+		fprintf(stderr, "can not allocate memory\n");
+		goto bail;
+	}
+	output = linearbuffers_output_decode(buffer, length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	if (linearbuffers_output_entries_get_count(output) != ENTRIES_COUNT) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_entries_get_count\n");
+		goto bail;
+	}
+	for (i = 0; i < ENTRIES_COUNT; i++) {
+		entry = linearbuffers_output_entries_get_at(output, i);
+		snprintf(string, PADDING_LENGTH + 64, "entry-%" PRIu64 "-%.*s", i, (int) ((i * 37) % PADDING_LENGTH), padding);
+		if (linearbuffers_entry_uint32_get(entry) != i ||
+		    strcmp(linearbuffers_entry_string_get_value(entry), string) != 0) {
+			fprintf(stderr, "decoder failed: linearbuffers_output_entries_get_at: %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+	snprintf(string, PADDING_LENGTH + 64, "output-%s", padding);
+	if (strcmp(linearbuffers_output_string_get_value(output), string) != 0) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_string_get_value\n");
+		goto bail;
+	}
+	free(string);
+	return 0;
+bail:	free(string);
+	return -1;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	char padding[PADDING_LENGTH + 1];
+	struct emitter_param emitter_param;
+	struct linearbuffers_encoder *encoder;
+	struct linearbuffers_encoder_reset_options encoder_reset_options;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+	memset(&emitter_param, 0, sizeof(struct emitter_param));
+	memset(padding, 'p', PADDING_LENGTH);
+	padding[PADDING_LENGTH] = '\0';
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc = encode(encoder, padding);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	rc = decode(linearized_buffer, linearized_length, padding);
+	if (rc != 0) {
+		fprintf(stderr, "can not decode output\n");
+		goto bail;
+	}
+
+	memset(&encoder_reset_options, 0, sizeof(struct linearbuffers_encoder_reset_options));
+	encoder_reset_options.emitter.function = emitter_function;
+	encoder_reset_options.emitter.context = &emitter_param;
+	rc = linearbuffers_encoder_reset(encoder, &encoder_reset_options);
+	if (rc != 0) {
+		fprintf(stderr, "can not reset encoder\n");
+		goto bail;
+	}
+	rc = encode(encoder, padding);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	if (emitter_param.length != linearized_length) {
+		fprintf(stderr, "emitter failed: length: %" PRIu64 ", expected: %" PRIu64 "\n", emitter_param.length, linearized_length);
+		goto bail;
+	}
+	rc = decode(emitter_param.buffer, emitter_param.length, padding);
+	if (rc != 0) {
+		fprintf(stderr, "can not decode output\n");
+		goto bail;
+	}
+
+	free(emitter_param.buffer);
+	linearbuffers_encoder_destroy(encoder);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	free(emitter_param.buffer);
+	return -1;
+}
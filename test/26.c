@@ -0,0 +1,153 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UINT32S_COUNT	(64)
+#define STRINGS_COUNT	(8)
+
+static int encode (struct linearbuffers_encoder *encoder)
+{
+	int rc;
+	uint64_t i;
+	char string[32];
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_uint32_set(encoder, 32);
+	rc |= linearbuffers_output_uint16_set(encoder, 16);
+	rc |= linearbuffers_output_string_create(encoder, "string");
+	rc |= linearbuffers_output_uint32s_start(encoder);
+	for (i = 0; i < UINT32S_COUNT; i++) {
+		rc |= linearbuffers_output_uint32s_push(encoder, i);
+	}
+	rc |= linearbuffers_output_uint32s_set(encoder, linearbuffers_output_uint32s_end(encoder));
+	rc |= linearbuffers_output_strings_start(encoder);
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+		rc |= linearbuffers_output_strings_push_create(encoder, string);
+	}
+	rc |= linearbuffers_output_strings_set(encoder, linearbuffers_output_strings_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+static int encode_unchecked (struct linearbuffers_encoder *encoder)
+{
+	int rc;
+	uint64_t i;
+	uint64_t offset;
+	char string[32];
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_encoder_table_set_uint32_unchecked(encoder, 0, 0, 32);
+	rc |= linearbuffers_encoder_table_set_uint16_unchecked(encoder, 1, 4, 16);
+	rc |= linearbuffers_encoder_string_create(encoder, &offset, "string");
+	rc |= linearbuffers_encoder_table_set_string_unchecked(encoder, 2, 6, offset);
+	rc |= linearbuffers_output_uint32s_start(encoder);
+	for (i = 0; i < UINT32S_COUNT; i++) {
+		rc |= linearbuffers_encoder_vector_push_uint32_unchecked(encoder, i);
+	}
+	rc |= linearbuffers_encoder_vector_end_uint32(encoder, &offset);
+	rc |= linearbuffers_encoder_table_set_vector_unchecked(encoder, 3, 10, offset);
+	rc |= linearbuffers_output_strings_start(encoder);
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+		rc |= linearbuffers_encoder_string_create(encoder, &offset, string);
+		rc |= linearbuffers_encoder_vector_push_string_unchecked(encoder, offset);
+	}
+	rc |= linearbuffers_encoder_vector_end_string(encoder, &offset);
+	rc |= linearbuffers_encoder_table_set_vector_unchecked(encoder, 4, 14, offset);
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint8_t *checked;
+	struct linearbuffers_encoder *encoder;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	uint64_t checked_length;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = NULL;
+	checked = NULL;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc = encode(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	checked = malloc(linearized_length);
+	if (checked == NULL) {
+		fprintf(stderr, "can not allocate memory\n");
+		goto bail;
+	}
+	memcpy(checked, linearized_buffer, linearized_length);
+	checked_length = linearized_length;
+
+	rc = linearbuffers_encoder_reset(encoder, NULL);
+	if (rc != 0) {
+		fprintf(stderr, "can not reset encoder\n");
+		goto bail;
+	}
+	rc = encode_unchecked(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	if (linearized_length != checked_length ||
+	    memcmp(linearized_buffer, checked, checked_length) != 0) {
+		fprintf(stderr, "encoder failed: unchecked output differs\n");
+		goto bail;
+	}
+	if (linearbuffers_output_decode(linearized_buffer, linearized_length) == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+
+	rc  = linearbuffers_encoder_reset(encoder, NULL);
+	rc |= linearbuffers_output_start(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not start output\n");
+		goto bail;
+	}
+	rc = linearbuffers_encoder_table_set_uint64(encoder, 0, 12, 64);
+	if (rc == 0) {
+		fprintf(stderr, "encoder failed: out of table offset is accepted\n");
+		goto bail;
+	}
+	rc = linearbuffers_encoder_table_set_uint32(encoder, 5, 0, 32);
+	if (rc == 0) {
+		fprintf(stderr, "encoder failed: out of table element is accepted\n");
+		goto bail;
+	}
+
+	free(checked);
+	linearbuffers_encoder_destroy(encoder);
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	free(checked);
+	return -1;
+}
@@ -0,0 +1,212 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SMALLS_COUNT	(16)
+#define STRINGS_COUNT	(32)
+#define LONG_LENGTH	(300)
+#define VALUES_COUNT	(8)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	uint64_t j;
+	uint64_t compact_length;
+	const char *name;
+	char string[32];
+	char long_string[LONG_LENGTH + 1];
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+	const struct linearbuffers_small *small;
+	const struct linearbuffers_medium *medium;
+	const struct linearbuffers_compact *compact;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_small_start(encoder);
+	rc |= linearbuffers_small_uint8_set(encoder, 8);
+	rc |= linearbuffers_small_name_create(encoder, "name");
+	rc |= linearbuffers_small_value_create(encoder, "value");
+	rc |= linearbuffers_output_small_set(encoder, linearbuffers_small_end(encoder));
+	rc |= linearbuffers_medium_start(encoder);
+	rc |= linearbuffers_medium_uint32_set(encoder, 32);
+	rc |= linearbuffers_medium_strings_start(encoder);
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+		rc |= linearbuffers_medium_strings_push_create(encoder, string);
+	}
+	rc |= linearbuffers_medium_strings_set(encoder, linearbuffers_medium_strings_end(encoder));
+	rc |= linearbuffers_output_medium_set(encoder, linearbuffers_medium_end(encoder));
+	rc |= linearbuffers_output_smalls_start(encoder);
+	for (i = 0; i < SMALLS_COUNT; i++) {
+		snprintf(string, sizeof(string), "name-%" PRIu64 "", i);
+		rc |= linearbuffers_small_start(encoder);
+		rc |= linearbuffers_small_uint8_set(encoder, i);
+		rc |= linearbuffers_small_name_create(encoder, string);
+		rc |= linearbuffers_output_smalls_push(encoder, linearbuffers_small_end(encoder));
+	}
+	rc |= linearbuffers_output_smalls_set(encoder, linearbuffers_output_smalls_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	small = linearbuffers_output_small_get(output);
+	if (linearbuffers_small_uint8_get(small) != 8 ||
+	    strcmp(linearbuffers_small_name_get_value(small), "name") != 0 ||
+	    strcmp(linearbuffers_small_value_get_value(small), "value") != 0) {
+		fprintf(stderr, "decoder failed: small\n");
+		goto bail;
+	}
+	medium = linearbuffers_output_medium_get(output);
+	if (linearbuffers_medium_uint32_get(medium) != 32 ||
+	    linearbuffers_medium_strings_get_count(medium) != STRINGS_COUNT) {
+		fprintf(stderr, "decoder failed: medium\n");
+		goto bail;
+	}
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+		if (strcmp(linearbuffers_medium_strings_get_at(medium, i), string) != 0) {
+			fprintf(stderr, "decoder failed: medium strings\n");
+			goto bail;
+		}
+	}
+	if (linearbuffers_output_smalls_get_count(output) != SMALLS_COUNT) {
+		fprintf(stderr, "decoder failed: smalls\n");
+		goto bail;
+	}
+	for (i = 0; i < SMALLS_COUNT; i++) {
+		snprintf(string, sizeof(string), "name-%" PRIu64 "", i);
+		small = linearbuffers_output_smalls_get_at(output, i);
+		if (linearbuffers_small_uint8_get(small) != i ||
+		    strcmp(linearbuffers_small_name_get_value(small), string) != 0 ||
+		    linearbuffers_small_value_present(small)) {
+			fprintf(stderr, "decoder failed: smalls\n");
+			goto bail;
+		}
+	}
+
+	memset(long_string, 'x', LONG_LENGTH);
+	long_string[LONG_LENGTH] = '\0';
+
+	rc  = linearbuffers_encoder_reset(encoder, NULL);
+	rc |= linearbuffers_output_start(encoder);
+	rc |= linearbuffers_small_start(encoder);
+	rc |= linearbuffers_small_name_create(encoder, long_string);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+	rc = linearbuffers_small_value_create(encoder, "value");
+	if (rc == 0) {
+		fprintf(stderr, "encoder failed: offset overflow is accepted\n");
+		goto bail;
+	}
+
+	compact_length = 0;
+	for (j = 0; j < 2; j++) {
+		name = (j == 0) ? "name" : long_string;
+		rc  = linearbuffers_encoder_reset(encoder, NULL);
+		rc |= linearbuffers_output_start(encoder);
+		rc |= linearbuffers_compact_start(encoder);
+		rc |= linearbuffers_compact_uint8_set(encoder, 8);
+		rc |= linearbuffers_compact_name_create(encoder, name);
+		rc |= linearbuffers_compact_values_start(encoder);
+		for (i = 0; i < VALUES_COUNT; i++) {
+			rc |= linearbuffers_compact_values_push(encoder, i * 1000);
+		}
+		rc |= linearbuffers_compact_values_set(encoder, linearbuffers_compact_values_end(encoder));
+		rc |= linearbuffers_output_compact_set(encoder, linearbuffers_compact_end(encoder));
+		rc |= linearbuffers_output_finish(encoder);
+		if (rc != 0) {
+			fprintf(stderr, "can not encode compact output\n");
+			goto bail;
+		}
+		linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+		if (linearized_buffer == NULL) {
+			fprintf(stderr, "can not get linearized buffer\n");
+			goto bail;
+		}
+		if (j == 0) {
+			compact_length = linearized_length;
+		}
+		output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+		compact = linearbuffers_output_compact_get(output);
+		if (linearbuffers_compact_uint8_get(compact) != 8 ||
+		    strcmp(linearbuffers_compact_name_get_value(compact), name) != 0 ||
+		    linearbuffers_compact_values_get_count(compact) != VALUES_COUNT) {
+			fprintf(stderr, "decoder failed: compact\n");
+			goto bail;
+		}
+		for (i = 0; i < VALUES_COUNT; i++) {
+			if (linearbuffers_compact_values_get_at(compact, i) != i * 1000) {
+				fprintf(stderr, "decoder failed: compact values\n");
+				goto bail;
+			}
+		}
+	}
+
+	rc  = linearbuffers_encoder_reset(encoder, NULL);
+	rc |= linearbuffers_output_start(encoder);
+	rc |= linearbuffers_wide_start(encoder);
+	rc |= linearbuffers_wide_uint8_set(encoder, 8);
+	rc |= linearbuffers_wide_name_create(encoder, "name");
+	rc |= linearbuffers_wide_values_start(encoder);
+	for (i = 0; i < VALUES_COUNT; i++) {
+		rc |= linearbuffers_wide_values_push(encoder, i * 1000);
+	}
+	rc |= linearbuffers_wide_values_set(encoder, linearbuffers_wide_values_end(encoder));
+	rc |= linearbuffers_output_wide_set(encoder, linearbuffers_wide_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode wide output\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "compact length: %" PRIu64 ", wide length: %" PRIu64 "\n", compact_length, linearized_length);
+	if (compact_length >= linearized_length) {
+		fprintf(stderr, "encoder failed: promoted offsets are not narrowed\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,178 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VALUES_COUNT	(17)
+#define STRINGS_COUNT	(5)
+#define SMALLS_COUNT	(3)
+
+#define IS_ALIGNED(base, ptr, size)	((((const uint8_t *) (ptr)) - ((const uint8_t *) (base))) % (size) == 0)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	char string[32];
+	uint32_t uint32s[VALUES_COUNT];
+	uint64_t *uint64s;
+	const struct linearbuffers_uint16_vector *uint16_vector;
+	const struct linearbuffers_uint32_vector *uint32_vector;
+	const struct linearbuffers_uint64_vector *uint64_vector;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+	const struct linearbuffers_small *small;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	for (i = 0; i < VALUES_COUNT; i++) {
+		uint32s[i] = i * 32;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_uint8_set(encoder, 8);
+	rc |= linearbuffers_output_uint16_set(encoder, 16);
+	rc |= linearbuffers_output_uint32_set(encoder, 32);
+	rc |= linearbuffers_output_uint64_set(encoder, 64);
+	rc |= linearbuffers_output_double_set(encoder, 0.5);
+	rc |= linearbuffers_output_string_create(encoder, "abc");
+	rc |= linearbuffers_output_uint16s_start(encoder);
+	for (i = 0; i < VALUES_COUNT; i++) {
+		rc |= linearbuffers_output_uint16s_push(encoder, i * 16);
+	}
+	rc |= linearbuffers_output_uint16s_set(encoder, linearbuffers_output_uint16s_end(encoder));
+	rc |= linearbuffers_output_uint32s_set(encoder, linearbuffers_uint32_vector_create(encoder, uint32s, VALUES_COUNT));
+	rc |= linearbuffers_uint64_vector_reserve(encoder, VALUES_COUNT, &uint64s);
+	if (rc == 0) {
+		for (i = 0; i < VALUES_COUNT; i++) {
+			uint64s[i] = i * 64;
+		}
+		rc |= linearbuffers_output_uint64s_set(encoder, linearbuffers_uint64_vector_commit(encoder, VALUES_COUNT));
+	}
+	rc |= linearbuffers_output_doubles_start(encoder);
+	for (i = 0; i < VALUES_COUNT; i++) {
+		rc |= linearbuffers_output_doubles_push(encoder, i * 0.5);
+	}
+	rc |= linearbuffers_output_doubles_set(encoder, linearbuffers_output_doubles_end(encoder));
+	rc |= linearbuffers_output_strings_start(encoder);
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+		rc |= linearbuffers_output_strings_push_create(encoder, string);
+	}
+	rc |= linearbuffers_output_strings_set(encoder, linearbuffers_output_strings_end(encoder));
+	rc |= linearbuffers_small_start(encoder);
+	rc |= linearbuffers_small_uint8_set(encoder, 1);
+	rc |= linearbuffers_small_uint64_set(encoder, 2);
+	rc |= linearbuffers_small_name_create(encoder, "small");
+	rc |= linearbuffers_output_small_set(encoder, linearbuffers_small_end(encoder));
+	rc |= linearbuffers_output_smalls_start(encoder);
+	for (i = 0; i < SMALLS_COUNT; i++) {
+		snprintf(string, sizeof(string), "small-%" PRIu64 "", i);
+		rc |= linearbuffers_small_start(encoder);
+		rc |= linearbuffers_small_uint8_set(encoder, i);
+		rc |= linearbuffers_small_uint64_set(encoder, i * 64);
+		rc |= linearbuffers_small_name_create(encoder, string);
+		rc |= linearbuffers_output_smalls_push(encoder, linearbuffers_small_end(encoder));
+	}
+	rc |= linearbuffers_output_smalls_set(encoder, linearbuffers_output_smalls_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (linearbuffers_output_uint8_get(output) != 8 ||
+	    linearbuffers_output_uint16_get(output) != 16 ||
+	    linearbuffers_output_uint32_get(output) != 32 ||
+	    linearbuffers_output_uint64_get(output) != 64 ||
+	    linearbuffers_output_double_get(output) != 0.5 ||
+	    strcmp(linearbuffers_output_string_get_value(output), "abc") != 0) {
+		fprintf(stderr, "decoder failed: scalars\n");
+		goto bail;
+	}
+
+	uint16_vector = linearbuffers_output_uint16s_get(output);
+	uint32_vector = linearbuffers_output_uint32s_get(output);
+	uint64_vector = linearbuffers_output_uint64s_get(output);
+	if (!IS_ALIGNED(linearized_buffer, linearbuffers_uint16_vector_get_values(uint16_vector), sizeof(uint16_t)) ||
+	    !IS_ALIGNED(linearized_buffer, linearbuffers_uint32_vector_get_values(uint32_vector), sizeof(uint32_t)) ||
+	    !IS_ALIGNED(linearized_buffer, linearbuffers_uint64_vector_get_values(uint64_vector), sizeof(uint64_t)) ||
+	    !IS_ALIGNED(linearized_buffer, linearbuffers_output_doubles_get_values(output), sizeof(double))) {
+		fprintf(stderr, "decoder failed: vector values are not aligned\n");
+		goto bail;
+	}
+	for (i = 0; i < VALUES_COUNT; i++) {
+		if (linearbuffers_uint16_vector_get_at(uint16_vector, i) != i * 16 ||
+		    linearbuffers_uint32_vector_get_at(uint32_vector, i) != i * 32 ||
+		    linearbuffers_uint64_vector_get_at(uint64_vector, i) != i * 64 ||
+		    linearbuffers_output_doubles_get_values(output)[i] != i * 0.5) {
+			fprintf(stderr, "decoder failed: vector values\n");
+			goto bail;
+		}
+	}
+
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i);
+		if (strcmp(linearbuffers_string_vector_get_at(linearbuffers_output_strings_get(output), i), string) != 0) {
+			fprintf(stderr, "decoder failed: strings\n");
+			goto bail;
+		}
+	}
+
+	small = linearbuffers_output_small_get(output);
+	if (!IS_ALIGNED(linearized_buffer, small, sizeof(uint64_t)) ||
+	    linearbuffers_small_uint8_get(small) != 1 ||
+	    linearbuffers_small_uint64_get(small) != 2 ||
+	    strcmp(linearbuffers_small_name_get_value(small), "small") != 0) {
+		fprintf(stderr, "decoder failed: small\n");
+		goto bail;
+	}
+	if (linearbuffers_output_smalls_get_count(output) != SMALLS_COUNT) {
+		fprintf(stderr, "decoder failed: smalls\n");
+		goto bail;
+	}
+	for (i = 0; i < SMALLS_COUNT; i++) {
+		snprintf(string, sizeof(string), "small-%" PRIu64 "", i);
+		small = linearbuffers_output_smalls_get_at(output, i);
+		if (!IS_ALIGNED(linearized_buffer, small, sizeof(uint64_t)) ||
+		    linearbuffers_small_uint8_get(small) != i ||
+		    linearbuffers_small_uint64_get(small) != i * 64 ||
+		    strcmp(linearbuffers_small_name_get_value(small), string) != 0) {
+			fprintf(stderr, "decoder failed: smalls\n");
+			goto bail;
+		}
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
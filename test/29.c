@@ -0,0 +1,135 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STRINGS_COUNT	(5)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	uint64_t length;
+	char *reserve;
+	char string[32];
+	const char *value;
+	const char *names[STRINGS_COUNT];
+	uint64_t lengths[STRINGS_COUNT];
+	static const char binary[] = { 'a', '\0', 'b', '\0', 'c' };
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	names[0] = "";
+	lengths[0] = 0;
+	for (i = 1; i < STRINGS_COUNT; i++) {
+		names[i] = binary;
+		lengths[i] = i;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_string_create(encoder, "abc");
+	rc |= linearbuffers_output_binary_ncreate(encoder, sizeof(binary), binary);
+	rc |= linearbuffers_output_format_createf(encoder, "format-%d", 1234);
+	rc |= linearbuffers_string_reserve(encoder, 7, &reserve);
+	if (rc == 0) {
+		memcpy(reserve, "reserve", 7);
+		rc |= linearbuffers_output_reserve_set(encoder, linearbuffers_string_commit(encoder, 7));
+	}
+	rc |= linearbuffers_output_empty_create(encoder, "");
+	rc |= linearbuffers_output_strings_start(encoder);
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i * 100);
+		rc |= linearbuffers_output_strings_push_create(encoder, string);
+	}
+	rc |= linearbuffers_output_strings_set(encoder, linearbuffers_output_strings_end(encoder));
+	rc |= linearbuffers_output_names_ncreate(encoder, names, lengths, STRINGS_COUNT);
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (linearbuffers_output_string_get_length(output) != 3 ||
+	    strcmp(linearbuffers_output_string_get_value(output), "abc") != 0) {
+		fprintf(stderr, "decoder failed: string\n");
+		goto bail;
+	}
+	value = linearbuffers_output_binary_get_nvalue(output, &length);
+	if (length != sizeof(binary) ||
+	    memcmp(value, binary, sizeof(binary)) != 0 ||
+	    value[length] != '\0') {
+		fprintf(stderr, "decoder failed: binary\n");
+		goto bail;
+	}
+	if (linearbuffers_output_format_get_length(output) != strlen("format-1234") ||
+	    strcmp(linearbuffers_output_format_get_value(output), "format-1234") != 0) {
+		fprintf(stderr, "decoder failed: format\n");
+		goto bail;
+	}
+	if (linearbuffers_output_reserve_get_length(output) != 7 ||
+	    strcmp(linearbuffers_output_reserve_get_value(output), "reserve") != 0) {
+		fprintf(stderr, "decoder failed: reserve\n");
+		goto bail;
+	}
+	if (linearbuffers_output_empty_get_length(output) != 0 ||
+	    strcmp(linearbuffers_output_empty_get_value(output), "") != 0) {
+		fprintf(stderr, "decoder failed: empty\n");
+		goto bail;
+	}
+	if (linearbuffers_output_missing_get_length(output) != 0 ||
+	    linearbuffers_output_missing_get_value(output) != NULL) {
+		fprintf(stderr, "decoder failed: missing\n");
+		goto bail;
+	}
+
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		snprintf(string, sizeof(string), "string-%" PRIu64 "", i * 100);
+		if (linearbuffers_output_strings_get_length_at(output, i) != strlen(string) ||
+		    strcmp(linearbuffers_output_strings_get_at(output, i), string) != 0) {
+			fprintf(stderr, "decoder failed: strings\n");
+			goto bail;
+		}
+	}
+	for (i = 0; i < STRINGS_COUNT; i++) {
+		if (linearbuffers_output_names_get_length_at(output, i) != lengths[i] ||
+		    memcmp(linearbuffers_output_names_get_at(output, i), names[i], lengths[i]) != 0) {
+			fprintf(stderr, "decoder failed: names\n");
+			goto bail;
+		}
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
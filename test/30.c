@@ -0,0 +1,249 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BLOB_LENGTH	(13)
+#define PAGE_LENGTH	(8192)
+#define BLOCKS_COUNT	(3)
+
+#define IS_ALIGNED(ptr, size)	(((uintptr_t) (ptr)) % (size) == 0)
+
+static uint8_t output_buffer[PAGE_LENGTH * 2 + 4096] __attribute__ ((aligned(4096)));
+
+static void * allocator_malloc (void *context, uint64_t size)
+{
+	(void) context;
+	return malloc(size);
+}
+
+static void allocator_free (void *context, void *ptr)
+{
+	(void) context;
+	if ((uint8_t *) ptr >= output_buffer &&
+	    (uint8_t *) ptr < output_buffer + sizeof(output_buffer)) {
+		return;
+	}
+	free(ptr);
+}
+
+static int encode_page (struct linearbuffers_encoder *encoder, uint8_t **page)
+{
+	int rc;
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_page_reserve(encoder, PAGE_LENGTH, (void **) page);
+	if (rc == 0) {
+		memset(*page, 0x5a, PAGE_LENGTH);
+		rc |= linearbuffers_output_page_commit(encoder, PAGE_LENGTH);
+	}
+	rc |= linearbuffers_output_finish(encoder);
+	return rc;
+}
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	uint64_t j;
+	uint8_t blob[BLOB_LENGTH];
+	uint8_t *page;
+	void *detached;
+	const uint8_t *value;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	struct linearbuffers_encoder_create_options encoder_create_options;
+	const struct linearbuffers_output *output;
+	const struct linearbuffers_block *block;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	for (i = 0; i < BLOB_LENGTH; i++) {
+		blob[i] = i;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_uint8_set(encoder, 8);
+	rc |= linearbuffers_output_blob_create(encoder, blob, BLOB_LENGTH);
+	rc |= linearbuffers_output_page_reserve(encoder, PAGE_LENGTH, (void **) &page);
+	if (rc == 0) {
+		for (i = 0; i < PAGE_LENGTH; i++) {
+			page[i] = i * 3;
+		}
+		rc |= linearbuffers_output_page_commit(encoder, PAGE_LENGTH);
+	}
+	rc |= linearbuffers_output_empty_create(encoder, NULL, 0);
+	rc |= linearbuffers_block_start(encoder);
+	rc |= linearbuffers_block_id_set(encoder, 1);
+	rc |= linearbuffers_block_data_create(encoder, blob, 1);
+	rc |= linearbuffers_output_block_set(encoder, linearbuffers_block_end(encoder));
+	rc |= linearbuffers_output_blocks_start(encoder);
+	for (i = 0; i < BLOCKS_COUNT; i++) {
+		rc |= linearbuffers_block_start(encoder);
+		rc |= linearbuffers_block_id_set(encoder, i);
+		rc |= linearbuffers_block_data_set(encoder, linearbuffers_bytes_create(encoder, 16, blob, i + 1));
+		rc |= linearbuffers_output_blocks_push(encoder, linearbuffers_block_end(encoder));
+	}
+	rc |= linearbuffers_output_blocks_set(encoder, linearbuffers_output_blocks_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (linearbuffers_output_uint8_get(output) != 8) {
+		fprintf(stderr, "decoder failed: uint8\n");
+		goto bail;
+	}
+	value = linearbuffers_output_blob_get_value(output);
+	if (linearbuffers_output_blob_get_length(output) != BLOB_LENGTH ||
+	    !IS_ALIGNED(value, 8) ||
+	    memcmp(value, blob, BLOB_LENGTH) != 0) {
+		fprintf(stderr, "decoder failed: blob\n");
+		goto bail;
+	}
+	value = linearbuffers_output_page_get_value(output);
+	if (linearbuffers_output_page_get_length(output) != PAGE_LENGTH ||
+	    !IS_ALIGNED(value, 4096)) {
+		fprintf(stderr, "decoder failed: page\n");
+		goto bail;
+	}
+	for (i = 0; i < PAGE_LENGTH; i++) {
+		if (value[i] != (uint8_t) (i * 3)) {
+			fprintf(stderr, "decoder failed: page\n");
+			goto bail;
+		}
+	}
+	if (!linearbuffers_output_empty_present(output) ||
+	    linearbuffers_output_empty_get_length(output) != 0) {
+		fprintf(stderr, "decoder failed: empty\n");
+		goto bail;
+	}
+	if (linearbuffers_output_absent_present(output) ||
+	    linearbuffers_output_absent_get_length(output) != 0 ||
+	    linearbuffers_output_absent_get_value(output) != NULL) {
+		fprintf(stderr, "decoder failed: absent\n");
+		goto bail;
+	}
+
+	block = linearbuffers_output_block_get(output);
+	if (linearbuffers_block_id_get(block) != 1 ||
+	    linearbuffers_block_data_get_length(block) != 1 ||
+	    !IS_ALIGNED(linearbuffers_block_data_get_value(block), 16) ||
+	    memcmp(linearbuffers_block_data_get_value(block), blob, 1) != 0) {
+		fprintf(stderr, "decoder failed: block\n");
+		goto bail;
+	}
+	for (i = 0; i < BLOCKS_COUNT; i++) {
+		block = linearbuffers_output_blocks_get_at(output, i);
+		value = linearbuffers_block_data_get_value(block);
+		if (linearbuffers_block_id_get(block) != i ||
+		    linearbuffers_block_data_get_length(block) != i + 1 ||
+		    !IS_ALIGNED(value, 16)) {
+			fprintf(stderr, "decoder failed: blocks\n");
+			goto bail;
+		}
+		for (j = 0; j <= i; j++) {
+			if (value[j] != blob[j]) {
+				fprintf(stderr, "decoder failed: blocks\n");
+				goto bail;
+			}
+		}
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	memset(&encoder_create_options, 0, sizeof(struct linearbuffers_encoder_create_options));
+	encoder_create_options.allocator.malloc = allocator_malloc;
+	encoder_create_options.allocator.free = allocator_free;
+	encoder = linearbuffers_encoder_create(&encoder_create_options);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+	rc = encode_page(encoder, &page);
+	if (rc != 0 ||
+	    !IS_ALIGNED(page, 4096)) {
+		fprintf(stderr, "encoder failed: page is not aligned without aligned_malloc\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL ||
+	    !IS_ALIGNED(linearbuffers_output_page_get_value(output), 4096)) {
+		fprintf(stderr, "decoder failed: page is not aligned without aligned_malloc\n");
+		goto bail;
+	}
+	rc = linearbuffers_encoder_detach(encoder, &detached, &linearized_length);
+	if (rc != 0) {
+		fprintf(stderr, "can not detach output\n");
+		goto bail;
+	}
+	output = linearbuffers_output_decode(detached, linearized_length);
+	if (output == NULL ||
+	    linearbuffers_output_page_get_length(output) != PAGE_LENGTH ||
+	    ((const uint8_t *) linearbuffers_output_page_get_value(output))[PAGE_LENGTH - 1] != 0x5a) {
+		fprintf(stderr, "decoder failed: detached page\n");
+		free(detached);
+		goto bail;
+	}
+	free(detached);
+	rc = linearbuffers_encoder_attach(encoder, output_buffer + 8, sizeof(output_buffer) - 8);
+	if (rc != 0) {
+		fprintf(stderr, "can not attach buffer\n");
+		goto bail;
+	}
+	rc = encode_page(encoder, &page);
+	if (rc == 0) {
+		fprintf(stderr, "encoder failed: misaligned attached buffer is not detected\n");
+		goto bail;
+	}
+	linearbuffers_encoder_destroy(encoder);
+
+	for (i = 0; i < 2; i++) {
+		memset(&encoder_create_options, 0, sizeof(struct linearbuffers_encoder_create_options));
+		encoder_create_options.output.buffer = output_buffer + i * 8;
+		encoder_create_options.output.size = sizeof(output_buffer) - i * 8;
+		encoder = linearbuffers_encoder_create(&encoder_create_options);
+		if (encoder == NULL) {
+			fprintf(stderr, "can not create linearbuffers encoder\n");
+			goto bail;
+		}
+		rc = encode_page(encoder, &page);
+		if ((i == 0 && (rc != 0 || !IS_ALIGNED(page, 4096))) ||
+		    (i == 1 && rc == 0)) {
+			fprintf(stderr, "encoder failed: fixed output at %" PRIu64 "\n", i * 8);
+			goto bail;
+		}
+		linearbuffers_encoder_destroy(encoder);
+	}
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
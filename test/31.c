@@ -0,0 +1,122 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	struct linearbuffers_vec3 origin;
+	struct linearbuffers_sample sample;
+	const struct linearbuffers_sample *dsample;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	if (sizeof(struct linearbuffers_vec3) != 12 ||
+	    sizeof(struct linearbuffers_sample) != 48 ||
+	    offsetof(struct linearbuffers_sample, stamp) != 8 ||
+	    offsetof(struct linearbuffers_sample, position) != 16 ||
+	    offsetof(struct linearbuffers_sample, weight) != 32 ||
+	    offsetof(struct linearbuffers_sample, level) != 40) {
+		fprintf(stderr, "struct layout is invalid\n");
+		return -1;
+	}
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	memset(&sample, 0, sizeof(sample));
+	sample.kind       = linearbuffers_kind_polygon;
+	sample.flags      = 0xbeef;
+	sample.stamp      = UINT64_C(1234567890123);
+	sample.position.x = 1.5;
+	sample.position.y = -2.5;
+	sample.position.z = 3.25;
+	sample.weight     = 0.125;
+	sample.level      = -7;
+
+	origin.x = 0;
+	origin.y = 1;
+	origin.z = 2;
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_id_set(encoder, 42);
+	rc |= linearbuffers_output_sample_set(encoder, &sample);
+	rc |= linearbuffers_output_origin_set(encoder, &origin);
+	rc |= linearbuffers_output_name_create(encoder, "structs");
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (linearbuffers_output_id_get(output) != 42) {
+		fprintf(stderr, "decoder failed: id\n");
+		goto bail;
+	}
+	dsample = linearbuffers_output_sample_get(output);
+	if (dsample == NULL ||
+	    memcmp(dsample, &sample, sizeof(sample)) != 0) {
+		fprintf(stderr, "decoder failed: sample\n");
+		goto bail;
+	}
+	if (((uintptr_t) dsample - (uintptr_t) linearized_buffer) % 8 != 0) {
+		fprintf(stderr, "decoder failed: sample is not aligned\n");
+		goto bail;
+	}
+	if (linearbuffers_sample_kind_get(dsample) != linearbuffers_kind_polygon ||
+	    linearbuffers_sample_flags_get(dsample) != 0xbeef ||
+	    linearbuffers_sample_stamp_get(dsample) != UINT64_C(1234567890123) ||
+	    linearbuffers_vec3_y_get(linearbuffers_sample_position_get(dsample)) != -2.5 ||
+	    linearbuffers_sample_weight_get(dsample) != 0.125 ||
+	    linearbuffers_sample_level_get(dsample) != -7) {
+		fprintf(stderr, "decoder failed: sample fields\n");
+		goto bail;
+	}
+	if (linearbuffers_vec3_z_get(linearbuffers_output_origin_get(output)) != 2) {
+		fprintf(stderr, "decoder failed: origin\n");
+		goto bail;
+	}
+	if (linearbuffers_output_absent_present(output) ||
+	    linearbuffers_output_absent_get(output) != NULL ||
+	    linearbuffers_sample_stamp_get(linearbuffers_output_absent_get(output)) != 0) {
+		fprintf(stderr, "decoder failed: absent\n");
+		goto bail;
+	}
+	if (strcmp(linearbuffers_output_name_get_value(output), "structs") != 0) {
+		fprintf(stderr, "decoder failed: name\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,126 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define POINTS_COUNT	(7)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	struct linearbuffers_point *reserve;
+	struct linearbuffers_point points[POINTS_COUNT];
+	const struct linearbuffers_point *values;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	if (sizeof(struct linearbuffers_point) != 24) {
+		fprintf(stderr, "struct layout is invalid\n");
+		return -1;
+	}
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	memset(points, 0, sizeof(points));
+	for (i = 0; i < POINTS_COUNT; i++) {
+		points[i].stamp = UINT64_C(1000000000000) + i;
+		points[i].x     = i * 0.5;
+		points[i].y     = i * -0.25;
+		points[i].id    = i + 100;
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_id_set(encoder, 1);
+	rc |= linearbuffers_output_points_create(encoder, points, POINTS_COUNT);
+	rc |= linearbuffers_output_reserve_reserve(encoder, POINTS_COUNT, &reserve);
+	if (rc == 0) {
+		for (i = 0; i < POINTS_COUNT; i++) {
+			reserve[i] = points[POINTS_COUNT - 1 - i];
+		}
+		rc |= linearbuffers_output_reserve_commit(encoder, POINTS_COUNT);
+	}
+	rc |= linearbuffers_output_empty_create(encoder, NULL, 0);
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	values = linearbuffers_output_points_get_values(output);
+	if (linearbuffers_output_points_get_count(output) != POINTS_COUNT ||
+	    linearbuffers_output_points_get_length(output) != sizeof(points) ||
+	    values == NULL ||
+	    memcmp(values, points, sizeof(points)) != 0) {
+		fprintf(stderr, "decoder failed: points\n");
+		goto bail;
+	}
+	if (((uintptr_t) values) % 8 != 0) {
+		fprintf(stderr, "decoder failed: points alignment\n");
+		goto bail;
+	}
+	for (i = 0; i < POINTS_COUNT; i++) {
+		if (linearbuffers_output_points_get_at(output, i) != &values[i] ||
+		    values[i].stamp != points[i].stamp ||
+		    values[i].id != points[i].id) {
+			fprintf(stderr, "decoder failed: points at\n");
+			goto bail;
+		}
+	}
+	values = linearbuffers_output_reserve_get_values(output);
+	if (linearbuffers_output_reserve_get_count(output) != POINTS_COUNT ||
+	    values == NULL) {
+		fprintf(stderr, "decoder failed: reserve\n");
+		goto bail;
+	}
+	for (i = 0; i < POINTS_COUNT; i++) {
+		if (memcmp(&values[i], &points[POINTS_COUNT - 1 - i], sizeof(points[0])) != 0) {
+			fprintf(stderr, "decoder failed: reserve at\n");
+			goto bail;
+		}
+	}
+	if (!linearbuffers_output_empty_present(output) ||
+	    linearbuffers_output_empty_get_count(output) != 0) {
+		fprintf(stderr, "decoder failed: empty\n");
+		goto bail;
+	}
+	if (linearbuffers_output_missing_present(output) ||
+	    linearbuffers_output_missing_get_count(output) != 0 ||
+	    linearbuffers_output_missing_get_values(output) != NULL) {
+		fprintf(stderr, "decoder failed: missing\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,149 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VALUES_COUNT	(5)
+#define CHILDREN_COUNT	(3)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	uint32_t values[VALUES_COUNT];
+	struct linearbuffers_point point;
+	const struct linearbuffers_point *dpoint;
+	const struct linearbuffers_child *child;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	for (i = 0; i < VALUES_COUNT; i++) {
+		values[i] = i * 1000;
+	}
+	point.x = -3;
+	point.y = 4;
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_f01_set(encoder, UINT64_C(0x0102030405060708));
+	rc |= linearbuffers_output_f02_set(encoder, -2);
+	rc |= linearbuffers_output_name_create(encoder, "sparse");
+	rc |= linearbuffers_output_color_set(encoder, linearbuffers_color_green);
+	rc |= linearbuffers_output_point_set(encoder, &point);
+	rc |= linearbuffers_output_values_create(encoder, values, VALUES_COUNT);
+	rc |= linearbuffers_output_f63_set(encoder, 0x63);
+	rc |= linearbuffers_child_start(encoder);
+	rc |= linearbuffers_child_id_set(encoder, 64);
+	rc |= linearbuffers_child_limit_set(encoder, 7);
+	rc |= linearbuffers_output_child_set(encoder, linearbuffers_child_end(encoder));
+	rc |= linearbuffers_output_children_start(encoder);
+	for (i = 0; i < CHILDREN_COUNT; i++) {
+		rc |= linearbuffers_child_start(encoder);
+		rc |= linearbuffers_child_label_createf(encoder, "child-%" PRIu64 "", i);
+		rc |= linearbuffers_child_limit_set(encoder, i);
+		rc |= linearbuffers_output_children_push(encoder, linearbuffers_child_end(encoder));
+	}
+	rc |= linearbuffers_output_children_set(encoder, linearbuffers_output_children_end(encoder));
+	rc |= linearbuffers_output_answer_set(encoder, 42);
+	rc |= linearbuffers_output_ratio_set(encoder, 0.25);
+	rc |= linearbuffers_output_f69_set(encoder, 0.75);
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 ", fixed: %" PRIu64 "\n", linearized_buffer, linearized_length, linearbuffers_output_fixed_size());
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (linearbuffers_output_f00_present(output) ||
+	    linearbuffers_output_f00_get(output) != 0 ||
+	    linearbuffers_output_f01_get(output) != UINT64_C(0x0102030405060708) ||
+	    linearbuffers_output_f02_get(output) != -2 ||
+	    linearbuffers_output_f04_get(output) != 0 ||
+	    linearbuffers_output_f63_get(output) != 0x63 ||
+	    linearbuffers_output_f69_get(output) != 0.75) {
+		fprintf(stderr, "decoder failed: scalars\n");
+		goto bail;
+	}
+	if (strcmp(linearbuffers_output_name_get_value(output), "sparse") != 0) {
+		fprintf(stderr, "decoder failed: name\n");
+		goto bail;
+	}
+	if (linearbuffers_output_color_present(output) ||
+	    linearbuffers_output_color_get(output) != linearbuffers_color_green ||
+	    linearbuffers_output_answer_present(output) ||
+	    linearbuffers_output_answer_get(output) != 42 ||
+	    !linearbuffers_output_ratio_present(output) ||
+	    linearbuffers_output_ratio_get(output) != 0.25 ||
+	    linearbuffers_output_tag_present(output)) {
+		fprintf(stderr, "decoder failed: defaults\n");
+		goto bail;
+	}
+	dpoint = linearbuffers_output_point_get(output);
+	if (dpoint == NULL ||
+	    dpoint->x != -3 ||
+	    dpoint->y != 4) {
+		fprintf(stderr, "decoder failed: point\n");
+		goto bail;
+	}
+	if (linearbuffers_output_values_get_count(output) != VALUES_COUNT ||
+	    memcmp(linearbuffers_output_values_get_values(output), values, sizeof(values)) != 0) {
+		fprintf(stderr, "decoder failed: values\n");
+		goto bail;
+	}
+	child = linearbuffers_output_child_get(output);
+	if (linearbuffers_child_id_get(child) != 64 ||
+	    linearbuffers_child_limit_present(child) ||
+	    linearbuffers_child_limit_get(child) != 7 ||
+	    linearbuffers_child_label_present(child)) {
+		fprintf(stderr, "decoder failed: child\n");
+		goto bail;
+	}
+	if (linearbuffers_output_children_get_count(output) != CHILDREN_COUNT) {
+		fprintf(stderr, "decoder failed: children\n");
+		goto bail;
+	}
+	for (i = 0; i < CHILDREN_COUNT; i++) {
+		char label[32];
+		snprintf(label, sizeof(label), "child-%" PRIu64 "", i);
+		child = linearbuffers_output_children_get_at(output, i);
+		if (linearbuffers_child_id_present(child) ||
+		    linearbuffers_child_limit_get(child) != i ||
+		    strcmp(linearbuffers_child_label_get_value(child), label) != 0) {
+			fprintf(stderr, "decoder failed: children at\n");
+			goto bail;
+		}
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,141 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VALUES_COUNT	(300)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	uint64_t n;
+	uint64_t stamps[VALUES_COUNT];
+	int32_t levels[VALUES_COUNT];
+	uint8_t flags[VALUES_COUNT];
+	int64_t offsets[VALUES_COUNT];
+	uint64_t decoded[VALUES_COUNT];
+	int32_t block[LINEARBUFFERS_PACKED_VECTOR_BLOCK_SIZE];
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	for (i = 0; i < VALUES_COUNT; i++) {
+		stamps[i]  = UINT64_C(1600000000000) + (i * 1000) + (i % 7);
+		levels[i]  = (int32_t) (i % 50) - 25;
+		flags[i]   = (i % 3) ? 1 : 200;
+		offsets[i] = (i % 2) ? -((int64_t) i * 3) : (int64_t) INT64_MAX - (int64_t) i;
+	}
+	levels[VALUES_COUNT - 1] = INT32_MIN;
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_stamps_create(encoder, stamps, VALUES_COUNT);
+	rc |= linearbuffers_output_levels_create(encoder, levels, VALUES_COUNT);
+	rc |= linearbuffers_output_flags_create(encoder, flags, VALUES_COUNT);
+	rc |= linearbuffers_output_offsets_create(encoder, offsets, VALUES_COUNT);
+	rc |= linearbuffers_output_plain_create(encoder, stamps, VALUES_COUNT);
+	rc |= linearbuffers_output_empty_create(encoder, NULL, 0);
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	if ((uint64_t) ((const uint8_t *) linearbuffers_output_levels_get(output) - (const uint8_t *) linearbuffers_output_stamps_get(output)) >= sizeof(stamps) / 3) {
+		fprintf(stderr, "packed vectors are not compressed\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (linearbuffers_output_stamps_get_count(output) != VALUES_COUNT ||
+	    linearbuffers_output_levels_get_count(output) != VALUES_COUNT ||
+	    linearbuffers_output_flags_get_count(output) != VALUES_COUNT ||
+	    linearbuffers_output_offsets_get_count(output) != VALUES_COUNT) {
+		fprintf(stderr, "decoder failed: count\n");
+		goto bail;
+	}
+	for (i = 0; i < VALUES_COUNT; i++) {
+		if (linearbuffers_output_stamps_get_at(output, i) != stamps[i] ||
+		    linearbuffers_output_levels_get_at(output, i) != levels[i] ||
+		    linearbuffers_output_flags_get_at(output, i) != flags[i] ||
+		    linearbuffers_output_offsets_get_at(output, i) != offsets[i]) {
+			fprintf(stderr, "decoder failed: get_at %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+
+	n = linearbuffers_output_stamps_decode(output, decoded, VALUES_COUNT);
+	if (n != VALUES_COUNT ||
+	    memcmp(decoded, stamps, sizeof(stamps)) != 0) {
+		fprintf(stderr, "decoder failed: stamps decode\n");
+		goto bail;
+	}
+	n = linearbuffers_output_stamps_decode(output, decoded, 5);
+	if (n != 5 ||
+	    memcmp(decoded, stamps, 5 * sizeof(stamps[0])) != 0) {
+		fprintf(stderr, "decoder failed: stamps partial decode\n");
+		goto bail;
+	}
+	for (i = 0; i * LINEARBUFFERS_PACKED_VECTOR_BLOCK_SIZE < VALUES_COUNT; i++) {
+		n = linearbuffers_output_levels_get_block(output, i, block);
+		if (n != ((VALUES_COUNT - i * LINEARBUFFERS_PACKED_VECTOR_BLOCK_SIZE < LINEARBUFFERS_PACKED_VECTOR_BLOCK_SIZE) ? VALUES_COUNT - i * LINEARBUFFERS_PACKED_VECTOR_BLOCK_SIZE : LINEARBUFFERS_PACKED_VECTOR_BLOCK_SIZE) ||
+		    memcmp(block, levels + i * LINEARBUFFERS_PACKED_VECTOR_BLOCK_SIZE, n * sizeof(block[0])) != 0) {
+			fprintf(stderr, "decoder failed: levels block %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+	if (linearbuffers_output_levels_get_block(output, i, block) != 0) {
+		fprintf(stderr, "decoder failed: levels block end\n");
+		goto bail;
+	}
+
+	if (linearbuffers_output_plain_get_count(output) != VALUES_COUNT ||
+	    memcmp(linearbuffers_output_plain_get_values(output), stamps, sizeof(stamps)) != 0) {
+		fprintf(stderr, "decoder failed: plain\n");
+		goto bail;
+	}
+	if (!linearbuffers_output_empty_present(output) ||
+	    linearbuffers_output_empty_get_count(output) != 0) {
+		fprintf(stderr, "decoder failed: empty\n");
+		goto bail;
+	}
+	if (linearbuffers_output_missing_present(output) ||
+	    linearbuffers_output_missing_get(output) != NULL ||
+	    linearbuffers_output_missing_get_count(output) != 0 ||
+	    linearbuffers_output_missing_decode(output, (uint32_t *) decoded, VALUES_COUNT) != 0) {
+		fprintf(stderr, "decoder failed: missing\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
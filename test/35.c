@@ -0,0 +1,196 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VALUES_COUNT	(1000)
+#define HOSTS_COUNT	(300)
+
+static uint64_t arena_buffer[128];
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	char *hosts_buffer;
+	const uint8_t *indices;
+	const char *status[VALUES_COUNT];
+	const char *hosts[VALUES_COUNT];
+	const char *names[4];
+	uint64_t lengths[4];
+	static const char *codes[] = { "200", "301", "404", "500" };
+	static const char binary[] = { 'a', '\0', 'b' };
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	struct linearbuffers_encoder_create_options encoder_create_options;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	hosts_buffer = NULL;
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	hosts_buffer = malloc(HOSTS_COUNT * 32);
+	if (hosts_buffer == NULL) {
+		fprintf(stderr, "can not allocate memory\n");
+		goto bail;
+	}
+	for (i = 0; i < HOSTS_COUNT; i++) {
+		snprintf(hosts_buffer + i * 32, 32, "host-%" PRIu64 ".example.com", i);
+	}
+	for (i = 0; i < VALUES_COUNT; i++) {
+		status[i] = codes[(i * 7) % 4];
+		hosts[i]  = hosts_buffer + ((i * 13) % HOSTS_COUNT) * 32;
+	}
+	names[0] = binary;
+	lengths[0] = sizeof(binary);
+	names[1] = "";
+	lengths[1] = 0;
+	names[2] = binary;
+	lengths[2] = 1;
+	names[3] = binary;
+	lengths[3] = sizeof(binary);
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_status_create(encoder, status, VALUES_COUNT);
+	rc |= linearbuffers_output_hosts_create(encoder, hosts, VALUES_COUNT);
+	rc |= linearbuffers_output_plain_create(encoder, status, VALUES_COUNT);
+	rc |= linearbuffers_output_names_ncreate(encoder, names, lengths, 4);
+	rc |= linearbuffers_output_empty_create(encoder, NULL, 0);
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if ((uint64_t) ((const uint8_t *) linearbuffers_output_hosts_get(output) - (const uint8_t *) linearbuffers_output_status_get(output)) >= (uint64_t) ((const uint8_t *) linearbuffers_output_names_get(output) - (const uint8_t *) linearbuffers_output_plain_get(output)) / 4) {
+		fprintf(stderr, "dictionary vectors are not compressed\n");
+		goto bail;
+	}
+
+	if (linearbuffers_output_status_get_count(output) != VALUES_COUNT ||
+	    linearbuffers_output_status_get_index_size(output) != sizeof(uint8_t) ||
+	    linearbuffers_string_vector_get_count(linearbuffers_output_status_get_dictionary(output)) != 4) {
+		fprintf(stderr, "decoder failed: status dictionary\n");
+		goto bail;
+	}
+	indices = linearbuffers_output_status_get_indices(output);
+	for (i = 0; i < VALUES_COUNT; i++) {
+		if (strcmp(linearbuffers_output_status_get_at(output, i), status[i]) != 0 ||
+		    linearbuffers_output_status_get_length_at(output, i) != strlen(status[i]) ||
+		    strcmp(linearbuffers_string_vector_get_at(linearbuffers_output_status_get_dictionary(output), indices[i]), status[i]) != 0) {
+			fprintf(stderr, "decoder failed: status %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+
+	if (linearbuffers_output_hosts_get_count(output) != VALUES_COUNT ||
+	    linearbuffers_output_hosts_get_index_size(output) != sizeof(uint16_t) ||
+	    linearbuffers_string_vector_get_count(linearbuffers_output_hosts_get_dictionary(output)) != HOSTS_COUNT) {
+		fprintf(stderr, "decoder failed: hosts dictionary\n");
+		goto bail;
+	}
+	for (i = 0; i < VALUES_COUNT; i++) {
+		if (strcmp(linearbuffers_output_hosts_get_at(output, i), hosts[i]) != 0 ||
+		    linearbuffers_output_hosts_get_index_at(output, i) >= HOSTS_COUNT) {
+			fprintf(stderr, "decoder failed: hosts %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+
+	if (linearbuffers_output_names_get_count(output) != 4 ||
+	    linearbuffers_string_vector_get_count(linearbuffers_output_names_get_dictionary(output)) != 3 ||
+	    linearbuffers_output_names_get_index_at(output, 0) != linearbuffers_output_names_get_index_at(output, 3)) {
+		fprintf(stderr, "decoder failed: names dictionary\n");
+		goto bail;
+	}
+	for (i = 0; i < 4; i++) {
+		if (linearbuffers_output_names_get_length_at(output, i) != lengths[i] ||
+		    memcmp(linearbuffers_output_names_get_at(output, i), names[i], lengths[i]) != 0) {
+			fprintf(stderr, "decoder failed: names %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+
+	if (!linearbuffers_output_empty_present(output) ||
+	    linearbuffers_output_empty_get_count(output) != 0) {
+		fprintf(stderr, "decoder failed: empty\n");
+		goto bail;
+	}
+	if (linearbuffers_output_missing_present(output) ||
+	    linearbuffers_output_missing_get(output) != NULL ||
+	    linearbuffers_output_missing_get_count(output) != 0 ||
+	    linearbuffers_output_missing_get_dictionary(output) != NULL) {
+		fprintf(stderr, "decoder failed: missing\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	memset(&encoder_create_options, 0, sizeof(struct linearbuffers_encoder_create_options));
+	encoder_create_options.arena.buffer = arena_buffer;
+	encoder_create_options.arena.size = sizeof(arena_buffer);
+	encoder = linearbuffers_encoder_create(&encoder_create_options);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+	rc = linearbuffers_output_start(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not start output\n");
+		goto bail;
+	}
+	rc = linearbuffers_output_hosts_create(encoder, hosts, VALUES_COUNT);
+	if (rc == 0) {
+		fprintf(stderr, "encoder failed: arena overflow is not detected\n");
+		goto bail;
+	}
+	rc  = linearbuffers_output_names_ncreate(encoder, names, lengths, 4);
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "encoder failed: arena is not released\n");
+		goto bail;
+	}
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL ||
+	    linearbuffers_output_names_get_count(output) != 4 ||
+	    linearbuffers_output_hosts_present(output)) {
+		fprintf(stderr, "decoder failed: arena output\n");
+		goto bail;
+	}
+
+	free(hosts_buffer);
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (hosts_buffer != NULL) {
+		free(hosts_buffer);
+	}
+	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,159 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEYS_COUNT	(500)
+#define KEY_SIZE	(48)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	char *keys_buffer;
+	char string[KEY_SIZE];
+	const char *keys[KEYS_COUNT];
+	const char *names[3];
+	uint64_t lengths[3];
+	static const char *unsorted[] = { "b", "a" };
+	static const char binary[] = { 'a', '\0', 'b' };
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	keys_buffer = NULL;
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	keys_buffer = malloc(KEYS_COUNT * KEY_SIZE);
+	if (keys_buffer == NULL) {
+		fprintf(stderr, "can not allocate memory\n");
+		goto bail;
+	}
+	for (i = 0; i < KEYS_COUNT; i++) {
+		snprintf(keys_buffer + i * KEY_SIZE, KEY_SIZE, "linearbuffers.symbol.%04" PRIu64 "%s", i * 2, (i % 3) ? "" : ".extra");
+		keys[i] = keys_buffer + i * KEY_SIZE;
+	}
+	names[0] = "";
+	lengths[0] = 0;
+	names[1] = binary;
+	lengths[1] = 1;
+	names[2] = binary;
+	lengths[2] = sizeof(binary);
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_keys_create(encoder, keys, KEYS_COUNT);
+	rc |= linearbuffers_output_plain_create(encoder, keys, KEYS_COUNT);
+	rc |= linearbuffers_output_names_ncreate(encoder, names, lengths, 3);
+	rc |= linearbuffers_output_empty_create(encoder, NULL, 0);
+	if (rc == 0 &&
+	    linearbuffers_output_missing_create(encoder, unsorted, 2) == 0) {
+		fprintf(stderr, "unsorted values are accepted\n");
+		goto bail;
+	}
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if ((uint64_t) ((const uint8_t *) linearbuffers_output_plain_get(output) - (const uint8_t *) linearbuffers_output_keys_get(output)) >= (uint64_t) ((const uint8_t *) linearbuffers_output_names_get(output) - (const uint8_t *) linearbuffers_output_plain_get(output)) / 2) {
+		fprintf(stderr, "front coded vectors are not compressed\n");
+		goto bail;
+	}
+
+	if (linearbuffers_output_keys_get_count(output) != KEYS_COUNT) {
+		fprintf(stderr, "decoder failed: keys count\n");
+		goto bail;
+	}
+	for (i = 0; i < KEYS_COUNT; i++) {
+		if (linearbuffers_output_keys_get_at(output, i, string, sizeof(string)) != strlen(keys[i]) ||
+		    strcmp(string, keys[i]) != 0) {
+			fprintf(stderr, "decoder failed: keys get_at %" PRIu64 "\n", i);
+			goto bail;
+		}
+		if (linearbuffers_output_keys_find(output, keys[i]) != (int64_t) i) {
+			fprintf(stderr, "decoder failed: keys find %" PRIu64 "\n", i);
+			goto bail;
+		}
+		snprintf(string, sizeof(string), "linearbuffers.symbol.%04" PRIu64 "", i * 2 + 1);
+		if (linearbuffers_output_keys_find(output, string) != -1) {
+			fprintf(stderr, "decoder failed: keys find absent %" PRIu64 "\n", i);
+			goto bail;
+		}
+		if (linearbuffers_output_keys_nfind(output, keys[i], strlen(keys[i]) - 1) != -1) {
+			fprintf(stderr, "decoder failed: keys find prefix %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+	if (linearbuffers_output_keys_find(output, "") != -1 ||
+	    linearbuffers_output_keys_find(output, "a") != -1 ||
+	    linearbuffers_output_keys_find(output, "z") != -1) {
+		fprintf(stderr, "decoder failed: keys find bounds\n");
+		goto bail;
+	}
+	if (linearbuffers_output_keys_get_at(output, 0, string, 8) != strlen(keys[0]) ||
+	    strcmp(string, "linearb") != 0 ||
+	    linearbuffers_output_keys_get_at(output, 17, NULL, 0) != strlen(keys[17])) {
+		fprintf(stderr, "decoder failed: keys truncate\n");
+		goto bail;
+	}
+
+	for (i = 0; i < 3; i++) {
+		if (linearbuffers_output_names_get_at(output, i, string, sizeof(string)) != lengths[i] ||
+		    memcmp(string, names[i], lengths[i]) != 0 ||
+		    linearbuffers_output_names_nfind(output, names[i], lengths[i]) != (int64_t) i) {
+			fprintf(stderr, "decoder failed: names %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+
+	if (!linearbuffers_output_empty_present(output) ||
+	    linearbuffers_output_empty_get_count(output) != 0 ||
+	    linearbuffers_output_empty_find(output, "") != -1) {
+		fprintf(stderr, "decoder failed: empty\n");
+		goto bail;
+	}
+	if (linearbuffers_output_missing_present(output) ||
+	    linearbuffers_output_missing_get(output) != NULL ||
+	    linearbuffers_output_missing_get_count(output) != 0 ||
+	    linearbuffers_output_missing_find(output, "a") != -1) {
+		fprintf(stderr, "decoder failed: missing\n");
+		goto bail;
+	}
+
+	free(keys_buffer);
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (keys_buffer != NULL) {
+		free(keys_buffer);
+	}
+	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
@@ -0,0 +1,140 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FLAGS_COUNT	(200)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	uint64_t n;
+	uint64_t popcount;
+	uint8_t flags[FLAGS_COUNT];
+	const struct linearbuffers_child *child;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	for (i = 0; i < FLAGS_COUNT; i++) {
+		flags[i] = ((i % 3) == 0 || i == FLAGS_COUNT - 1) ? 1 : 0;
+	}
+	memset(flags + 64, 0, 70);
+	popcount = 0;
+	for (i = 0; i < FLAGS_COUNT; i++) {
+		popcount += flags[i];
+	}
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_id_set(encoder, 7);
+	rc |= linearbuffers_output_enabled_set(encoder, 1);
+	rc |= linearbuffers_output_visible_set(encoder, 0);
+	rc |= linearbuffers_output_archived_set(encoder, 1);
+	rc |= linearbuffers_output_archived_set(encoder, 0);
+	rc |= linearbuffers_output_count_set(encoder, 3);
+	rc |= linearbuffers_output_locked_set(encoder, 1);
+	rc |= linearbuffers_child_start(encoder);
+	rc |= linearbuffers_child_id_set(encoder, 9);
+	rc |= linearbuffers_child_enabled_set(encoder, 1);
+	rc |= linearbuffers_child_label_create(encoder, "label");
+	rc |= linearbuffers_output_child_set(encoder, linearbuffers_child_end(encoder));
+	rc |= linearbuffers_output_flags_create(encoder, flags, FLAGS_COUNT);
+	rc |= linearbuffers_output_empty_create(encoder, NULL, 0);
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if ((uint64_t) ((const uint8_t *) linearbuffers_output_empty_get(output) - (const uint8_t *) linearbuffers_output_flags_get(output)) > sizeof(uint64_t) + ((FLAGS_COUNT + 63) / 64) * sizeof(uint64_t)) {
+		fprintf(stderr, "bool vector is not packed\n");
+		goto bail;
+	}
+
+	if (linearbuffers_output_id_get(output) != 7 ||
+	    linearbuffers_output_enabled_get(output) != 1 ||
+	    linearbuffers_output_visible_get(output) != 0 ||
+	    linearbuffers_output_archived_get(output) != 0 ||
+	    linearbuffers_output_archived_present(output) ||
+	    linearbuffers_output_count_get(output) != 3 ||
+	    linearbuffers_output_locked_get(output) != 1 ||
+	    linearbuffers_output_locked_present(output)) {
+		fprintf(stderr, "decoder failed: bool\n");
+		goto bail;
+	}
+
+	child = linearbuffers_output_child_get(output);
+	if (linearbuffers_child_id_get(child) != 9 ||
+	    linearbuffers_child_enabled_get(child) != 1 ||
+	    strcmp(linearbuffers_child_label_get_value(child), "label") != 0) {
+		fprintf(stderr, "decoder failed: child\n");
+		goto bail;
+	}
+
+	if (linearbuffers_output_flags_get_count(output) != FLAGS_COUNT ||
+	    linearbuffers_output_flags_get_popcount(output) != popcount) {
+		fprintf(stderr, "decoder failed: flags count\n");
+		goto bail;
+	}
+	for (i = 0; i < FLAGS_COUNT; i++) {
+		if (linearbuffers_output_flags_get_at(output, i) != flags[i]) {
+			fprintf(stderr, "decoder failed: flags get_at %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+	n = 0;
+	for (i = linearbuffers_output_flags_get_next(output, 0); i < FLAGS_COUNT; i = linearbuffers_output_flags_get_next(output, i + 1)) {
+		if (flags[i] != 1) {
+			fprintf(stderr, "decoder failed: flags get_next %" PRIu64 "\n", i);
+			goto bail;
+		}
+		n += 1;
+	}
+	if (n != popcount) {
+		fprintf(stderr, "decoder failed: flags iteration\n");
+		goto bail;
+	}
+
+	if (!linearbuffers_output_empty_present(output) ||
+	    linearbuffers_output_empty_get_count(output) != 0 ||
+	    linearbuffers_output_empty_get_popcount(output) != 0 ||
+	    linearbuffers_output_empty_get_next(output, 0) != 0) {
+		fprintf(stderr, "decoder failed: empty\n");
+		goto bail;
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}
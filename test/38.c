@@ -0,0 +1,168 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define VALUES_COUNT	(37)
+
+int main (int argc, char *argv[])
+{
+	int rc;
+	uint64_t i;
+	float values[VALUES_COUNT];
+	float widened[VALUES_COUNT];
+	const uint16_t *raw;
+	struct linearbuffers_sample sample;
+	const struct linearbuffers_sample *decoded;
+
+	uint64_t linearized_length;
+	const uint8_t *linearized_buffer;
+
+	struct linearbuffers_encoder *encoder;
+	const struct linearbuffers_output *output;
+
+	(void) argc;
+	(void) argv;
+
+	encoder = linearbuffers_encoder_create(NULL);
+	if (encoder == NULL) {
+		fprintf(stderr, "can not create linearbuffers encoder\n");
+		goto bail;
+	}
+
+	for (i = 0; i < VALUES_COUNT; i++) {
+		values[i] = ((float) i - 18.0f) * 0.25f;
+	}
+	values[0] = 65504.0f;
+	values[1] = 100000.0f;
+	values[2] = 5.9604644775390625e-08f;
+	values[3] = -0.0f;
+
+	if (linearbuffers_float16_from_float(1.0f) != 0x3c00 ||
+	    linearbuffers_float16_from_float(-2.0f) != 0xc000 ||
+	    linearbuffers_float16_from_float(65504.0f) != 0x7bff ||
+	    linearbuffers_float16_from_float(100000.0f) != 0x7c00 ||
+	    linearbuffers_float16_from_float(5.9604644775390625e-08f) != 0x0001 ||
+	    linearbuffers_float16_from_float(1.0f + 1.0f / 4096.0f) != 0x3c00 ||
+	    linearbuffers_float16_from_float(1.0f + 3.0f / 2048.0f) != 0x3c02 ||
+	    linearbuffers_float16_from_float(NAN) != 0x7e00 ||
+	    linearbuffers_bfloat16_from_float(1.0f) != 0x3f80 ||
+	    linearbuffers_bfloat16_from_float(-2.0f) != 0xc000 ||
+	    linearbuffers_bfloat16_from_float(1.0f + 1.0f / 256.0f) != 0x3f80 ||
+	    linearbuffers_bfloat16_from_float(1.0f + 3.0f / 256.0f) != 0x3f82 ||
+	    (linearbuffers_bfloat16_from_float(NAN) & 0x7fc0) != 0x7fc0) {
+		fprintf(stderr, "narrowing failed\n");
+		goto bail;
+	}
+
+	memset(&sample, 0, sizeof(sample));
+	sample.weight = linearbuffers_float16_from_float(0.5f);
+	sample.scale = linearbuffers_bfloat16_from_float(-3.0f);
+	sample.id = 11;
+
+	rc  = linearbuffers_output_start(encoder);
+	rc |= linearbuffers_output_half_set(encoder, -1.5f);
+	rc |= linearbuffers_output_brain_set(encoder, 256.0f);
+	rc |= linearbuffers_output_sample_set(encoder, &sample);
+	rc |= linearbuffers_output_halves_create(encoder, values, VALUES_COUNT);
+	rc |= linearbuffers_output_brains_create(encoder, values, VALUES_COUNT);
+	rc |= linearbuffers_output_floats_create(encoder, values, VALUES_COUNT);
+	rc |= linearbuffers_output_pushed_start(encoder);
+	for (i = 0; i < VALUES_COUNT; i++) {
+		rc |= linearbuffers_output_pushed_push(encoder, values[i]);
+	}
+	rc |= linearbuffers_output_pushed_set(encoder, linearbuffers_output_pushed_end(encoder));
+	rc |= linearbuffers_output_finish(encoder);
+	if (rc != 0) {
+		fprintf(stderr, "can not encode output\n");
+		goto bail;
+	}
+
+	linearized_buffer = linearbuffers_encoder_linearized(encoder, &linearized_length);
+	if (linearized_buffer == NULL) {
+		fprintf(stderr, "can not get linearized buffer\n");
+		goto bail;
+	}
+	fprintf(stderr, "linearized: %p, length: %" PRIu64 "\n", linearized_buffer, linearized_length);
+
+	output = linearbuffers_output_decode(linearized_buffer, linearized_length);
+	if (output == NULL) {
+		fprintf(stderr, "decoder failed: linearbuffers_output_decode\n");
+		goto bail;
+	}
+	linearbuffers_output_jsonify(output, LINEARBUFFERS_JSONIFY_FLAG_DEFAULT, (int (*) (void *context, const char *fmt, ...)) fprintf, stderr);
+
+	if (linearbuffers_output_half_get(output) != -1.5f ||
+	    linearbuffers_output_brain_get(output) != 256.0f) {
+		fprintf(stderr, "decoder failed: scalars\n");
+		goto bail;
+	}
+	decoded = linearbuffers_output_sample_get(output);
+	if (linearbuffers_sample_weight_get(decoded) != 0.5f ||
+	    linearbuffers_sample_scale_get(decoded) != -3.0f ||
+	    linearbuffers_sample_id_get(decoded) != 11) {
+		fprintf(stderr, "decoder failed: sample\n");
+		goto bail;
+	}
+
+	if (linearbuffers_output_halves_get_count(output) != VALUES_COUNT ||
+	    linearbuffers_output_halves_get_length(output) != VALUES_COUNT * sizeof(uint16_t) ||
+	    linearbuffers_output_floats_get_length(output) != 2 * linearbuffers_output_halves_get_length(output)) {
+		fprintf(stderr, "decoder failed: halves length\n");
+		goto bail;
+	}
+	raw = linearbuffers_output_halves_get_values(output);
+	for (i = 0; i < VALUES_COUNT; i++) {
+		if (raw[i] != linearbuffers_float16_from_float(values[i])) {
+			fprintf(stderr, "decoder failed: halves raw %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+	if (linearbuffers_output_halves_get_floats(output, widened, VALUES_COUNT + 8) != VALUES_COUNT) {
+		fprintf(stderr, "decoder failed: halves floats\n");
+		goto bail;
+	}
+	for (i = 0; i < VALUES_COUNT; i++) {
+		if (i == 1) {
+			if (!isinf(widened[i]) ||
+			    !isinf(linearbuffers_output_halves_get_at(output, i))) {
+				fprintf(stderr, "decoder failed: halves overflow\n");
+				goto bail;
+			}
+			continue;
+		}
+		if (widened[i] != values[i] ||
+		    linearbuffers_output_halves_get_at(output, i) != values[i] ||
+		    linearbuffers_output_pushed_get_at(output, i) != values[i]) {
+			fprintf(stderr, "decoder failed: halves %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+	if (signbit(widened[3]) == 0) {
+		fprintf(stderr, "decoder failed: halves sign\n");
+		goto bail;
+	}
+
+	raw = linearbuffers_output_brains_get_values(output);
+	if (linearbuffers_output_brains_get_floats(output, widened, VALUES_COUNT) != VALUES_COUNT) {
+		fprintf(stderr, "decoder failed: brains floats\n");
+		goto bail;
+	}
+	for (i = 0; i < VALUES_COUNT; i++) {
+		if (raw[i] != linearbuffers_bfloat16_from_float(values[i]) ||
+		    widened[i] != linearbuffers_output_brains_get_at(output, i) ||
+		    (widened[i] - values[i]) * (widened[i] - values[i]) > (values[i] * values[i]) / (128.0f * 128.0f)) {
+			fprintf(stderr, "decoder failed: brains %" PRIu64 "\n", i);
+			goto bail;
+		}
+	}
+
+	linearbuffers_encoder_destroy(encoder);
+
+	return 0;
+bail:	if (encoder != NULL) {
+		linearbuffers_encoder_destroy(encoder);
+	}
+	return -1;
+}